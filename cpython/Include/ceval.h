@@ -176,6 +176,8 @@ PyAPI_FUNC(void) PyEval_ReInitThreads(void);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _PyEval_SetSwitchInterval(unsigned long microseconds);
 PyAPI_FUNC(unsigned long) _PyEval_GetSwitchInterval(void);
+PyAPI_FUNC(void) _PyEval_SetGILFifo(int fifo);
+PyAPI_FUNC(int) _PyEval_GetGILFifo(void);
 #endif
 
 #define Py_BEGIN_ALLOW_THREADS { \
@@ -7,6 +7,43 @@
 extern "C" {
 #endif
 
+/* Inline cache for LOAD_GLOBAL (see ceval.c).  There is one entry per
+   co_names slot; an entry is valid while the version tags of both the
+   globals and the builtins dicts match the ones recorded when it was
+   filled, in which case value is still owned by one of these dicts. */
+typedef struct {
+    PY_UINT64_T globals_ver;
+    PY_UINT64_T builtins_ver;
+    PyObject *value;            /* borrowed reference */
+} _PyGlobalCacheEntry;
+
+typedef struct {
+    Py_ssize_t hits;
+    Py_ssize_t misses;
+    _PyGlobalCacheEntry entries[1];
+} _PyGlobalCache;
+
+/* Inline cache for LOAD_ATTR on instances whose __dict__ is a split table
+   (see ceval.c).  There is one entry per LOAD_ATTR instruction; site_index
+   maps the offset of each instruction in co_code to its entry.  An entry
+   records where the attribute lives in the values array of instance dicts
+   sharing the keys of the type, and is valid while the type keeps the same
+   version tag (so no descriptor can have appeared for the name). */
+typedef struct {
+    PyTypeObject *type;         /* borrowed reference, only compared */
+    unsigned int tp_version;
+    PyDictKeysObject *keys;     /* strong reference */
+    Py_ssize_t index;
+} _PyAttrCacheEntry;
+
+#define _PyAttrCache_NOSITE 0xFFFF
+
+typedef struct {
+    Py_ssize_t nsites;
+    unsigned short *site_index;
+    _PyAttrCacheEntry entries[1];
+} _PyAttrCache;
+
 /* Bytecode object */
 typedef struct {
     PyObject_HEAD
@@ -33,7 +70,8 @@ typedef struct {
     int co_firstlineno;		/* first source line number */
     PyObject *co_lnotab;	/* string (encoding addr<->lineno mapping) See
 				   Objects/lnotab_notes.txt for details. */
-    void *co_zombieframe;     /* for optimization only (see frameobject.c) */
+    _PyGlobalCache *co_globalcache; /* for optimization only (see ceval.c) */
+    _PyAttrCache *co_attrcache;     /* for optimization only (see ceval.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
 } PyCodeObject;
 
@@ -114,6 +152,12 @@ typedef struct _addr_pair {
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(int) _PyCode_CheckLineNumber(PyCodeObject* co,
                                         int lasti, PyAddrPair *bounds);
+
+/* Allocate co_globalcache; return -1 with an exception set on failure. */
+PyAPI_FUNC(int) _PyCode_InitGlobalCache(PyCodeObject *co);
+
+/* Allocate co_attrcache; return -1 with an exception set on failure. */
+PyAPI_FUNC(int) _PyCode_InitAttrCache(PyCodeObject *co);
 #endif
 
 PyAPI_FUNC(PyObject*) PyCode_Optimize(PyObject *code, PyObject* consts,
@@ -23,6 +23,9 @@ typedef struct _dictkeysobject PyDictKeysObject;
 typedef struct {
     PyObject_HEAD
     Py_ssize_t ma_used;
+    /* Dictionary version: globally unique, value change each time
+       the dictionary is modified */
+    PY_UINT64_T ma_version_tag;
     PyDictKeysObject *ma_keys;
     PyObject **ma_values;
 } PyDictObject;
@@ -98,6 +101,9 @@ PyObject *_PyDict_SizeOf(PyDictObject *);
 PyObject *_PyDict_Pop(PyDictObject *, PyObject *, PyObject *);
 PyObject *_PyDict_FromKeys(PyObject *, PyObject *, PyObject *);
 #define _PyDict_HasSplitTable(d) ((d)->ma_values != NULL)
+Py_ssize_t _PyDict_GetSplitIndex(PyDictObject *mp, PyObject *key);
+void _PyDictKeys_IncRef(PyDictKeysObject *keys);
+void _PyDictKeys_DecRef(PyDictKeysObject *keys);
 
 PyAPI_FUNC(int) PyDict_ClearFreeList(void);
 #endif
@@ -65,6 +65,7 @@ PyAPI_FUNC(PyObject *) _PyList_Extend(PyListObject *, PyObject *);
 
 PyAPI_FUNC(int) PyList_ClearFreeList(void);
 PyAPI_FUNC(void) _PyList_DebugMallocStats(FILE *out);
+PyAPI_FUNC(void) _PyList_MaybeUntrack(PyObject *);
 #endif
 
 /* Macro, trading safety for speed */
@@ -73,6 +74,18 @@ PyAPI_FUNC(void) _PyList_DebugMallocStats(FILE *out);
 #define PyList_SET_ITEM(op, i, v) (((PyListObject *)(op))->ob_item[i] = (v))
 #define PyList_GET_SIZE(op)    Py_SIZE(op)
 #define _PyList_ITEMS(op)      (((PyListObject *)(op))->ob_item)
+
+/* Lists of atomic objects may be untracked by the GC (see
+   _PyList_MaybeUntrack()).  Code that stores an item in an existing list
+   with PyList_SET_ITEM, rather than through the PyList API, must track the
+   list again if the item may take part in a reference cycle. */
+#define _PyList_MAINTAIN_TRACKING(op, item) \
+    do { \
+        if (!_PyObject_GC_IS_TRACKED(op) && \
+            _PyObject_GC_MAY_BE_TRACKED(item)) { \
+            _PyObject_GC_TRACK(op); \
+        } \
+    } while(0)
 #endif
 
 #ifdef __cplusplus
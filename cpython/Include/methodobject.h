@@ -19,6 +19,10 @@ typedef PyObject *(*PyCFunction)(PyObject *, PyObject *);
 typedef PyObject *(*PyCFunctionWithKeywords)(PyObject *, PyObject *,
                                              PyObject *);
 typedef PyObject *(*PyNoArgsFunction)(PyObject *);
+#ifndef Py_LIMITED_API
+typedef PyObject *(*_PyCFunctionFast)(PyObject *, PyObject **, Py_ssize_t,
+                                      PyObject *);
+#endif
 
 PyAPI_FUNC(PyCFunction) PyCFunction_GetFunction(PyObject *);
 PyAPI_FUNC(PyObject *) PyCFunction_GetSelf(PyObject *);
@@ -36,6 +40,10 @@ PyAPI_FUNC(int) PyCFunction_GetFlags(PyObject *);
         (((PyCFunctionObject *)func) -> m_ml -> ml_flags)
 #endif
 PyAPI_FUNC(PyObject *) PyCFunction_Call(PyObject *, PyObject *, PyObject *);
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyCFunction_FastCall(PyObject *, PyObject **,
+                                             Py_ssize_t);
+#endif
 
 struct PyMethodDef {
     const char  *ml_name;   /* The name of the built-in function/method */
@@ -71,6 +79,15 @@ PyAPI_FUNC(PyObject *) PyCFunction_NewEx(PyMethodDef *, PyObject *,
 
 #define METH_COEXIST   0x0040
 
+#ifndef Py_LIMITED_API
+/* METH_FASTCALL functions are _PyCFunctionFast: they get the positional
+   arguments as a C array and their number instead of a tuple, which saves
+   building a tuple for each call from the interpreter loop.  The last
+   argument is the keyword arguments dict if METH_KEYWORDS is also set,
+   NULL otherwise. */
+#define METH_FASTCALL  0x0080
+#endif
+
 #ifndef Py_LIMITED_API
 typedef struct {
     PyObject_HEAD
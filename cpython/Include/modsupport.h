@@ -17,6 +17,7 @@ extern "C" {
 #define PyArg_ParseTupleAndKeywords     _PyArg_ParseTupleAndKeywords_SizeT
 #define PyArg_VaParse                   _PyArg_VaParse_SizeT
 #define PyArg_VaParseTupleAndKeywords   _PyArg_VaParseTupleAndKeywords_SizeT
+#define _PyArg_ParseStack               _PyArg_ParseStack_SizeT
 #define Py_BuildValue                   _Py_BuildValue_SizeT
 #define Py_VaBuildValue                 _Py_VaBuildValue_SizeT
 #else
@@ -38,6 +39,13 @@ PyAPI_FUNC(PyObject *) _Py_BuildValue_SizeT(const char *, ...);
 PyAPI_FUNC(int) _PyArg_NoKeywords(const char *funcname, PyObject *kw);
 PyAPI_FUNC(int) _PyArg_NoPositional(const char *funcname, PyObject *args);
 
+/* Variants of PyArg_ParseTuple() and PyArg_UnpackTuple() for METH_FASTCALL
+   functions, which get their arguments as a C array */
+PyAPI_FUNC(int) _PyArg_ParseStack(PyObject **args, Py_ssize_t nargs,
+                                  const char *, ...);
+PyAPI_FUNC(int) _PyArg_UnpackStack(PyObject **args, Py_ssize_t nargs,
+                                   const char *, Py_ssize_t, Py_ssize_t, ...);
+
 PyAPI_FUNC(int) PyArg_VaParse(PyObject *, const char *, va_list);
 PyAPI_FUNC(int) PyArg_VaParseTupleAndKeywords(PyObject *, PyObject *,
                                                   const char *, char **, va_list);
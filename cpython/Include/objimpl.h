@@ -102,6 +102,17 @@ PyAPI_FUNC(void) PyObject_Free(void *ptr);
 /* This function returns the number of allocated memory blocks, regardless of size */
 PyAPI_FUNC(Py_ssize_t) _Py_GetAllocatedBlocks(void);
 
+#ifndef Py_LIMITED_API
+/* Give the memory of unused pymalloc pools back to the system; return the
+   number of bytes released */
+PyAPI_FUNC(size_t) _PyObject_ReleaseMemory(void);
+
+/* Read the pymalloc settings (PYTHONMALLOCARENASIZE...) from the environment,
+   unless Py_IgnoreEnvironmentFlag is set.  Only the first call does
+   anything, and it must happen before the first arena is allocated. */
+PyAPI_FUNC(void) _PyObject_ConfigureMalloc(void);
+#endif
+
 /* Macros */
 #ifdef WITH_PYMALLOC
 #ifndef Py_LIMITED_API
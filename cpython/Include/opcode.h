@@ -121,6 +121,10 @@ extern "C" {
 #define BUILD_TUPLE_UNPACK      152
 #define BUILD_SET_UNPACK        153
 #define SETUP_ASYNC_WITH        154
+#define LOAD_FAST__LOAD_FAST    155
+#define LOAD_FAST__LOAD_ATTR    156
+#define COMPARE_OP__POP_JUMP_IF_FALSE 157
+#define LOAD_CONST__RETURN_VALUE 158
 
 /* EXCEPT_HANDLER is a special, implicit block type which is created when
    entering an except handler. It is not an opcode but we define it here
@@ -66,6 +66,9 @@ typedef int (*Py_tracefunc)(PyObject *, struct _frame *, int, PyObject *);
 #ifdef Py_LIMITED_API
 typedef struct _ts PyThreadState;
 #else
+/* Number of buckets of the GIL wait time histogram of a thread */
+#define _PyGIL_WAIT_BUCKETS 24
+
 typedef struct _ts {
     /* See Python/ceval.c for comments explaining most fields */
 
@@ -137,6 +140,15 @@ typedef struct _ts {
     PyObject *coroutine_wrapper;
     int in_coroutine_wrapper;
 
+    struct _frame_arena *frame_arena; /* see frameobject.c */
+    struct _obmalloc_cache *obmalloc_cache; /* see obmalloc.c */
+
+    /* GIL scheduling, see ceval_gil.h */
+    int gil_priority;
+    unsigned long gil_wait_hist[_PyGIL_WAIT_BUCKETS];
+    _PyTime_t gil_wait_total;
+    _PyTime_t gil_wait_max;
+
     /* XXX signal handlers should also be here */
 
 } PyThreadState;
@@ -157,6 +169,11 @@ PyAPI_FUNC(PyObject*) PyState_FindModule(struct PyModuleDef*);
 PyAPI_FUNC(void) _PyState_ClearModules(void);
 #endif
 
+#ifndef Py_LIMITED_API
+/* Give the small blocks cached by a thread state back to pymalloc */
+PyAPI_FUNC(void) _PyObject_ClearThreadCache(PyThreadState *);
+#endif
+
 PyAPI_FUNC(PyThreadState *) PyThreadState_New(PyInterpreterState *);
 PyAPI_FUNC(PyThreadState *) _PyThreadState_Prealloc(PyInterpreterState *);
 PyAPI_FUNC(void) _PyThreadState_Init(PyThreadState *);
@@ -256,6 +273,13 @@ PyAPI_FUNC(int) PyGILState_Check(void);
 PyAPI_FUNC(PyObject *) _PyThread_CurrentFrames(void);
 #endif
 
+/* The implementation of sys._getgilstats()  Returns a dict mapping the
+   thread id of each thread of interp to its GIL wait statistics.
+*/
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyThread_GILStats(PyInterpreterState *interp);
+#endif
+
 /* Routines for advanced debuggers, requested by David Beazley.
    Don't use unless you know what you are doing! */
 #ifndef Py_LIMITED_API
@@ -139,6 +139,11 @@ PyAPI_FUNC(_PyTime_t) _PyTime_GetSystemClock(void);
    is available and works. */
 PyAPI_FUNC(_PyTime_t) _PyTime_GetMonotonicClock(void);
 
+/* Same as _PyTime_GetMonotonicClock(), but safe to call without holding the
+   GIL: the debug check that the clock does not go backward keeps the last
+   value in a static variable, and is skipped. */
+PyAPI_FUNC(_PyTime_t) _PyTime_GetMonotonicClockRaw(void);
+
 
 /* Structure used by time.get_clock_info() */
 typedef struct {
@@ -12,9 +12,13 @@ See module py_compile for details of the actual byte-compilation.
 """
 import os
 import sys
+import importlib.machinery
 import importlib.util
+import marshal
 import py_compile
+import stat
 import struct
+from importlib._bootstrap_external import _index_name
 
 try:
     from concurrent.futures import ProcessPoolExecutor
@@ -22,7 +26,7 @@ except ImportError:
     ProcessPoolExecutor = None
 from functools import partial
 
-__all__ = ["compile_dir","compile_file","compile_path"]
+__all__ = ["compile_dir","compile_file","compile_path","write_index"]
 
 def _walk_dir(dir, ddir=None, maxlevels=10, quiet=0):
     if not quiet:
@@ -194,6 +198,142 @@ def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
                                               legacy=legacy, optimize=optimize)
     return success
 
+def _index_directory(dir, maxlevels, optimize, quiet):
+    """Yield the path relative to dir, modification time, names, files,
+    subdirectories and bytecode of dir and its subdirectories."""
+    try:
+        mtime_ns = os.stat(dir).st_mtime_ns
+        # The directory is listed after it is stat'ed, so that its index
+        # entry is stale if the directory changes in the meantime.
+        names = sorted(os.listdir(dir))
+    except OSError:
+        if quiet < 2:
+            print("Can't list {!r}".format(dir))
+        return
+    files = set()
+    subdirs = set()
+    bytecode = {}
+    for name in names:
+        fullname = os.path.join(dir, name)
+        try:
+            mode = os.lstat(fullname).st_mode
+        except OSError:
+            continue
+        # Symbolic links are left to the finders, as their targets can
+        # change without changing the directory.
+        if stat.S_ISDIR(mode):
+            subdirs.add(name)
+        elif stat.S_ISREG(mode):
+            files.add(name)
+            if name.endswith(tuple(importlib.machinery.SOURCE_SUFFIXES)):
+                data = _current_bytecode(fullname, optimize)
+                if data is not None:
+                    bytecode[name] = data
+    yield '', mtime_ns, names, files, subdirs, bytecode
+    if maxlevels <= 0:
+        return
+    for name in sorted(subdirs):
+        if name == '__pycache__':
+            continue
+        for entry in _index_directory(os.path.join(dir, name), maxlevels - 1,
+                                      optimize, quiet):
+            path = entry[0]
+            yield (name + '/' + path if path else name,) + entry[1:]
+
+def _current_bytecode(fullname, optimize):
+    """Return the contents of the bytecode file of the source file fullname
+    if it matches the source file, else None."""
+    opt = optimize if optimize >= 1 else ''
+    cfile = importlib.util.cache_from_source(fullname, optimization=opt)
+    try:
+        st = os.stat(fullname)
+        with open(cfile, 'rb') as chandle:
+            data = chandle.read()
+    except OSError:
+        return None
+    expect = struct.pack('<4sLL', importlib.util.MAGIC_NUMBER,
+                         int(st.st_mtime) & 0xFFFFFFFF,
+                         st.st_size & 0xFFFFFFFF)
+    if data[:12] != expect:
+        return None
+    return data
+
+def write_index(dir, maxlevels=10, quiet=0, optimize=-1):
+    """Write an import index for the given directory tree.
+
+    The index lists the directories of the tree and holds the bytecode of
+    its source modules, so that the interpreters importing modules from
+    the tree neither list its directories nor open the bytecode files.
+    Source files without an up-to-date bytecode file are left out, so the
+    tree should be compiled first.  Directories changed after the index is
+    written are listed again by the interpreters, until the index is
+    written again.
+
+    Arguments (only dir is required):
+
+    dir:       the directory on sys.path to index
+    maxlevels: maximum recursion level (default 10)
+    quiet:     full output with False or 0, errors only with 1,
+               no output with 2
+    optimize:  optimization level or -1 for level of the interpreter
+    """
+    if optimize < 0:
+        optimize = sys.flags.optimize
+    name = _index_name(optimize)
+    if name is None:
+        if quiet < 2:
+            print("Can't write import indexes for this interpreter")
+        return 0
+    cache_dir = os.path.join(dir, '__pycache__')
+    index = os.path.join(cache_dir, name)
+    if not quiet:
+        print('Indexing {!r}...'.format(dir))
+    try:
+        # Before dir's modification time is recorded.
+        os.makedirs(cache_dir, exist_ok=True)
+    except OSError:
+        if quiet < 2:
+            print("Can't create {!r}".format(cache_dir))
+        return 0
+    directories = sorted(
+        (entry[0].encode('utf-8', 'surrogateescape'),) + entry[1:]
+        for entry in _index_directory(dir, maxlevels, optimize, quiet))
+    encoding = sys.getfilesystemencoding().encode('ascii')
+    table = 16 + len(encoding)
+    data = bytearray(table + len(directories) * 32)
+    struct.pack_into('<4s4sLL', data, 0, b'PYIX', importlib.util.MAGIC_NUMBER,
+                     len(directories), len(encoding))
+    data[16:table] = encoding
+    for i, (path, mtime_ns, names, files, subdirs, bytecode) in \
+            enumerate(directories):
+        path_offset = len(data)
+        data += path
+        for source, code in bytecode.items():
+            bytecode[source] = len(data), len(code)
+            data += code
+        block = marshal.dumps((tuple(names), frozenset(files),
+                               frozenset(subdirs), bytecode))
+        block_offset = len(data)
+        data += block
+        struct.pack_into('<QQqLL', data, table + i * 32, path_offset,
+                         block_offset, mtime_ns, len(path), len(block))
+    # The index is replaced rather than rewritten, as interpreters may have
+    # the old one mapped.
+    temp = '{}.{}'.format(index, os.getpid())
+    try:
+        with open(temp, 'wb') as file:
+            file.write(data)
+        os.replace(temp, index)
+    except OSError:
+        if quiet < 2:
+            print("Can't write {!r}".format(index))
+        try:
+            os.unlink(temp)
+        except OSError:
+            pass
+        return 0
+    return 1
+
 
 def main():
     """Script main program."""
@@ -234,6 +374,9 @@ def main():
                               'to the equivalent of -l sys.path'))
     parser.add_argument('-j', '--workers', default=1,
                         type=int, help='Run compileall concurrently')
+    parser.add_argument('--index', action='store_true', dest='index',
+                        help=('write an import index for each directory '
+                              'argument once it is compiled'))
 
     args = parser.parse_args()
     compile_dests = args.compile_dest
@@ -278,6 +421,9 @@ def main():
                                        args.force, args.rx, args.quiet,
                                        args.legacy, workers=args.workers):
                         success = False
+                    if args.index and not write_index(dest, maxlevels,
+                                                      args.quiet):
+                        success = False
             return success
         else:
             return compile_path(legacy=args.legacy, force=args.force,
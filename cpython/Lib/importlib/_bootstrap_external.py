@@ -222,12 +222,13 @@ _code_type = type(_write_atomic.__code__)
 #     Python 3.5a0  3320 (matrix multiplication operator)
 #     Python 3.5b1  3330 (PEP 448: Additional Unpacking Generalizations)
 #     Python 3.5b2  3340 (fix dictionary display evaluation order #11205)
+#     Python 3.5b2  3350 (add superinstructions for frequent opcode pairs)
 #
 # MAGIC must change whenever the bytecode emitted by the compiler may no
 # longer be understood by older implementations of the eval loop (usually
 # due to the addition of new opcodes).
 
-MAGIC_NUMBER = (3340).to_bytes(2, 'little') + b'\r\n'
+MAGIC_NUMBER = (3350).to_bytes(2, 'little') + b'\r\n'
 _RAW_MAGIC_NUMBER = int.from_bytes(MAGIC_NUMBER, 'little')  # For import.c
 
 _PYCACHE = '__pycache__'
@@ -416,6 +417,9 @@ def _validate_bytecode_header(data, source_stats=None, name=None, path=None):
     """Validate the header of the passed-in bytecode against source_stats (if
     given) and returning the bytecode that can be compiled by compile().
 
+    The bytecode is returned as a memoryview over *data* rather than a
+    copy, since marshal.loads() accepts any bytes-like object.
+
     All other arguments are used to enhance error reporting.
 
     ImportError is raised when the magic number is incorrect or the bytecode is
@@ -464,7 +468,7 @@ def _validate_bytecode_header(data, source_stats=None, name=None, path=None):
             if _r_long(raw_size) != source_size:
                 raise ImportError('bytecode is stale for {!r}'.format(name),
                                   **exc_details)
-    return data[12:]
+    return memoryview(data)[12:]
 
 
 def _compile_bytecode(data, name=None, bytecode_path=None, source_path=None):
@@ -1026,6 +1030,140 @@ class _NamespaceLoader:
         return _bootstrap._load_module_shim(self, fullname)
 
 
+# Lazy loading ################################################################
+
+# Modules that FileFinder loads lazily, set by _enable_lazy_import(): None
+# when lazy loading is off, True for all modules, or else a frozenset of
+# module and package names.
+_lazy_import = None
+
+
+def _enable_lazy_import(option):
+    """Turn on lazy loading of source and bytecode modules for -X lazy_import.
+
+    The option is True to load every such module lazily, or a
+    comma-separated string of the modules and packages to load lazily.
+    It is called once the interpreter is initialized, so the modules
+    imported at startup keep their import-time side effects.
+
+    """
+    global _lazy_import
+    if option is True or not option:
+        _lazy_import = True
+    else:
+        _lazy_import = frozenset(name.strip() for name in option.split(',')
+                                 if name.strip())
+
+
+def _is_lazy_import(fullname):
+    """Return True if the module should be loaded lazily."""
+    if _lazy_import is None:
+        return False
+    if _lazy_import is True:
+        return True
+    while fullname:
+        if fullname in _lazy_import:
+            return True
+        fullname = fullname.rpartition('.')[0]
+    return False
+
+
+def _make_lazy_module_types(module_type):
+    """Return the module subclasses used by lazy loading.
+
+    They are created by _setup() because the module type cannot be
+    referenced at import time.
+
+    """
+    class _Module(module_type):
+
+        """A subclass of the module type to allow __class__ manipulation."""
+
+    class _LazyModule(module_type):
+
+        """A subclass of the module type which triggers loading upon attribute access."""
+
+        def __getattribute__(self, attr):
+            """Trigger the load of the module and return the attribute."""
+            # All module metadata must be garnered from __spec__ in order to
+            # avoid using mutated values.
+            # Stop triggering this method.
+            self.__class__ = _Module
+            # Get the original name to make sure no object substitution
+            # occurred in sys.modules.
+            original_name = self.__spec__.name
+            # Figure out exactly what attributes were mutated between the
+            # creation of the module and now.
+            attrs_then = self.__spec__.loader_state
+            attrs_now = self.__dict__
+            attrs_updated = {}
+            for key, value in attrs_now.items():
+                # Code that set the attribute may have kept a reference to the
+                # assigned object, making identity more important than
+                # equality.
+                if key not in attrs_then:
+                    attrs_updated[key] = value
+                elif id(attrs_now[key]) != id(attrs_then[key]):
+                    attrs_updated[key] = value
+            self.__spec__.loader.exec_module(self)
+            # If exec_module() was used directly there is no guarantee the
+            # module object was put into sys.modules.
+            if original_name in sys.modules:
+                if id(self) != id(sys.modules[original_name]):
+                    msg = ('module object for {!r} substituted in sys.modules '
+                           'during a lazy load')
+                    raise ValueError(msg.format(original_name))
+            # Update after loading since that's what would happen in an eager
+            # loading situation.
+            self.__dict__.update(attrs_updated)
+            return getattr(self, attr)
+
+        def __delattr__(self, attr):
+            """Trigger the load and then perform the deletion."""
+            # To trigger the load and raise an exception if the attribute
+            # doesn't exist.
+            self.__getattribute__(attr)
+            delattr(self, attr)
+
+    return _Module, _LazyModule
+
+
+def _make_lazy(module, loader):
+    """Make *module*, created by a lazy loader, run *loader* on first use."""
+    module.__spec__.loader = loader
+    module.__loader__ = loader
+    # Don't need to worry about deep-copying as trying to set an attribute
+    # on an object would have triggered the load,
+    # e.g. ``module.__spec__.loader = None`` would trigger a load from
+    # trying to access module.__spec__.
+    module.__spec__.loader_state = module.__dict__.copy()
+    module.__class__ = _LazyModule
+
+
+class _LazyLoader:
+
+    """Loader used by FileFinder for the modules chosen by -X lazy_import.
+
+    It is the bootstrap counterpart of importlib.util.LazyLoader.  Other
+    attributes, such as get_code(), come from the wrapped loader.
+
+    """
+
+    def __init__(self, loader):
+        self.loader = loader
+
+    def __getattr__(self, name):
+        return getattr(self.loader, name)
+
+    def create_module(self, spec):
+        """Create a module which can have its __class__ manipulated."""
+        return _Module(spec.name)
+
+    def exec_module(self, module):
+        """Make the module load lazily."""
+        _make_lazy(module, self.loader)
+
+
 # Finders #####################################################################
 
 class PathFinder:
@@ -1184,6 +1322,9 @@ class FileFinder:
         self._path_mtime = -1
         self._path_cache = set()
         self._relaxed_path_cache = set()
+        # The import index covering the directory, if any
+        self._index, self._index_path = _find_import_index(self.path)
+        self._indexed = None
 
     def invalidate_caches(self):
         """Invalidate the directory mtime."""
@@ -1204,7 +1345,21 @@ class FileFinder:
         return spec.loader, spec.submodule_search_locations or []
 
     def _get_spec(self, loader_class, fullname, path, smsl, target):
-        loader = loader_class(fullname, path)
+        bytecode = None
+        if loader_class is SourceFileLoader and self._index is not None:
+            directory = self._index_path
+            if smsl:
+                # The __init__ module is in the package's directory.
+                package = _path_split(smsl[0])[1]
+                directory = directory + '/' + package if directory else package
+            bytecode = self._index.bytecode(directory, _path_split(path)[1])
+        if bytecode is not None:
+            loader = _IndexedSourceFileLoader(fullname, path, bytecode)
+        else:
+            loader = loader_class(fullname, path)
+        if (loader_class in (SourceFileLoader, SourcelessFileLoader)
+                and _is_lazy_import(fullname)):
+            loader = _LazyLoader(loader)
         return spec_from_file_location(fullname, path, loader=loader,
                                        submodule_search_locations=smsl)
 
@@ -1214,12 +1369,15 @@ class FileFinder:
         is_namespace = False
         tail_module = fullname.rpartition('.')[2]
         try:
-            mtime = _path_stat(self.path or _os.getcwd()).st_mtime
+            stat_info = _path_stat(self.path or _os.getcwd())
         except OSError:
-            mtime = -1
+            mtime = mtime_ns = -1
+        else:
+            mtime = stat_info.st_mtime
+            mtime_ns = stat_info.st_mtime_ns
         if mtime != self._path_mtime:
-            self._fill_cache()
             self._path_mtime = mtime
+            self._fill_cache(mtime_ns)
         # tail_module keeps the original casing, for __file__ and friends
         if _relax_case():
             cache = self._relaxed_path_cache
@@ -1227,9 +1385,9 @@ class FileFinder:
         else:
             cache = self._path_cache
             cache_module = tail_module
+        base_path = _path_join(self.path, tail_module)
         # Check if the module is the name of a directory (and thus a package).
         if cache_module in cache:
-            base_path = _path_join(self.path, tail_module)
             for suffix, loader_class in self._loaders:
                 init_filename = '__init__' + suffix
                 full_path = _path_join(base_path, init_filename)
@@ -1238,13 +1396,15 @@ class FileFinder:
             else:
                 # If a namespace package, return the path if we don't
                 #  find a module in the next section.
-                is_namespace = _path_isdir(base_path)
+                is_namespace = self._isdir(tail_module, base_path)
         # Check for a file w/ a proper suffix exists.
+        # Neither tail_module nor the suffixes end with a separator, so
+        # appending the suffix is the same as joining the full name.
         for suffix, loader_class in self._loaders:
-            full_path = _path_join(self.path, tail_module + suffix)
-            _verbose_message('trying {}'.format(full_path), verbosity=2)
+            full_path = base_path + suffix
+            _verbose_message('trying {}', full_path, verbosity=2)
             if cache_module + suffix in cache:
-                if _path_isfile(full_path):
+                if self._isfile(tail_module + suffix, full_path):
                     return self._get_spec(loader_class, fullname, full_path, None, target)
         if is_namespace:
             _verbose_message('possible namespace for {}'.format(base_path))
@@ -1253,15 +1413,54 @@ class FileFinder:
             return spec
         return None
 
-    def _fill_cache(self):
-        """Fill the cache of potential modules and packages for this directory."""
+    def _isfile(self, name, path):
+        """Return True if name, at path, is a regular file, using the import
+        index when it lists the directory."""
+        indexed = self._indexed
+        if indexed is not None:
+            if name in indexed.files:
+                return True
+            if name in indexed.directories:
+                return False
+        return _path_isfile(path)
+
+    def _isdir(self, name, path):
+        """Return True if name, at path, is a directory, using the import
+        index when it lists the directory."""
+        indexed = self._indexed
+        if indexed is not None:
+            if name in indexed.directories:
+                return True
+            if name in indexed.files:
+                return False
+        return _path_isdir(path)
+
+    def _fill_cache(self, mtime_ns=None):
+        """Fill the cache of potential modules and packages for this directory.
+
+        The directory is not listed when the import index covering it was
+        written while it had the modification time mtime_ns.
+
+        """
         path = self.path
-        try:
-            contents = _os.listdir(path or _os.getcwd())
-        except (FileNotFoundError, PermissionError, NotADirectoryError):
-            # Directory has either been removed, turned into a file, or made
-            # unreadable.
-            contents = []
+        self._indexed = None
+        if self._index is not None and mtime_ns is not None:
+            if not self._index.ready():
+                # List the directory again once the index can be used.
+                self._path_mtime = -1
+            else:
+                indexed = self._index.directory(self._index_path)
+                if indexed is not None and indexed.mtime_ns == mtime_ns:
+                    self._indexed = indexed
+        if self._indexed is not None:
+            contents = self._indexed.names
+        else:
+            try:
+                contents = _os.listdir(path or _os.getcwd())
+            except (FileNotFoundError, PermissionError, NotADirectoryError):
+                # Directory has either been removed, turned into a file, or
+                # made unreadable.
+                contents = []
         # We store two cached versions, to handle runtime changes of the
         # PYTHONCASEOK environment variable.
         if not sys.platform.startswith('win') or sys.platform != 'uwp':
@@ -1306,6 +1505,336 @@ class FileFinder:
         return 'FileFinder({!r})'.format(self.path)
 
 
+# Import indexes ##############################################################
+
+# An import index lists the directories of a tree on sys.path and holds the
+# bytecode of its source modules, so that the processes importing from the
+# tree neither list its directories nor open its bytecode files.
+# compileall.write_index() writes it to the __pycache__ directory at the top
+# of the tree, named by _index_name(), and FileFinder maps it into memory.
+#
+# The index starts with b'PYIX', MAGIC_NUMBER, the number of directories and
+# the length of the name of the file system encoding, both 4 bytes, and that
+# name.  The directories follow, sorted by their path relative to the top of
+# the tree, with '/' separators, as encoded to UTF-8 with surrogateescape.
+# Each is a record of _INDEX_RECORD_SIZE bytes:
+#
+#   path offset (8 bytes), block offset (8 bytes), st_mtime_ns of the
+#   directory (8 bytes, signed), path length (4 bytes), block length (4 bytes)
+#
+# A block is the marshalled tuple (names, files, directories, bytecode) of the
+# names listed in the directory, the frozensets of the regular files and of
+# the directories among them, and a dict mapping the names of source files to
+# the offset and length of the contents of their bytecode file.  All the
+# integers are little-endian.
+#
+# The names are only used while the modification time of the directory is
+# the one in the index.  The bytecode is checked against the source file, like
+# a bytecode file.
+
+_INDEX_MAGIC = b'PYIX'
+_INDEX_RECORD_SIZE = 32
+
+# Maps the directories on sys.path which have an import index to the index.
+_import_indexes = {}
+
+
+def _index_name(optimization=None):
+    """Return the file name of the import indexes for the optimization level,
+    by default that of the interpreter, or None without a cache tag.
+
+    The optimization level is an int or '', like for cache_from_source().
+
+    """
+    tag = sys.implementation.cache_tag
+    if tag is None:
+        return None
+    if optimization is None:
+        optimization = sys.flags.optimize
+    if optimization == 0:
+        optimization = ''
+    if optimization != '':
+        tag = '{}.{}{}'.format(tag, _OPT, optimization)
+    return '__index__.{}.idx'.format(tag)
+
+
+class _IndexedDirectory:
+
+    """A directory listed in an import index."""
+
+    def __init__(self, mtime_ns, names, files, directories, bytecode):
+        self.mtime_ns = mtime_ns
+        self.names = names
+        self.files = files
+        self.directories = directories
+        self.bytecode = bytecode
+
+
+class _ImportIndex:
+
+    """An import index mapped into memory.
+
+    Only the blocks of the directories looked up are unmarshalled.
+
+    """
+
+    def __init__(self, data):
+        length = _r_long(data[12:16])
+        self._count = _r_long(data[8:12])
+        self._table = 16 + length
+        if (data[:4] != _INDEX_MAGIC or data[4:8] != MAGIC_NUMBER or
+                len(data) < self._table + self._count * _INDEX_RECORD_SIZE):
+            raise ValueError('bad import index')
+        # Checked by ready() once the file system encoding is known.
+        self._encoding = data[16:self._table].tobytes().decode('ascii')
+        self._data = data
+        self._directories = {}
+
+    def ready(self):
+        """Return False until the file system encoding is known, which is
+        after the encodings package is imported."""
+        if self._encoding is not None:
+            try:
+                encoding = sys.getfilesystemencoding()
+            except RuntimeError:
+                return False
+            if encoding != self._encoding:
+                _verbose_message('ignoring import index for the {} encoding',
+                                 self._encoding)
+                self._count = 0
+            self._encoding = None
+        return True
+
+    def directory(self, path):
+        """Return the _IndexedDirectory for the relative path, or None."""
+        try:
+            return self._directories[path]
+        except KeyError:
+            pass
+        if not self.ready():
+            return None
+        data = self._data
+        key = path.encode('utf-8', 'surrogateescape')
+        indexed = None
+        low = 0
+        high = self._count
+        while low < high:
+            middle = (low + high) // 2
+            record = self._table + middle * _INDEX_RECORD_SIZE
+            offset = int.from_bytes(data[record:record + 8], 'little')
+            length = _r_long(data[record + 24:record + 28])
+            name = data[offset:offset + length].tobytes()
+            if name < key:
+                low = middle + 1
+            elif name > key:
+                high = middle
+            else:
+                offset = int.from_bytes(data[record + 8:record + 16], 'little')
+                length = _r_long(data[record + 28:record + 32])
+                mtime_ns = int.from_bytes(data[record + 16:record + 24],
+                                          'little', signed=True)
+                try:
+                    block = marshal.loads(data[offset:offset + length])
+                    indexed = _IndexedDirectory(mtime_ns, *block)
+                except (EOFError, ValueError, TypeError):
+                    _verbose_message('bad block for {!r} in import index',
+                                     path)
+                break
+        self._directories[path] = indexed
+        return indexed
+
+    def bytecode(self, path, name):
+        """Return the contents of the bytecode file of the source file name
+        in the directory at the relative path, or None."""
+        indexed = self.directory(path)
+        if indexed is None:
+            return None
+        try:
+            offset, length = indexed.bytecode[name]
+        except KeyError:
+            return None
+        return self._data[offset:offset + length]
+
+
+def _load_import_index(path):
+    """Map the import index of the directory at path, if it has one."""
+    filename = _path_join(path, _PYCACHE, _index_name())
+    try:
+        with _io.FileIO(filename, 'r') as file:
+            try:
+                data = _imp._map_file(file.fileno())
+            except NotImplementedError:
+                data = file.read()
+        index = _ImportIndex(memoryview(data))
+    except (OSError, ValueError) as exc:
+        if not isinstance(exc, FileNotFoundError):
+            _verbose_message('ignoring import index {!r}: {}', filename, exc)
+        return None
+    _verbose_message('import index {!r}', filename)
+    return index
+
+
+def _find_import_index(path):
+    """Return the import index covering the directory at path and the path
+    of the directory relative to the top of the index, or (None, None).
+
+    Only the directories on sys.path can have an index, which also covers
+    their subdirectories.  Indexes are looked for when a finder is created
+    for a directory on sys.path, and kept once found.
+
+    """
+    if _index_name() is None:
+        return None, None
+    head = path
+    tail = []
+    while head:
+        index = _import_indexes.get(head)
+        if index is not None:
+            return index, '/'.join(reversed(tail))
+        head, name = _path_split(head)
+        tail.append(name)
+    if path in sys.path:
+        index = _load_import_index(path)
+        if index is not None:
+            _import_indexes[path] = index
+            return index, ''
+    return None, None
+
+
+class _IndexedSourceFileLoader(SourceFileLoader):
+
+    """Source file loader reading the bytecode from an import index.
+
+    The bytecode file is read instead when the bytecode in the index doesn't
+    match the source file.
+
+    """
+
+    def __init__(self, fullname, path, bytecode):
+        super(_IndexedSourceFileLoader, self).__init__(fullname, path)
+        self._bytecode = bytecode
+        self._bytecode_path = None
+        self._source_stats = None
+
+    def path_stats(self, path):
+        """Return the metadata for the path."""
+        stats = super(_IndexedSourceFileLoader, self).path_stats(path)
+        if path == self.path:
+            self._bytecode_path = cache_from_source(path)
+            self._source_stats = stats
+        return stats
+
+    def get_data(self, path):
+        """Return the data from path as raw bytes, or the bytecode from the
+        index when path is the bytecode file and the bytecode matches."""
+        if path == self._bytecode_path:
+            try:
+                _validate_bytecode_header(self._bytecode,
+                                          source_stats=self._source_stats,
+                                          name=self.name, path=path)
+            except (ImportError, EOFError):
+                pass
+            else:
+                _verbose_message('bytecode of {!r} from import index',
+                                 self.name, verbosity=2)
+                return self._bytecode
+        return super(_IndexedSourceFileLoader, self).get_data(path)
+
+
+# Startup snapshot ############################################################
+
+# A snapshot file is MAGIC_NUMBER followed by a marshalled dict mapping module
+# names to (path, mtime, size, code) tuples, where path is the module's source
+# or bytecode file, mtime and size are that file's modification time and size
+# and code is its marshalled code object.  Tools/freeze/snapshot.py writes
+# them.
+
+class _SnapshotLoader(_LoaderBasics):
+
+    """Loader for a module whose code is stored in a startup snapshot.
+
+    Everything but the code comes from the file loader for the module's
+    path.
+
+    """
+
+    def __init__(self, loader, data):
+        self.loader = loader
+        self._data = data
+
+    def __getattr__(self, name):
+        return getattr(self.loader, name)
+
+    def get_code(self, fullname):
+        """Return the code object stored in the snapshot.
+
+        The stored code is only used once: reloading the module gets its
+        code from the file system like any other module.
+
+        """
+        data, self._data = self._data, None
+        if data is None:
+            return self.loader.get_code(fullname)
+        _verbose_message('code object for {!r} from snapshot', fullname)
+        return marshal.loads(data)
+
+
+class _SnapshotFinder:
+
+    """Meta path finder for the modules stored in a startup snapshot.
+
+    A module is searched for as PathFinder does, and its stored code is only
+    used when the file found is the one the snapshot was made from and it
+    still has the same modification time and size.  Each module is only
+    looked up once, so that its code can be freed once it is loaded.
+
+    """
+
+    def __init__(self, modules):
+        self._modules = modules
+
+    def find_spec(self, fullname, path=None, target=None):
+        try:
+            location, mtime, size, data = self._modules.pop(fullname)
+        except KeyError:
+            return None
+        spec = PathFinder.find_spec(fullname, path, target)
+        if spec is None or spec.origin != location:
+            _verbose_message('{!r} in snapshot is shadowed', fullname)
+            return spec
+        try:
+            st = _path_stat(location)
+        except OSError:
+            return spec
+        if int(st.st_mtime) != mtime or st.st_size != size:
+            _verbose_message('{!r} in snapshot is stale', fullname)
+            return spec
+        if isinstance(spec.loader, _LazyLoader):
+            spec.loader.loader = _SnapshotLoader(spec.loader.loader, data)
+        else:
+            spec.loader = _SnapshotLoader(spec.loader, data)
+        return spec
+
+
+def _install_snapshot(path):
+    """Find the modules stored in the snapshot file at *path* before
+    searching sys.path.
+
+    It is called for PYTHONSNAPSHOT before the interpreter imports its
+    first source module.
+
+    """
+    with _io.FileIO(path, 'r') as file:
+        data = file.read()
+    if data[:4] != MAGIC_NUMBER:
+        raise ImportError('bad magic number in snapshot {!r}'.format(path),
+                          path=path)
+    modules = marshal.loads(memoryview(data)[4:])
+    _verbose_message('snapshot {!r} with {} modules', path, len(modules))
+    sys.meta_path.insert(sys.meta_path.index(PathFinder),
+                         _SnapshotFinder(modules))
+
+
 # Import setup ###############################################################
 
 def _fix_up_module(ns, name, pathname, cpathname=None):
@@ -1401,6 +1930,11 @@ def _setup(_bootstrap_module):
         winreg_module = _bootstrap._builtin_from_name('winreg')
         setattr(self_module, '_winreg', winreg_module)
 
+    # Module types used by lazy loading
+    lazy_module_types = _make_lazy_module_types(type(sys))
+    setattr(self_module, '_Module', lazy_module_types[0])
+    setattr(self_module, '_LazyModule', lazy_module_types[1])
+
     # Constants
     setattr(self_module, '_relax_case', _make_relax_case())
     EXTENSION_SUFFIXES.extend(_imp.extension_suffixes())
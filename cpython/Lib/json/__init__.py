@@ -55,6 +55,22 @@ Decoding JSON::
     >>> json.load(io)[0] == 'streaming API'
     True
 
+Decoding a stream of JSON values incrementally::
+
+    >>> import json
+    >>> from io import BytesIO
+    >>> io = BytesIO(b'{"id": 1} {"id": 2}\n[3, 4]')
+    >>> list(json.iterload(io))
+    [{'id': 1}, {'id': 2}, [3, 4]]
+    >>> decoder = json.JSONStreamDecoder(items=True)
+    >>> decoder.feed(b'[{"id": 1}, {"i')
+    >>> list(decoder.read_values())
+    [{'id': 1}]
+    >>> decoder.feed(b'd": 2}]')
+    >>> decoder.close()
+    >>> list(decoder.read_values())
+    [{'id': 2}]
+
 Specializing JSON object decoding::
 
     >>> import json
@@ -97,13 +113,13 @@ Using json.tool from the shell to validate and pretty-print::
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads',
-    'JSONDecoder', 'JSONDecodeError', 'JSONEncoder',
+    'dump', 'dumps', 'load', 'loads', 'iterload',
+    'JSONDecoder', 'JSONDecodeError', 'JSONEncoder', 'JSONStreamDecoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder, JSONDecodeError
+from .decoder import JSONDecoder, JSONDecodeError, JSONStreamDecoder
 from .encoder import JSONEncoder
 
 _default_encoder = JSONEncoder(
@@ -239,6 +255,9 @@ def dumps(obj, skipkeys=False, ensure_ascii=True, check_circular=True,
 
 _default_decoder = JSONDecoder(object_hook=None, object_pairs_hook=None)
 
+# The size of the reads of iterload()
+_ITERLOAD_CHUNK_SIZE = 64 * 1024
+
 
 def load(fp, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
@@ -268,6 +287,29 @@ def load(fp, cls=None, object_hook=None, parse_float=None,
         parse_constant=parse_constant, object_pairs_hook=object_pairs_hook, **kw)
 
 
+def iterload(fp, *, items=False, **kw):
+    """Deserialize ``fp`` (a ``.read()``-supporting file-like object containing
+    a stream of JSON values encoded in UTF-8) to an iterator over the Python
+    objects, which are decoded as the file is read.
+
+    If ``items`` is true, the items of a top-level array are returned one by
+    one instead of the whole array.
+
+    The file is read in chunks, so the memory used does not grow with its
+    size.  Other keyword arguments are passed to ``JSONStreamDecoder``.
+
+    """
+    decoder = JSONStreamDecoder(items=items, **kw)
+    while True:
+        data = fp.read(_ITERLOAD_CHUNK_SIZE)
+        if not data:
+            break
+        decoder.feed(data)
+        yield from decoder.read_values()
+    decoder.close()
+    yield from decoder.read_values()
+
+
 def loads(s, encoding=None, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
     """Deserialize ``s`` (a ``str`` instance containing a JSON
@@ -1,5 +1,6 @@
 """Implementation of JSONDecoder
 """
+import collections
 import re
 
 from json import scanner
@@ -7,8 +8,12 @@ try:
     from _json import scanstring as c_scanstring
 except ImportError:
     c_scanstring = None
+try:
+    from _json import make_stream_scanner as c_make_stream_scanner
+except ImportError:
+    c_make_stream_scanner = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONDecodeError', 'JSONStreamDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -21,8 +26,9 @@ class JSONDecodeError(ValueError):
     """Subclass of ValueError with the following additional properties:
 
     msg: The unformatted error message
-    doc: The JSON document being parsed
-    pos: The start index of doc where parsing failed
+    doc: The JSON document being parsed, or None for JSONStreamDecoder
+    pos: The start index of doc where parsing failed (for JSONStreamDecoder,
+         the byte offset in the stream)
     lineno: The line corresponding to pos
     colno: The column corresponding to pos
 
@@ -40,9 +46,24 @@ class JSONDecodeError(ValueError):
         self.colno = colno
 
     def __reduce__(self):
+        if self.doc is None:
+            return _stream_error, (self.msg, self.pos, self.lineno, self.colno)
         return self.__class__, (self.msg, self.doc, self.pos)
 
 
+def _stream_error(msg, pos, lineno, colno):
+    # A JSONDecodeError raised by a stream scanner, which does not keep
+    # the document; pos and colno count bytes.  Note that this function
+    # is used from _json
+    err = JSONDecodeError(msg, '', 0)
+    err.args = ('%s: line %d column %d (byte %d)' % (msg, lineno, colno, pos),)
+    err.doc = None
+    err.pos = pos
+    err.lineno = lineno
+    err.colno = colno
+    return err
+
+
 _CONSTANTS = {
     '-Infinity': NegInf,
     'Infinity': PosInf,
@@ -250,6 +271,353 @@ def JSONArray(s_and_end, scan_once, _w=WHITESPACE.match, _ws=WHITESPACE_STR):
     return values, end
 
 
+# The stream scanner works on UTF-8 encoded bytes
+STREAM_WHITESPACE = re.compile(br'[ \t\n\r]*')
+STREAM_NUMBER_BYTES = re.compile(br'[-+.eE0-9]*')
+STREAM_NUMBER_RE = re.compile(
+    br'(-?(?:0|[1-9][0-9]*))(\.[0-9]+)?([eE][-+]?[0-9]+)?')
+STREAM_HEX4 = re.compile(br'[0-9a-fA-F]{4}')
+STREAM_STRINGCHUNK = re.compile(br'[^"\\\x00-\x1f]*')
+STREAM_STRINGCHUNK_NONSTRICT = re.compile(br'[^"\\]*')
+STREAM_BACKSLASH = {
+    ord('"'): '"', ord('\\'): '\\', ord('/'): '/',
+    ord('b'): '\b', ord('f'): '\f', ord('n'): '\n', ord('r'): '\r',
+    ord('t'): '\t',
+}
+STREAM_LITERALS = {
+    ord('n'): (b'null', None),
+    ord('t'): (b'true', True),
+    ord('f'): (b'false', False),
+}
+STREAM_CONSTANTS = {
+    ord('N'): b'NaN',
+    ord('I'): b'Infinity',
+}
+
+# Parser states of PyStreamScanner, as in _json.c
+(STREAM_VALUE, STREAM_ARRAY_FIRST, STREAM_ARRAY_NEXT, STREAM_OBJECT_FIRST,
+ STREAM_OBJECT_KEY, STREAM_OBJECT_COLON, STREAM_OBJECT_NEXT) = range(7)
+
+STREAM_EXPECTING = [
+    "Expecting value",
+    "Expecting value",
+    "Expecting ',' delimiter",
+    "Expecting property name enclosed in double quotes",
+    "Expecting property name enclosed in double quotes",
+    "Expecting ':' delimiter",
+    "Expecting ',' delimiter",
+]
+
+# Returned by the _scan methods for a token that is not complete yet
+_INCOMPLETE = object()
+
+
+class PyStreamScanner(object):
+    """Incremental scanner of a stream of JSON values encoded in UTF-8.
+
+    feed() parses a chunk of bytes and close() the end of the stream; both
+    return the list of the values they completed.  Containers being built
+    are kept on a stack and only the bytes of an incomplete token are kept
+    between two chunks.
+    """
+
+    def __init__(self, context, items=False):
+        self.strict = context.strict
+        self.object_hook = context.object_hook
+        self.object_pairs_hook = context.object_pairs_hook
+        self.parse_float = context.parse_float
+        self.parse_int = context.parse_int
+        self.parse_constant = context.parse_constant
+        self.memo = {}
+        self._items = items
+        self._stringchunk = (STREAM_STRINGCHUNK if self.strict
+                             else STREAM_STRINGCHUNK_NONSTRICT).match
+        # (container, key, is_object) of the open arrays and objects
+        self._stack = []
+        self._state = STREAM_VALUE
+        self._buf = bytearray()
+        self._string_scanned = 0
+        self._string_escape = False
+        self._offset = 0
+        self._lineno = 1
+        self._linestart = 0
+        self._values = None
+        self._closed = False
+
+    def feed(self, data):
+        if self._closed:
+            raise ValueError("feed() called after close()")
+        self._buf += data
+        return self._run(False)
+
+    def close(self):
+        if self._closed:
+            return []
+        self._closed = True
+        return self._run(True)
+
+    def _run(self, final):
+        self._values = values = []
+        try:
+            self._parse(final)
+        finally:
+            self.memo.clear()
+            self._values = None
+        return values
+
+    def _error(self, msg, idx):
+        buf = self._buf
+        lineno = self._lineno + buf.count(b'\n', 0, idx)
+        nl = buf.rfind(b'\n', 0, idx)
+        if nl < 0:
+            linestart = self._linestart
+        else:
+            linestart = self._offset + nl + 1
+        pos = self._offset + idx
+        return _stream_error(msg, pos, lineno, pos - linestart + 1)
+
+    def _parse(self, final, _w=STREAM_WHITESPACE.match):
+        buf = self._buf
+        end = len(buf)
+        idx = 0
+        while True:
+            idx = _w(buf, idx).end()
+            if idx == end:
+                break
+            c = buf[idx]
+            state = self._state
+            if state == STREAM_ARRAY_NEXT or (state == STREAM_ARRAY_FIRST and
+                                              c == 93):     # ']'
+                if c == 93:                                 # ']'
+                    idx += 1
+                    self._pop()
+                elif c == 44:                               # ','
+                    idx += 1
+                    self._state = STREAM_VALUE
+                else:
+                    raise self._error("Expecting ',' delimiter", idx)
+                continue
+            if state == STREAM_OBJECT_FIRST or state == STREAM_OBJECT_KEY:
+                if c == 125 and state == STREAM_OBJECT_FIRST:   # '}'
+                    idx += 1
+                    self._pop()
+                    continue
+                if c != 34:                                 # '"'
+                    raise self._error(
+                        "Expecting property name enclosed in double quotes",
+                        idx)
+                key, next_idx = self._scan_string(idx, final)
+                if key is _INCOMPLETE:
+                    break
+                self._stack[-1][1] = self.memo.setdefault(key, key)
+                self._state = STREAM_OBJECT_COLON
+                idx = next_idx
+                continue
+            if state == STREAM_OBJECT_COLON:
+                if c != 58:                                 # ':'
+                    raise self._error("Expecting ':' delimiter", idx)
+                idx += 1
+                self._state = STREAM_VALUE
+                continue
+            if state == STREAM_OBJECT_NEXT:
+                if c == 125:                                # '}'
+                    idx += 1
+                    self._pop()
+                elif c == 44:                               # ','
+                    idx += 1
+                    self._state = STREAM_OBJECT_KEY
+                else:
+                    raise self._error("Expecting ',' delimiter", idx)
+                continue
+
+            # read any JSON term
+            if c == 123 or c == 91:                         # '{' or '['
+                idx += 1
+                self._push(c == 123)
+                continue
+            value, next_idx = self._scan_term(idx, final)
+            if value is _INCOMPLETE:
+                break
+            idx = next_idx
+            self._add_value(value)
+        if final and self._stack:
+            raise self._error(STREAM_EXPECTING[self._state], idx)
+        self._consume(idx)
+
+    def _consume(self, idx):
+        buf = self._buf
+        count = buf.count(b'\n', 0, idx)
+        if count:
+            self._lineno += count
+            self._linestart = self._offset + buf.rfind(b'\n', 0, idx) + 1
+        self._offset += idx
+        # deleting from the start of a bytearray takes constant time
+        del buf[:idx]
+
+    def _push(self, is_object):
+        if is_object:
+            container = [] if self.object_pairs_hook is not None else {}
+            self._state = STREAM_OBJECT_FIRST
+        else:
+            container = None if self._items and not self._stack else []
+            self._state = STREAM_ARRAY_FIRST
+        self._stack.append([container, None, is_object])
+
+    def _pop(self):
+        container, key, is_object = self._stack.pop()
+        if container is None:
+            # the items of this array were already returned
+            self._state = STREAM_VALUE
+            return
+        if is_object:
+            if self.object_pairs_hook is not None:
+                container = self.object_pairs_hook(container)
+            elif self.object_hook is not None:
+                container = self.object_hook(container)
+        self._add_value(container)
+
+    def _add_value(self, value):
+        if not self._stack:
+            self._state = STREAM_VALUE
+            self._values.append(value)
+            return
+        frame = self._stack[-1]
+        container, key, is_object = frame
+        if not is_object:
+            self._state = STREAM_ARRAY_NEXT
+            if container is None:
+                self._values.append(value)
+            else:
+                container.append(value)
+        else:
+            self._state = STREAM_OBJECT_NEXT
+            if self.object_pairs_hook is not None:
+                container.append((key, value))
+            else:
+                container[key] = value
+            frame[1] = None
+
+    def _scan_term(self, idx, final):
+        buf = self._buf
+        c = buf[idx]
+        if c == 34:                                         # '"'
+            return self._scan_string(idx, final)
+        if c in STREAM_LITERALS:
+            literal, value = STREAM_LITERALS[c]
+            if self._match_literal(idx, final, literal):
+                return value, idx + len(literal)
+            return _INCOMPLETE, None
+        if c in STREAM_CONSTANTS or (c == 45 and
+                                     buf[idx + 1:idx + 2] == b'I'):
+            literal = STREAM_CONSTANTS.get(c, b'-Infinity')
+            if self._match_literal(idx, final, literal):
+                return (self.parse_constant(literal.decode('ascii')),
+                        idx + len(literal))
+            return _INCOMPLETE, None
+        if c == 45 and idx + 1 == len(buf) and not final:   # '-'
+            return _INCOMPLETE, None
+        return self._match_number(idx, final)
+
+    def _match_literal(self, idx, final, literal):
+        # Return False if the buffer ends in a prefix of the literal.
+        avail = self._buf[idx:idx + len(literal)]
+        if not literal.startswith(avail) or (len(avail) < len(literal)
+                                             and final):
+            raise self._error("Expecting value", idx)
+        return len(avail) == len(literal)
+
+    def _match_number(self, idx, final):
+        buf = self._buf
+        # a number ends at the first byte that cannot be part of it
+        end = STREAM_NUMBER_BYTES.match(buf, idx).end()
+        if end == len(buf) and not final:
+            return _INCOMPLETE, None
+        m = STREAM_NUMBER_RE.match(buf, idx, end)
+        if m is None:
+            raise self._error("Expecting value", idx)
+        integer, frac, exp = m.groups()
+        if frac or exp:
+            number = integer + (frac or b'') + (exp or b'')
+            res = self.parse_float(number.decode('ascii'))
+        else:
+            res = self.parse_int(integer.decode('ascii'))
+        return res, m.end()
+
+    def _scan_string(self, begin, final):
+        # Return the decoded string and the index after its closing quote,
+        # or _INCOMPLETE if the quote is not in the buffer yet; the next
+        # call resumes the scan where this one stopped.
+        buf = self._buf
+        end = len(buf)
+        next = begin + 1 + self._string_scanned
+        has_escape = self._string_escape
+        match = self._stringchunk
+        while True:
+            next = match(buf, next).end()
+            if next == end:
+                break
+            c = buf[next]
+            if c == 34:                                     # '"'
+                self._string_scanned = 0
+                self._string_escape = False
+                if has_escape:
+                    return self._decode_string(begin, next), next + 1
+                return buf[begin + 1:next].decode('utf-8'), next + 1
+            if c != 92:                                     # '\\'
+                raise self._error("Invalid control character at", next)
+            if next + 1 == end:
+                break
+            has_escape = True
+            next += 2
+        if final:
+            raise self._error("Unterminated string starting at", begin)
+        self._string_scanned = next - begin - 1
+        self._string_escape = has_escape
+        return _INCOMPLETE, None
+
+    def _decode_string(self, begin, end):
+        # Escapes are ASCII, so the UTF-8 runs between them are decoded
+        # as a whole.
+        buf = self._buf
+        chunks = []
+        _append = chunks.append
+        chunk = begin + 1
+        while True:
+            next = buf.find(b'\\', chunk, end)
+            if next < 0:
+                _append(buf[chunk:end].decode('utf-8'))
+                break
+            _append(buf[chunk:next].decode('utf-8'))
+            esc = buf[next + 1]
+            if esc != 117:                                  # 'u'
+                try:
+                    _append(STREAM_BACKSLASH[esc])
+                except KeyError:
+                    raise self._error("Invalid \\escape", next) from None
+                chunk = next + 2
+                continue
+            uni = self._decode_uXXXX(next + 1, end)
+            chunk = next + 6
+            if (0xd800 <= uni <= 0xdbff and chunk + 6 <= end and
+                    buf[chunk:chunk + 2] == b'\\u'):
+                uni2 = self._decode_uXXXX(chunk + 1, end)
+                if 0xdc00 <= uni2 <= 0xdfff:
+                    uni = 0x10000 + (((uni - 0xd800) << 10) | (uni2 - 0xdc00))
+                    chunk += 6
+            _append(chr(uni))
+        return ''.join(chunks)
+
+    def _decode_uXXXX(self, pos, end):
+        # pos is the index of the 'u'
+        if pos + 5 <= end and STREAM_HEX4.match(self._buf, pos + 1):
+            return int(self._buf[pos + 1:pos + 5], 16)
+        raise self._error("Invalid \\uXXXX escape", pos)
+
+
+# Use speedup if available
+make_stream_scanner = c_make_stream_scanner or PyStreamScanner
+
+
 class JSONDecoder(object):
     """Simple JSON <http://json.org> decoder
 
@@ -356,3 +724,59 @@ class JSONDecoder(object):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+class JSONStreamDecoder(object):
+    """Incremental JSON decoder of a stream of UTF-8 encoded bytes.
+
+    The stream is given to ``feed()`` in chunks of any size, and the
+    values that are complete can be read with ``read_values()``.  The
+    stream holds any number of JSON values, optionally separated by
+    whitespace.  Only the containers being built and the bytes of the
+    token cut by the end of a chunk are kept, so the memory used does not
+    grow with the size of the stream.
+
+    If ``items`` is true, the items of a top-level array are returned one
+    by one as they complete, instead of the whole array at its end.
+
+    The other arguments have the same meaning as in ``JSONDecoder``.
+
+    """
+
+    def __init__(self, *, items=False, object_hook=None, parse_float=None,
+            parse_int=None, parse_constant=None, strict=True,
+            object_pairs_hook=None):
+        context = JSONDecoder(object_hook=object_hook,
+                              parse_float=parse_float, parse_int=parse_int,
+                              parse_constant=parse_constant, strict=strict,
+                              object_pairs_hook=object_pairs_hook)
+        self._scanner = make_stream_scanner(context, items)
+        self._values = collections.deque()
+
+    def feed(self, data):
+        """Decode a chunk of the stream: a bytes-like object, or a ``str``
+        which is encoded to UTF-8.
+
+        """
+        if isinstance(data, str):
+            data = data.encode('utf-8')
+        self._values.extend(self._scanner.feed(data))
+
+    def close(self):
+        """Mark the end of the stream.
+
+        Raise ``JSONDecodeError`` if it ends inside a value.
+
+        """
+        self._values.extend(self._scanner.close())
+
+    def read_values(self):
+        """Return an iterator over the values completed so far.
+
+        Values are removed from the decoder as they are retrieved from the
+        iterator.
+
+        """
+        values = self._values
+        while values:
+            yield values.popleft()
@@ -44,6 +44,22 @@ CONNECTION_TIMEOUT = 20.
 
 _mmap_counter = itertools.count()
 
+# Objects are pickled with protocol 5 so that the data of PickleBuffer
+# objects can be sent out-of-band, after the pickle, instead of being
+# copied into it.  Such messages start with _OOB_MARKER, which no pickle
+# starts with, followed by the number of buffers and the sizes of the
+# pickle and of each buffer.
+_PICKLE_PROTOCOL = 5
+_OOB_MARKER = b'\xff'
+_OOB_HEADER = struct.Struct("!cI")
+
+try:
+    _IOV_MAX = os.sysconf('SC_IOV_MAX')
+except (AttributeError, ValueError, OSError):
+    _IOV_MAX = -1
+if _IOV_MAX <= 0:
+    _IOV_MAX = 16
+
 default_family = 'AF_INET'
 families = ['AF_INET']
 
@@ -203,7 +219,21 @@ class _ConnectionBase:
         """Send a (picklable) object"""
         self._check_closed()
         self._check_writable()
-        self._send_bytes(ForkingPickler.dumps(obj))
+        buffers = []
+        buf = ForkingPickler.dumps(obj, _PICKLE_PROTOCOL,
+                                   buffer_callback=buffers.append)
+        if not buffers:
+            self._send_bytes(buf)
+            return
+        views = [b.raw() for b in buffers]
+        header = _OOB_HEADER.pack(_OOB_MARKER, len(views))
+        header += struct.pack("!%dQ" % (len(views) + 1), len(buf),
+                              *[v.nbytes for v in views])
+        self._send_chunks([header, buf] + views)
+
+    def _send_chunks(self, chunks):
+        # Send the concatenation of chunks as one message.
+        self._send_bytes(b''.join(chunks))
 
     def recv_bytes(self, maxlength=None):
         """
@@ -248,7 +278,7 @@ class _ConnectionBase:
         self._check_closed()
         self._check_readable()
         buf = self._recv_bytes()
-        return ForkingPickler.loads(buf.getbuffer())
+        return _loads(buf.getbuffer())
 
     def poll(self, timeout=0.0):
         """Whether there is any input available to be read"""
@@ -410,11 +440,41 @@ class Connection(_ConnectionBase):
             return None
         return self._recv(size)
 
+    if not _winapi and hasattr(os, 'writev'):
+        def _send_chunks(self, chunks, writev=os.writev):
+            # Hand the chunks to writev() rather than joining them, so
+            # that out-of-band buffers are not copied.
+            chunks = [memoryview(c) for c in chunks]
+            n = sum(c.nbytes for c in chunks)
+            chunks.insert(0, memoryview(struct.pack("!i", n)))
+            i = 0
+            while i < len(chunks):
+                n = writev(self._handle, chunks[i:i + _IOV_MAX])
+                while i < len(chunks) and n >= chunks[i].nbytes:
+                    n -= chunks[i].nbytes
+                    i += 1
+                if n:
+                    chunks[i] = chunks[i][n:]
+
     def _poll(self, timeout):
         r = wait([self], timeout)
         return bool(r)
 
 
+def _loads(buf):
+    # Unpickle a message sent by send(); out-of-band buffers are views
+    # into buf.
+    if buf[:1] != _OOB_MARKER:
+        return ForkingPickler.loads(buf)
+    marker, count = _OOB_HEADER.unpack_from(buf)
+    sizes = struct.unpack_from("!%dQ" % (count + 1), buf, _OOB_HEADER.size)
+    offset = _OOB_HEADER.size + 8 * (count + 1)
+    chunks = []
+    for size in sizes:
+        chunks.append(buf[offset:offset + size])
+        offset += size
+    return ForkingPickler.loads(chunks[0], buffers=chunks[1:])
+
 #
 # Public functions
 #
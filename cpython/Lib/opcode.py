@@ -213,4 +213,16 @@ def_op('BUILD_MAP_UNPACK_WITH_CALL', 151)
 def_op('BUILD_TUPLE_UNPACK', 152)
 def_op('BUILD_SET_UNPACK', 153)
 
+# Superinstructions emitted by the peephole optimizer.  Each one performs
+# the first instruction of a frequent pair and then runs the second one,
+# which is left in place after it, without a separate dispatch.
+def_op('LOAD_FAST__LOAD_FAST', 155)
+haslocal.append(155)
+def_op('LOAD_FAST__LOAD_ATTR', 156)
+haslocal.append(156)
+def_op('COMPARE_OP__POP_JUMP_IF_FALSE', 157)
+hascompare.append(157)
+def_op('LOAD_CONST__RETURN_VALUE', 158)
+hasconst.append(158)
+
 del def_op, name_op, jrel_op, jabs_op
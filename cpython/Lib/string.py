@@ -44,6 +44,10 @@ def capwords(s, sep=None):
     return (sep or ' ').join(x.capitalize() for x in s.split(sep))
 
 
+# Accumulate strings and join them in linear time; implemented in C.
+Builder = _string.Builder
+
+
 ####################################################################
 import re as _re
 from collections import ChainMap
@@ -1777,4 +1777,4 @@ else:
             def kill(self):
                 """Kill the process with SIGKILL
                 """
-            self.send_signal(signal.SIGKILL)
+                self.send_signal(signal.SIGKILL)
@@ -18,6 +18,7 @@ import random
 import logging
 import struct
 import operator
+import pickle
 import test.support
 import test.support.script_helper
 
@@ -2288,6 +2289,37 @@ class _TestConnection(BaseTestCase):
             self.assertRaises(OSError, writer.recv)
             self.assertRaises(OSError, writer.poll)
 
+    @unittest.skipUnless(hasattr(pickle, 'PickleBuffer'),
+                         'requires pickle.PickleBuffer')
+    def test_picklebuffer(self):
+        if self.TYPE != 'processes':
+            self.skipTest('test not appropriate for {}'.format(self.TYPE))
+
+        a, b = self.Pipe()
+        big = bytearray(b'x' * 4096)
+        small = [pickle.PickleBuffer(bytearray(b'%d' % i)) for i in range(100)]
+        a.send([pickle.PickleBuffer(big), pickle.PickleBuffer(b'ro'),
+                pickle.PickleBuffer(bytearray())] + small)
+        res = b.recv()
+        self.assertEqual(len(res), 103)
+        self.assertEqual(res[0], big)
+        self.assertFalse(res[0].readonly)
+        self.assertEqual(res[1], b'ro')
+        self.assertTrue(res[1].readonly)
+        self.assertEqual(res[2], b'')
+        self.assertEqual([bytes(m) for m in res[3:]],
+                         [b'%d' % i for i in range(100)])
+
+        # The buffers are sent after the pickle, not copied into it.
+        a.send([pickle.PickleBuffer(big)])
+        msg = b.recv_bytes()
+        self.assertTrue(msg.endswith(big))
+        self.assertLess(len(msg), len(big) + 100)
+
+        # Other objects are sent as plain pickles.
+        a.send([big])
+        self.assertEqual(pickle.loads(b.recv_bytes()), [big])
+
     def test_spawn_close(self):
         # We test that a pipe connection can be closed by parent
         # process immediately after child is spawned.  On Windows this
@@ -753,6 +753,100 @@ class AbstractPickleTests(unittest.TestCase):
                 p = self.dumps(s, proto)
                 self.assert_is_copy(s, self.loads(p))
 
+    def test_bytearray(self):
+        for proto in protocols:
+            for s in b'', b'xyz', b'xyz'*100:
+                b = bytearray(s)
+                p = self.dumps(b, proto)
+                bb = self.loads(p)
+                self.assertIsNot(bb, b)
+                self.assert_is_copy(b, bb)
+                if proto >= 5:
+                    self.assertNotIn(b'bytearray', p)
+                    self.assertTrue(opcode_in_pickle(pickle.BYTEARRAY8, p))
+                else:
+                    self.assertIn(b'bytearray', p)
+
+    def buffer_like_objects(self):
+        # Writable and read-only contiguous buffers.
+        yield b'abcdefgh'
+        yield bytearray(b'abcdefgh')
+        yield memoryview(b'abcdefgh').cast('B', (2, 4))
+        yield memoryview(bytearray(b'abcdefgh')).cast('B', (2, 4))
+
+    @unittest.skipUnless(hasattr(pickle, 'PickleBuffer'),
+                         'requires pickle.PickleBuffer')
+    def test_in_band_buffers(self):
+        for obj in self.buffer_like_objects():
+            with memoryview(obj) as m:
+                data, readonly = m.tobytes(), m.readonly
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                p = self.dumps(pickle.PickleBuffer(obj), proto)
+                new = self.loads(p)
+                self.assertIs(type(new), bytes if readonly else bytearray)
+                self.assertEqual(new, data)
+                # A callback returning true keeps the buffer in-band.
+                buffers = []
+                def buffer_callback(buf):
+                    buffers.append(buf)
+                    return True
+                self.assertEqual(self.dumps(pickle.PickleBuffer(obj), proto,
+                                            buffer_callback=buffer_callback),
+                                 p)
+                self.assertEqual(len(buffers), 1)
+                self.assertIsInstance(buffers[0], pickle.PickleBuffer)
+
+    @unittest.skipUnless(hasattr(pickle, 'PickleBuffer'),
+                         'requires pickle.PickleBuffer')
+    def test_oob_buffers(self):
+        for obj in self.buffer_like_objects():
+            with memoryview(obj) as m:
+                data, readonly = m.tobytes(), m.readonly
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                buffers = []
+                p = self.dumps([pickle.PickleBuffer(obj)] * 2, proto,
+                               buffer_callback=lambda buf: buffers.append(buf))
+                self.assertNotIn(data, p)
+                self.assertEqual(len(buffers), 1)
+                self.assertEqual(count_opcode(pickle.NEXT_BUFFER, p), 1)
+                self.assertEqual(opcode_in_pickle(pickle.READONLY_BUFFER, p),
+                                 readonly)
+                # The unpickler gets the buffers back without a copy.
+                new = self.loads(p, buffers=buffers)
+                self.assertEqual(new, [buffers[0]] * 2)
+                # Writable buffers given for read-only data are made
+                # read-only.
+                new = self.loads(p, buffers=[bytearray(data)])
+                self.assertIs(new[0], new[1])
+                if readonly:
+                    self.assertIsInstance(new[0], memoryview)
+                    self.assertTrue(new[0].readonly)
+                else:
+                    self.assertIs(type(new[0]), bytearray)
+                self.assertEqual(bytes(new[0]), data)
+
+                with self.assertRaises(pickle.UnpicklingError):
+                    self.loads(p)
+                with self.assertRaises(pickle.UnpicklingError):
+                    self.loads(p, buffers=[])
+
+    @unittest.skipUnless(hasattr(pickle, 'PickleBuffer'),
+                         'requires pickle.PickleBuffer')
+    def test_buffers_errors(self):
+        pb = pickle.PickleBuffer(b'abc')
+        for proto in range(5):
+            with self.assertRaises(pickle.PicklingError):
+                self.dumps(pb, proto)
+            with self.assertRaises(ValueError):
+                self.dumps(pb, proto, buffer_callback=lambda buf: None)
+        # Non-contiguous buffers can not be pickled.
+        pb = pickle.PickleBuffer(memoryview(b'abcdefgh')[::2])
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            with self.assertRaises(pickle.PicklingError):
+                self.dumps(pb, proto)
+            with self.assertRaises(pickle.PicklingError):
+                self.dumps(pb, proto, buffer_callback=lambda buf: None)
+
     def test_ints(self):
         import sys
         for proto in protocols:
@@ -2054,7 +2148,7 @@ class AbstractPickleModuleTests(unittest.TestCase):
 
     def test_highest_protocol(self):
         # Of course this needs to be changed when HIGHEST_PROTOCOL changes.
-        self.assertEqual(pickle.HIGHEST_PROTOCOL, 4)
+        self.assertEqual(pickle.HIGHEST_PROTOCOL, 5)
 
     def test_callapi(self):
         f = io.BytesIO()
@@ -3,6 +3,7 @@
 import ast
 import builtins
 import collections
+import functools
 import io
 import locale
 import os
@@ -892,6 +893,26 @@ class BuiltinTest(unittest.TestCase):
         self.assertEqual(max(data, key=f),
                          sorted(reversed(data), key=f)[-1])
 
+    def test_fastcall_argument_passing(self):
+        # METH_FASTCALL builtins must behave the same whether they are
+        # called directly or through the generic tuple-based call path
+        d = {'a': 1}
+        for func, args in ((getattr, (sys, 'nope', 42)),
+                           (min, (3, 1, 2)),
+                           (max, ([3, 1, 2],)),
+                           (divmod, (7, 2)),
+                           (d.get, ('a',)),
+                           (d.get, ('b', 2)),
+                           (d.setdefault, ('a', 3))):
+            expected = func(*args)
+            self.assertEqual(func(*args, **{}), expected)
+            self.assertEqual(functools.partial(func, *args)(), expected)
+        self.assertEqual(min(3, 1, 2, **{'key': neg}), 3)
+        self.assertRaises(TypeError, d.get)
+        self.assertRaises(TypeError, d.get, 'a', 1, 2)
+        self.assertRaises(TypeError, d.get, key='a')
+        self.assertRaises(TypeError, divmod, 1, y=2)
+
     def test_min(self):
         self.assertEqual(min('123123'), '1')
         self.assertEqual(min(1, 2, 3), 1)
@@ -358,6 +358,15 @@ class BaseBytesTest:
         self.assertEqual(b.count(i, 1, 3), 1)
         self.assertEqual(b.count(p, 7, 9), 1)
 
+        # matches around the 16 byte blocks of the vectorized search
+        for n in range(40):
+            b = self.type2test(b'a' * n + b'_' + b'a' * (40 - n))
+            self.assertEqual(b.count(b'a'), 40)
+            self.assertEqual(b.count(b'aa'), n // 2 + (40 - n) // 2)
+            self.assertEqual(b.count(b'a' * n + b'_'), 1)
+            self.assertEqual(b.find(b'_a'), n)
+            self.assertEqual(b.find(b'aaa_'), n - 3 if n >= 3 else -1)
+
     def test_startswith(self):
         b = self.type2test(b'hello')
         self.assertFalse(self.type2test().startswith(b"anything"))
@@ -568,5 +568,55 @@ class ClassTests(unittest.TestCase):
         a = A(hash(A.f)^(-1))
         hash(a.f)
 
+    def testInstanceAttributeCache(self):
+        # LOAD_ATTR caches where instance attributes live in split-table
+        # dicts; make sure every kind of change is still observed.
+        class A:
+            def __init__(self, x):
+                self.x = x
+        class B:
+            def __init__(self, x):
+                self.x = x
+
+        def get_x(obj):
+            return obj.x
+
+        a = A(1)
+        for i in range(3):
+            self.assertEqual(get_x(a), 1)
+        a.x = 2
+        self.assertEqual(get_x(a), 2)
+        self.assertEqual(get_x(A(3)), 3)
+        # Different type at the same site
+        self.assertEqual(get_x(B(4)), 4)
+        self.assertEqual(get_x(a), 2)
+        # Attribute deleted from the instance
+        del a.x
+        self.assertRaises(AttributeError, get_x, a)
+        a.x = 5
+        self.assertEqual(get_x(a), 5)
+        # Instance dict converted to a combined table
+        a.__dict__[1] = 1
+        self.assertEqual(get_x(a), 5)
+        # __class__ assignment
+        b = B(6)
+        self.assertEqual(get_x(b), 6)
+        b.__class__ = A
+        self.assertEqual(get_x(b), 6)
+        # A data descriptor added to the type takes precedence
+        a = A(7)
+        self.assertEqual(get_x(a), 7)
+        A.x = property(lambda self: 8)
+        self.assertEqual(get_x(a), 8)
+        del A.x
+        self.assertEqual(get_x(a), 7)
+        # Same for a base class of the type
+        class C(A):
+            pass
+        c = C(9)
+        self.assertEqual(get_x(c), 9)
+        A.x = property(lambda self: 10)
+        self.assertEqual(get_x(c), 10)
+
 if __name__ == '__main__':
     unittest.main()
@@ -470,6 +470,13 @@ class CommandLineTests(unittest.TestCase):
         for file in files:
             self.assertCompiled(file)
 
+    def test_index(self):
+        self.assertRunOK('-q', '--index', self.directory)
+        self.assertCompiled(self.barfn)
+        index = os.path.join(self.directory, '__pycache__',
+                             importlib._bootstrap_external._index_name())
+        self.assertTrue(os.path.exists(index))
+
     @mock.patch('compileall.compile_dir')
     def test_workers_available_cores(self, compile_dir):
         with mock.patch("sys.argv",
@@ -937,6 +937,66 @@ class DictTest(unittest.TestCase):
                 d.popitem()
         self.check_reentrant_insertion(mutate)
 
+    @support.cpython_only
+    def test_insertion_order(self):
+        # The combined table keeps entries in insertion order, across
+        # deletions and resizes.
+        d = {}
+        keys = [str(i) for i in range(100)]
+        for k in keys:
+            d[k] = k
+        for k in keys[::3]:
+            del d[k]
+        expected = [k for k in keys if k not in keys[::3]]
+        self.assertEqual(list(d), expected)
+        for k in keys[::3]:
+            d[k] = k
+        expected += keys[::3]
+        self.assertEqual(list(d), expected)
+        self.assertEqual(list(d.values()), expected)
+        self.assertEqual([k for k, v in d.items()], expected)
+        self.assertEqual(list(d.copy()), expected)
+
+        d = {}
+        for i in range(1000):
+            d[i] = i
+            if i % 2:
+                del d[i - 1]
+        self.assertEqual(list(d), list(range(1, 1000, 2)))
+
+    @support.cpython_only
+    def test_popitem_lifo(self):
+        d = dict.fromkeys('abcdef')
+        del d['c']
+        self.assertEqual(d.popitem(), ('f', None))
+        self.assertEqual(d.popitem(), ('e', None))
+        self.assertEqual(d.popitem(), ('d', None))
+        d['g'] = 1
+        self.assertEqual(list(d), ['a', 'b', 'g'])
+
+    @support.cpython_only
+    def test_split_table_order(self):
+        class C:
+            pass
+        a = C()
+        a.x, a.y, a.z = 1, 2, 3
+        b = C()
+        b.x, b.y = 4, 5
+        self.assertEqual(list(a.__dict__), ['x', 'y', 'z'])
+        self.assertEqual(list(b.__dict__), ['x', 'y'])
+        # Setting attributes out of the shared order must not reorder
+        # this instance (or any other).
+        c = C()
+        c.y = 6
+        c.x = 7
+        self.assertEqual(list(c.__dict__), ['y', 'x'])
+        del a.y
+        self.assertEqual(list(a.__dict__), ['x', 'z'])
+        a.y = 8
+        self.assertEqual(list(a.__dict__), ['x', 'z', 'y'])
+        self.assertEqual(list(b.__dict__), ['x', 'y'])
+        self.assertEqual(a.__dict__, {'x': 1, 'z': 3, 'y': 8})
+
 
 from test import mapping_tests
 
@@ -36,7 +36,7 @@ dis_c_instance_method = """\
               6 COMPARE_OP               2 (==)
               9 LOAD_FAST                0 (self)
              12 STORE_ATTR               0 (x)
-             15 LOAD_CONST               0 (None)
+             15 LOAD_CONST__RETURN_VALUE     0 (None)
              18 RETURN_VALUE
 """ % (_C.__init__.__code__.co_firstlineno + 1,)
 
@@ -46,7 +46,7 @@ dis_c_instance_method_bytes = """\
           6 COMPARE_OP               2 (==)
           9 LOAD_FAST                0 (0)
          12 STORE_ATTR               0 (0)
-         15 LOAD_CONST               0 (0)
+         15 LOAD_CONST__RETURN_VALUE     0 (0)
          18 RETURN_VALUE
 """
 
@@ -60,7 +60,7 @@ dis_f = """\
               6 CALL_FUNCTION            1 (1 positional, 0 keyword pair)
               9 POP_TOP
 
- %-4d        10 LOAD_CONST               1 (1)
+ %-4d        10 LOAD_CONST__RETURN_VALUE     1 (1)
              13 RETURN_VALUE
 """ % (_f.__code__.co_firstlineno + 1,
        _f.__code__.co_firstlineno + 2)
@@ -71,7 +71,7 @@ dis_f_co_code = """\
           3 LOAD_FAST                0 (0)
           6 CALL_FUNCTION            1 (1 positional, 0 keyword pair)
           9 POP_TOP
-         10 LOAD_CONST               1 (1)
+         10 LOAD_CONST__RETURN_VALUE     1 (1)
          13 RETURN_VALUE
 """
 
@@ -94,7 +94,7 @@ dis_bug708901 = """\
 
  %-4d        22 JUMP_ABSOLUTE           16
         >>   25 POP_BLOCK
-        >>   26 LOAD_CONST               0 (None)
+        >>   26 LOAD_CONST__RETURN_VALUE     0 (None)
              29 RETURN_VALUE
 """ % (bug708901.__code__.co_firstlineno + 1,
        bug708901.__code__.co_firstlineno + 2,
@@ -122,7 +122,7 @@ dis_bug1333982 = """\
              29 CALL_FUNCTION            1 (1 positional, 0 keyword pair)
              32 RAISE_VARARGS            1
 
-%3d     >>   35 LOAD_CONST               0 (None)
+%3d     >>   35 LOAD_CONST__RETURN_VALUE     0 (None)
              38 RETURN_VALUE
 """ % (bug1333982.__code__.co_firstlineno + 1,
        __file__,
@@ -133,17 +133,17 @@ dis_bug1333982 = """\
 _BIG_LINENO_FORMAT = """\
 %3d           0 LOAD_GLOBAL              0 (spam)
               3 POP_TOP
-              4 LOAD_CONST               0 (None)
+              4 %s     0 (None)
               7 RETURN_VALUE
 """
 
 dis_module_expected_results = """\
 Disassembly of f:
-  4           0 LOAD_CONST               0 (None)
+  4           0 LOAD_CONST__RETURN_VALUE     0 (None)
               3 RETURN_VALUE
 
 Disassembly of g:
-  5           0 LOAD_CONST               0 (None)
+  5           0 LOAD_CONST__RETURN_VALUE     0 (None)
               3 RETURN_VALUE
 
 """
@@ -164,7 +164,7 @@ dis_simple_stmt_str = """\
               3 LOAD_CONST               0 (1)
               6 BINARY_ADD
               7 STORE_NAME               0 (x)
-             10 LOAD_CONST               1 (None)
+             10 LOAD_CONST__RETURN_VALUE     1 (None)
              13 RETURN_VALUE
 """
 
@@ -186,7 +186,7 @@ dis_compound_stmt_str = """\
              16 STORE_NAME               0 (x)
              19 JUMP_ABSOLUTE            9
              22 POP_BLOCK
-        >>   23 LOAD_CONST               2 (None)
+        >>   23 LOAD_CONST__RETURN_VALUE     2 (None)
              26 RETURN_VALUE
 """
 
@@ -202,14 +202,14 @@ dis_traceback = """\
 
  %-4d   >>   15 DUP_TOP
              16 LOAD_GLOBAL              0 (Exception)
-             19 COMPARE_OP              10 (exception match)
+             19 COMPARE_OP__POP_JUMP_IF_FALSE    10 (exception match)
              22 POP_JUMP_IF_FALSE       60
              25 POP_TOP
              26 STORE_FAST               0 (e)
              29 POP_TOP
              30 SETUP_FINALLY           14 (to 47)
 
- %-4d        33 LOAD_FAST                0 (e)
+ %-4d        33 LOAD_FAST__LOAD_ATTR     0 (e)
              36 LOAD_ATTR                1 (__traceback__)
              39 STORE_FAST               1 (tb)
              42 POP_BLOCK
@@ -291,13 +291,17 @@ class DisTests(unittest.TestCase):
             return namespace['foo']
 
         # Test all small ranges
+        # (the peephole optimizer skips line gaps of 255 and more, so the
+        # superinstruction only appears for the smaller ones)
         for i in range(1, 300):
-            expected = _BIG_LINENO_FORMAT % (i + 2)
+            opname = ('LOAD_CONST__RETURN_VALUE' if i < 254 else
+                      'LOAD_CONST          ')
+            expected = _BIG_LINENO_FORMAT % (i + 2, opname)
             self.do_disassembly_test(func(i), expected)
 
         # Test some larger ranges too
         for i in range(300, 5000, 10):
-            expected = _BIG_LINENO_FORMAT % (i + 2)
+            expected = _BIG_LINENO_FORMAT % (i + 2, 'LOAD_CONST          ')
             self.do_disassembly_test(func(i), expected)
 
         from test import dis_module
@@ -653,11 +657,11 @@ expected_opinfo_inner = [
   Instruction(opname='LOAD_DEREF', opcode=136, arg=1, argval='b', argrepr='b', offset=6, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_DEREF', opcode=136, arg=2, argval='c', argrepr='c', offset=9, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_DEREF', opcode=136, arg=3, argval='d', argrepr='d', offset=12, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='e', argrepr='e', offset=15, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_FAST__LOAD_FAST', opcode=155, arg=0, argval='e', argrepr='e', offset=15, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=1, argval='f', argrepr='f', offset=18, starts_line=None, is_jump_target=False),
   Instruction(opname='CALL_FUNCTION', opcode=131, arg=6, argval=6, argrepr='6 positional, 0 keyword pair', offset=21, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=24, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=25, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN_VALUE', opcode=158, arg=0, argval=None, argrepr='None', offset=25, starts_line=None, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=28, starts_line=None, is_jump_target=False),
 ]
 
@@ -675,12 +679,12 @@ expected_opinfo_jumpy = [
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=28, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=29, starts_line=5, is_jump_target=False),
   Instruction(opname='LOAD_CONST', opcode=100, arg=2, argval=4, argrepr='4', offset=32, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=0, argval='<', argrepr='<', offset=35, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_OP__POP_JUMP_IF_FALSE', opcode=157, arg=0, argval='<', argrepr='<', offset=35, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=44, argval=44, argrepr='', offset=38, starts_line=None, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=13, argval=13, argrepr='', offset=41, starts_line=6, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=44, starts_line=7, is_jump_target=True),
   Instruction(opname='LOAD_CONST', opcode=100, arg=3, argval=6, argrepr='6', offset=47, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=4, argval='>', argrepr='>', offset=50, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_OP__POP_JUMP_IF_FALSE', opcode=157, arg=4, argval='>', argrepr='>', offset=50, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=13, argval=13, argrepr='', offset=53, starts_line=None, is_jump_target=False),
   Instruction(opname='BREAK_LOOP', opcode=80, arg=None, argval=None, argrepr='', offset=56, starts_line=8, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=13, argval=13, argrepr='', offset=57, starts_line=None, is_jump_target=False),
@@ -702,12 +706,12 @@ expected_opinfo_jumpy = [
   Instruction(opname='STORE_FAST', opcode=125, arg=0, argval='i', argrepr='i', offset=97, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=100, starts_line=14, is_jump_target=False),
   Instruction(opname='LOAD_CONST', opcode=100, arg=3, argval=6, argrepr='6', offset=103, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=4, argval='>', argrepr='>', offset=106, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_OP__POP_JUMP_IF_FALSE', opcode=157, arg=4, argval='>', argrepr='>', offset=106, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=115, argval=115, argrepr='', offset=109, starts_line=None, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=74, argval=74, argrepr='', offset=112, starts_line=15, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=115, starts_line=16, is_jump_target=True),
   Instruction(opname='LOAD_CONST', opcode=100, arg=2, argval=4, argrepr='4', offset=118, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=0, argval='<', argrepr='<', offset=121, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_OP__POP_JUMP_IF_FALSE', opcode=157, arg=0, argval='<', argrepr='<', offset=121, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=74, argval=74, argrepr='', offset=124, starts_line=None, is_jump_target=False),
   Instruction(opname='BREAK_LOOP', opcode=80, arg=None, argval=None, argrepr='', offset=127, starts_line=17, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=74, argval=74, argrepr='', offset=128, starts_line=None, is_jump_target=False),
@@ -726,7 +730,7 @@ expected_opinfo_jumpy = [
   Instruction(opname='JUMP_FORWARD', opcode=110, arg=28, argval=188, argrepr='to 188', offset=157, starts_line=None, is_jump_target=False),
   Instruction(opname='DUP_TOP', opcode=4, arg=None, argval=None, argrepr='', offset=160, starts_line=22, is_jump_target=True),
   Instruction(opname='LOAD_GLOBAL', opcode=116, arg=2, argval='ZeroDivisionError', argrepr='ZeroDivisionError', offset=161, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=10, argval='exception match', argrepr='exception match', offset=164, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_OP__POP_JUMP_IF_FALSE', opcode=157, arg=10, argval='exception match', argrepr='exception match', offset=164, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=187, argval=187, argrepr='', offset=167, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=170, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=171, starts_line=None, is_jump_target=False),
@@ -757,14 +761,14 @@ expected_opinfo_jumpy = [
   Instruction(opname='CALL_FUNCTION', opcode=131, arg=1, argval=1, argrepr='1 positional, 0 keyword pair', offset=224, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=227, starts_line=None, is_jump_target=False),
   Instruction(opname='END_FINALLY', opcode=88, arg=None, argval=None, argrepr='', offset=228, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=229, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN_VALUE', opcode=158, arg=0, argval=None, argrepr='None', offset=229, starts_line=None, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=232, starts_line=None, is_jump_target=False),
 ]
 
 # One last piece of inspect fodder to check the default line number handling
 def simple(): pass
 expected_opinfo_simple = [
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=0, starts_line=simple.__code__.co_firstlineno, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN_VALUE', opcode=158, arg=0, argval=None, argrepr='None', offset=0, starts_line=simple.__code__.co_firstlineno, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=3, starts_line=None, is_jump_target=False)
 ]
 
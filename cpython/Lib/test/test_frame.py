@@ -161,5 +161,61 @@ class FrameLocalsTest(unittest.TestCase):
         self.assertEqual(inner.f_locals, {})
 
 
+class FrameLifetimeTest(unittest.TestCase):
+    """
+    Tests for frames that outlive the call that created them.
+    """
+
+    def capture(self, depth):
+        # Return the frames of a recursion of the given depth, innermost
+        # first, keeping every one of them alive.
+        if depth == 0:
+            frames = []
+            f = sys._getframe()
+            while f.f_code is self.capture.__code__:
+                frames.append(f)
+                f = f.f_back
+            return frames
+        big = [depth] * 10
+        return self.capture(depth - 1)
+
+    def test_escaped_frames(self):
+        frames = self.capture(500)
+        self.assertEqual(len(frames), 501)
+        # Release the frames out of order while making new calls
+        self.assertEqual([f.f_locals['depth'] for f in frames],
+                         list(range(501)))
+        del frames[::2]
+        self.assertEqual(len(self.capture(50)), 51)
+        for i, f in enumerate(frames):
+            self.assertEqual(f.f_locals['depth'], 2 * i + 1)
+        del frames[:]
+        self.assertEqual(len(self.capture(10)), 11)
+
+    def test_large_frame(self):
+        # A frame too big for the frame arena
+        ns = {}
+        names = ['v%d' % i for i in range(5000)]
+        exec('def f():\n    %s = 0\n    return sys._getframe()' %
+             ' = '.join(names), {'sys': sys}, ns)
+        frame = ns['f']()
+        self.assertEqual(frame.f_locals['v4999'], 0)
+
+    def test_frames_outlive_thread(self):
+        threading = support.import_module('threading')
+        results = []
+        def worker():
+            results.append(self.capture(100))
+        t = threading.Thread(target=worker)
+        t.start()
+        t.join()
+        frames, = results
+        self.assertEqual(len(frames), 101)
+        self.assertEqual([f.f_locals['depth'] for f in frames],
+                         list(range(101)))
+        del frames[:]
+        support.gc_collect()
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -1,9 +1,10 @@
 import unittest
 from test.support import (verbose, refcount_test, run_unittest,
                             strip_python_stderr, cpython_only, start_threads,
-                            temp_dir)
+                            temp_dir, import_module)
 from test.support.script_helper import assert_python_ok, make_script
 
+import os
 import sys
 import time
 import gc
@@ -567,12 +568,103 @@ class GCTests(unittest.TestCase):
         self.assertTrue(gc.is_tracked(UserClass))
         self.assertTrue(gc.is_tracked(UserClass()))
         self.assertTrue(gc.is_tracked(UserInt()))
-        self.assertTrue(gc.is_tracked([]))
-        self.assertTrue(gc.is_tracked(set()))
+        self.assertTrue(gc.is_tracked([[]]))
+        self.assertTrue(gc.is_tracked({UserClass}))
         self.assertFalse(gc.is_tracked(UserClassSlots()))
         self.assertFalse(gc.is_tracked(UserFloatSlots()))
         self.assertFalse(gc.is_tracked(UserIntSlots()))
 
+    def test_untrack_at_creation(self):
+        # Containers built from atomic objects are not tracked, and become
+        # tracked when a container is stored in them.
+        class C:
+            pass
+        self.assertFalse(gc.is_tracked((1, "a")))
+        self.assertTrue(gc.is_tracked((1, C())))
+        self.assertFalse(gc.is_tracked([]))
+        self.assertFalse(gc.is_tracked([1, "a", (2.5, None)]))
+        self.assertFalse(gc.is_tracked(list(range(3))))
+        self.assertFalse(gc.is_tracked([i for i in range(3)]))
+        self.assertFalse(gc.is_tracked(set()))
+        self.assertFalse(gc.is_tracked({1, "a"}))
+        self.assertFalse(gc.is_tracked(frozenset([1, 2])))
+        self.assertTrue(gc.is_tracked([C()]))
+        self.assertTrue(gc.is_tracked({C()}))
+        # subclasses are always tracked
+        class L(list):
+            pass
+        self.assertTrue(gc.is_tracked(L()))
+
+        x = [1, 2]
+        self.assertFalse(gc.is_tracked(x[:1]))
+        self.assertFalse(gc.is_tracked(x + x))
+        self.assertFalse(gc.is_tracked(x * 2))
+        for store in (lambda l, o: l.append(o),
+                      lambda l, o: l.insert(0, o),
+                      lambda l, o: l.extend([o]),
+                      lambda l, o: l.extend(iter([o])),
+                      lambda l, o: l.__setitem__(0, o),
+                      lambda l, o: l.__setitem__(slice(0, 1), [o]),
+                      lambda l, o: l.__setitem__(slice(None, None, 2), [o]),
+                      lambda l, o: l.__iadd__([o])):
+            l = [1, 2]
+            store(l, 3)
+            self.assertFalse(gc.is_tracked(l))
+            store(l, [])
+            self.assertTrue(gc.is_tracked(l))
+            self.assertTrue(gc.is_tracked(l[:]))
+        for store in (lambda s, o: s.add(o),
+                      lambda s, o: s.update([o]),
+                      lambda s, o: s.__ior__({o}),
+                      lambda s, o: s.__ixor__({o}),
+                      lambda s, o: s.symmetric_difference_update([o])):
+            s = {1, 2}
+            store(s, 3.5)
+            self.assertFalse(gc.is_tracked(s))
+            store(s, C)
+            self.assertTrue(gc.is_tracked(s))
+        s = {1}
+        s.update({C})
+        self.assertTrue(gc.is_tracked(s))
+        s = set()
+        s.update({C})
+        self.assertTrue(gc.is_tracked(s))
+        s = {1}
+        s.intersection_update({1, C})
+        self.assertFalse(gc.is_tracked(s))
+        s = {C, 1}
+        s.intersection_update({1})
+        self.assertTrue(gc.is_tracked(s))
+
+        # a cycle through a list that became tracked is collected
+        l = []
+        l.append(l)
+        c = C()
+        wr = weakref.ref(c)
+        l.append(c)
+        del l, c
+        gc.collect()
+        self.assertIsNone(wr())
+
+    def test_untracked_list_c_setitem(self):
+        # PyList_SetItem() tracks an untracked list again, so that a cycle
+        # made through it from C is collected.
+        _testcapi = import_module('_testcapi')
+        class C:
+            pass
+        l = [1, 2]
+        self.assertFalse(gc.is_tracked(l))
+        _testcapi.list_setitem(l, 0, 3)
+        self.assertFalse(gc.is_tracked(l))
+        c = C()
+        c.l = l
+        wr = weakref.ref(c)
+        _testcapi.list_setitem(l, 1, c)
+        self.assertTrue(gc.is_tracked(l))
+        del l, c
+        gc.collect()
+        self.assertIsNone(wr())
+
     def test_bug1055820b(self):
         # Corresponds to temp2b.py in the bug report.
 
@@ -720,10 +812,16 @@ class GCTests(unittest.TestCase):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "increments", "pauses", "pause_total",
+                              "pause_max"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["increments"], 0)
+            self.assertIsInstance(st["pauses"], tuple)
+            self.assertGreaterEqual(st["pause_total"], st["pause_max"])
+            self.assertGreaterEqual(st["pause_max"], 0)
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -734,12 +832,180 @@ class GCTests(unittest.TestCase):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"])
+        self.assertEqual(sum(new[0]["pauses"]), sum(old[0]["pauses"]) + 1)
+        self.assertEqual(new[1]["pauses"], old[1]["pauses"])
         gc.collect(2)
         new = gc.get_stats()
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
 
+    def test_set_policy(self):
+        self.assertEqual(gc.get_policy(), "fixed")
+        self.addCleanup(gc.set_policy, "fixed")
+        gc.set_policy("adaptive")
+        self.assertEqual(gc.get_policy(), "adaptive")
+        self.assertRaises(ValueError, gc.set_policy, "eager")
+        self.assertRaises(TypeError, gc.set_policy, 1)
+        self.assertEqual(gc.get_policy(), "adaptive")
+
+    def test_set_incremental(self):
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        gc.set_incremental(1000)
+        self.assertEqual(gc.get_incremental(), (1000, 0.0))
+        gc.set_incremental(0, 0.001)
+        self.assertEqual(gc.get_incremental(), (0, 0.001))
+        gc.set_incremental(0)
+        self.assertEqual(gc.get_incremental(), (0, 0.0))
+        self.assertRaises(ValueError, gc.set_incremental, -1)
+        self.assertRaises(ValueError, gc.set_incremental, 0, -1.0)
+        self.assertRaises(TypeError, gc.set_incremental, 0, "1")
+
+    def test_incremental_collection(self):
+        # Cyclic garbage in the oldest generation is collected by the
+        # increments run after the young collections.
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        if not gc.isenabled():
+            self.addCleanup(gc.disable)
+        else:
+            self.addCleanup(gc.enable)
+        gc.disable()
+        gc.collect()
+        a = C1055820(0)
+        wr = weakref.ref(a)
+        holder = [a]
+        del a
+        gc.collect(1)
+        del holder
+        old = gc.get_stats()[2]
+        gc.set_threshold(100, 1, 1)
+        gc.set_incremental(1000)
+        gc.enable()
+        objects = []
+        for i in range(10**6):
+            objects.append(C1055820(i))
+            if wr() is None:
+                break
+        gc.disable()
+        self.assertIsNone(wr())
+        new = gc.get_stats()[2]
+        self.assertGreater(new["increments"], old["increments"])
+        # the objects visited by the pass are still found
+        ids = set(map(id, gc.get_objects()))
+        self.assertTrue(all(id(o) in ids for o in objects))
+
+    def test_incremental_disabled_by_finalizer(self):
+        # A finalizer run by an increment disables incremental collection.
+        # The pass ends once the increment is done, so the object the
+        # finalizer resurrects isn't left behind in the visited objects.
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        if not gc.isenabled():
+            self.addCleanup(gc.disable)
+        else:
+            self.addCleanup(gc.enable)
+        gc.disable()
+        gc.collect()
+        resurrected = []
+        class Disabler:
+            def __del__(self):
+                gc.set_incremental(0)
+                resurrected.append(self)
+                # weakrefs to self were cleared before the finalizer ran
+                self.marker = C1055820(0)
+                resurrected.append(weakref.ref(self.marker))
+        a = Disabler()
+        a.cycle = a
+        holder = [a]
+        del a
+        gc.collect(1)
+        del holder
+        gc.set_threshold(100, 1, 1)
+        gc.set_incremental(1000)
+        gc.enable()
+        objects = []
+        for i in range(10**6):
+            objects.append(C1055820(i))
+            if resurrected:
+                break
+        gc.disable()
+        self.assertEqual(gc.get_incremental(), (0, 0.0))
+        wr = resurrected.pop()
+        del resurrected[:]
+        gc.collect()
+        self.assertIsNone(wr())
+
+    def test_set_parallel(self):
+        self.addCleanup(gc.set_parallel, gc.get_parallel())
+        self.assertEqual(gc.get_parallel(), 1)
+        gc.set_parallel(1)
+        self.assertEqual(gc.get_parallel(), 1)
+        self.assertRaises(ValueError, gc.set_parallel, 0)
+        try:
+            gc.set_parallel(4)
+        except ValueError:
+            self.skipTest("parallel collection is not supported")
+        self.assertEqual(gc.get_parallel(), 4)
+        # shrinking and growing the pool of threads
+        for threads in (2, 4, 1, 3):
+            gc.set_parallel(threads)
+            self.assertEqual(gc.get_parallel(), threads)
+            gc.collect()
+
+    @unittest.skipUnless(threading, "requires threading")
+    def test_parallel_collection(self):
+        try:
+            gc.set_parallel(4)
+        except ValueError:
+            self.skipTest("parallel collection is not supported")
+        self.addCleanup(gc.set_parallel, 1)
+        # enough objects for the collection to be parallel
+        live = [C1055820(i) for i in range(70000)]
+        live.append(live)
+        gc.collect()
+        wrs = []
+        for i in range(1000):
+            a = C1055820(i)
+            wrs.append(weakref.ref(a))
+            b = C1055820(i)
+            b.other = a
+            a.other = b
+        del a, b
+        t = tuple(range(3))
+        gc.collect()
+        self.assertTrue(all(wr() is None for wr in wrs))
+        self.assertIs(live[-1], live)
+        self.assertEqual(sum(x.i for x in live[:-1]), sum(range(70000)))
+        self.assertFalse(gc.is_tracked(t))
+
+    @unittest.skipUnless(threading, "requires threading")
+    @unittest.skipUnless(hasattr(os, 'fork'), "requires os.fork()")
+    def test_parallel_collection_after_fork(self):
+        # The child has none of the threads of the parent.
+        code = """if 1:
+            import gc, os
+            try:
+                gc.set_parallel(4)
+            except ValueError:
+                pass
+            class C:
+                pass
+            live = [C() for i in range(70000)]
+            gc.collect()
+            pid = os.fork()
+            if pid == 0:
+                live.append(live)
+                gc.collect()
+                gc.set_parallel(2)
+                gc.collect()
+                os._exit(0)
+            pid, status = os.waitpid(pid, 0)
+            assert status == 0, status
+            gc.collect()
+            """
+        assert_python_ok('-c', code)
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -818,6 +1084,45 @@ class GCCallbackTests(unittest.TestCase):
             self.assertTrue("generation" in info)
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
+            self.assertEqual(info["threshold"], gc.get_threshold()[2])
+            self.assertIsNone(info["decision"])
+
+    def test_adaptive_policy(self):
+        self.preclean()
+        self.addCleanup(gc.set_policy, gc.get_policy())
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        gc.set_threshold(100, 10, 10)
+        gc.set_policy("adaptive")
+        self.assertEqual(gc.get_policy(), "adaptive")
+        gc.enable()
+        try:
+            # containers that all survive make the young collections useless
+            live = [[i] for i in range(20000)]
+        finally:
+            gc.disable()
+        stops = [v[2] for v in self.visit
+                 if v[1] == "stop" and v[2]["generation"] == 0]
+        self.assertTrue(stops)
+        for info in stops:
+            self.assertIn(info["decision"], ("raise", "lower", "keep"))
+        self.assertEqual(stops[0]["decision"], "raise")
+        self.assertGreater(stops[-1]["threshold"], 100)
+        self.assertEqual(gc.get_threshold(), (100, 10, 10))
+        # the fixed policy goes back to the thresholds that were set
+        gc.set_policy("fixed")
+        self.assertEqual(gc.get_policy(), "fixed")
+        del self.visit[:]
+        gc.enable()
+        try:
+            live += [[i] for i in range(1000)]
+        finally:
+            gc.disable()
+        stops = [v[2] for v in self.visit
+                 if v[1] == "stop" and v[2]["generation"] == 0]
+        self.assertTrue(stops)
+        for info in stops:
+            self.assertIsNone(info["decision"])
+            self.assertEqual(info["threshold"], 100)
 
     def test_collect_generation(self):
         self.preclean()
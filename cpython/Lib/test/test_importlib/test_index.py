@@ -0,0 +1,109 @@
+import compileall
+import _imp
+import os
+import tempfile
+import time
+from test import support
+from test.support.script_helper import assert_python_ok, make_script
+import unittest
+
+
+class ImportIndexTests(unittest.TestCase):
+
+    """Test the import indexes written by compileall.write_index()."""
+
+    def setUp(self):
+        self.path = tempfile.mkdtemp()
+        self.addCleanup(support.rmtree, self.path)
+        self.package = os.path.join(self.path, 'idxpkg')
+        os.mkdir(self.package)
+        make_script(self.path, 'idxmod', "value = 'module'")
+        make_script(self.package, '__init__', "value = 'package'")
+        make_script(self.package, 'submodule', "value = 'submodule'")
+
+    def write_index(self):
+        compileall.compile_dir(self.path, quiet=2)
+        self.assertTrue(compileall.write_index(self.path, quiet=2))
+
+    def run_index(self, code):
+        # PYTHONDONTWRITEBYTECODE keeps the bytecode files as compileall
+        # wrote them.
+        rc, out, err = assert_python_ok('-c', code, PYTHONPATH=self.path,
+                                        PYTHONDONTWRITEBYTECODE='1')
+        return out.decode().split()
+
+    def test_module(self):
+        self.write_index()
+        code = ('import idxmod; '
+                'print(idxmod.value, type(idxmod.__loader__).__name__)')
+        self.assertEqual(self.run_index(code),
+                         ['module', '_IndexedSourceFileLoader'])
+
+    def test_package(self):
+        self.write_index()
+        code = ('import idxpkg.submodule; '
+                'print(idxpkg.value, idxpkg.submodule.value, '
+                'type(idxpkg.__loader__).__name__, '
+                'type(idxpkg.submodule.__loader__).__name__)')
+        self.assertEqual(self.run_index(code),
+                         ['package', 'submodule', '_IndexedSourceFileLoader',
+                          '_IndexedSourceFileLoader'])
+
+    def test_no_index(self):
+        compileall.compile_dir(self.path, quiet=2)
+        code = ('import idxmod; '
+                'print(idxmod.value, type(idxmod.__loader__).__name__)')
+        self.assertEqual(self.run_index(code), ['module', 'SourceFileLoader'])
+
+    def test_new_module(self):
+        # Modules added after the index is written are found by listing the
+        # directory, whose modification time changed.
+        self.write_index()
+        mtime = os.stat(self.path).st_mtime
+        make_script(self.path, 'idxnew', "value = 'new'")
+        os.utime(self.path, (mtime + 10, mtime + 10))
+        self.assertEqual(self.run_index('import idxnew; print(idxnew.value)'),
+                         ['new'])
+
+    def test_changed_source(self):
+        # The bytecode in the index is only used while it matches the source.
+        self.write_index()
+        path = os.path.join(self.path, 'idxmod.py')
+        with open(path, 'w') as file:
+            file.write("value = 'changed'\n")
+        mtime = time.time() + 10
+        os.utime(path, (mtime, mtime))
+        self.assertEqual(self.run_index('import idxmod; print(idxmod.value)'),
+                         ['changed'])
+
+    def test_bad_index(self):
+        self.write_index()
+        name = [name for name in os.listdir(os.path.join(self.path,
+                                                         '__pycache__'))
+                if name.startswith('__index__.')][0]
+        with open(os.path.join(self.path, '__pycache__', name), 'r+b') as file:
+            file.write(b'XXXX')
+        code = ('import idxmod; '
+                'print(idxmod.value, type(idxmod.__loader__).__name__)')
+        self.assertEqual(self.run_index(code), ['module', 'SourceFileLoader'])
+
+    def test_map_empty_file(self):
+        path = os.path.join(self.path, 'empty')
+        with open(path, 'wb') as file:
+            pass
+        with open(path, 'rb') as file:
+            with self.assertRaises(ValueError):
+                _imp._map_file(file.fileno())
+
+    def test_map_file(self):
+        path = os.path.join(self.path, 'idxmod.py')
+        with open(path, 'rb') as file:
+            try:
+                data = _imp._map_file(file.fileno())
+            except NotImplementedError:
+                self.skipTest('mmap() is not available')
+            self.assertEqual(bytes(memoryview(data)), file.read())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,6 +1,7 @@
 import importlib
 from importlib import abc
 from importlib import util
+from test.support.script_helper import assert_python_ok
 import unittest
 
 from . import util as test_util
@@ -128,5 +129,53 @@ class LazyLoaderTests(unittest.TestCase):
                 module.__name__
 
 
+class LazyImportOptionTests(unittest.TestCase):
+
+    """Test the -X lazy_import command line option."""
+
+    def check(self, options, code, expected):
+        rc, out, err = assert_python_ok(*options, '-c', code)
+        self.assertEqual(out.decode().split(), expected)
+
+    def test_not_enabled(self):
+        self.check([], 'import colorsys; print(type(colorsys).__name__)',
+                   ['module'])
+
+    def test_all_modules(self):
+        code = ('import colorsys, json; '
+                'print(type(colorsys).__name__, type(json).__name__)')
+        self.check(['-X', 'lazy_import'], code,
+                   ['_LazyModule', '_LazyModule'])
+
+    def test_named_modules(self):
+        code = ('import colorsys, tabnanny; '
+                'print(type(colorsys).__name__, type(tabnanny).__name__)')
+        self.check(['-X', 'lazy_import=colorsys'], code,
+                   ['_LazyModule', 'module'])
+
+    def test_submodules(self):
+        # Naming a package also makes its submodules lazy.
+        code = ('import email.message; '
+                'print(type(email.message).__name__)')
+        self.check(['-X', 'lazy_import=email'], code, ['_LazyModule'])
+
+    def test_reimport_stays_lazy(self):
+        code = ('import colorsys; import colorsys; '
+                'print(type(colorsys).__name__)')
+        self.check(['-X', 'lazy_import=colorsys'], code, ['_LazyModule'])
+
+    def test_attribute_access_loads(self):
+        code = ('import colorsys; colorsys.rgb_to_hsv; '
+                'print(type(colorsys).__name__, '
+                'type(colorsys.__loader__).__name__)')
+        self.check(['-X', 'lazy_import=colorsys'], code,
+                   ['_Module', 'SourceFileLoader'])
+
+    def test_run_module(self):
+        rc, out, err = assert_python_ok('-X', 'lazy_import', '-m', 'timeit',
+                                        '-n', '1', '-r', '1', 'pass')
+        self.assertIn(b'loop', out)
+
+
 if __name__ == '__main__':
     unittest.main()
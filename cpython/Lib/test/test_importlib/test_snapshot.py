@@ -0,0 +1,136 @@
+import importlib.util
+import marshal
+import os
+import stat
+import tempfile
+from test import support
+from test.support.script_helper import assert_python_ok, make_script
+import unittest
+
+
+class SnapshotTests(unittest.TestCase):
+
+    """Test the startup snapshots named by PYTHONSNAPSHOT."""
+
+    def setUp(self):
+        self.path = tempfile.mkdtemp()
+        self.addCleanup(support.rmtree, self.path)
+        self.snapshot = os.path.join(self.path, 'test.snapshot')
+
+    def write_snapshot(self, modules, magic=importlib.util.MAGIC_NUMBER):
+        """Write a snapshot of modules, a dict mapping module names to
+        (path, source code) pairs."""
+        entries = {}
+        for name, (path, source) in modules.items():
+            code = compile(source, path, 'exec')
+            st = os.stat(path)
+            entries[name] = (path, int(st.st_mtime), st.st_size,
+                             marshal.dumps(code))
+        with open(self.snapshot, 'wb') as file:
+            file.write(magic)
+            marshal.dump(entries, file)
+
+    def run_snapshot(self, code, **env_vars):
+        return assert_python_ok('-c', code, PYTHONSNAPSHOT=self.snapshot,
+                                PYTHONPATH=self.path, **env_vars)
+
+    def test_module(self):
+        # The snapshot is used instead of the file, but the module still
+        # refers to its file.
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        code = ('import snapmod; '
+                'print(snapmod.value, type(snapmod.__loader__).__name__, '
+                'snapmod.__file__)')
+        rc, out, err = self.run_snapshot(code)
+        self.assertEqual(out.decode().split(),
+                         ['snapshot', '_SnapshotLoader', path])
+
+    def test_reload(self):
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        code = ('import importlib, snapmod; importlib.reload(snapmod); '
+                'print(snapmod.value)')
+        rc, out, err = self.run_snapshot(code)
+        self.assertEqual(out.decode().split(), ['source'])
+
+    def test_package(self):
+        # Submodules missing from the snapshot are found on __path__.
+        package = os.path.join(self.path, 'snappkg')
+        os.mkdir(package)
+        path = make_script(package, '__init__', "value = 'snapshot'")
+        make_script(package, 'submodule', "value = 'source'")
+        self.write_snapshot({'snappkg': (path, "value = 'snapshot'")})
+        code = ('import snappkg.submodule; '
+                'print(snappkg.value, snappkg.submodule.value)')
+        rc, out, err = self.run_snapshot(code)
+        self.assertEqual(out.decode().split(), ['snapshot', 'source'])
+
+    def test_startup_modules(self):
+        # stat is imported by site at startup.
+        # Its path is the one found on sys.path, which site doesn't make
+        # absolute in __spec__.
+        path = stat.__spec__.origin
+        with open(path, encoding='utf-8') as file:
+            source = file.read() + "\nvalue = 'snapshot'\n"
+        self.write_snapshot({'stat': (path, source)})
+        rc, out, err = self.run_snapshot('import stat; print(stat.value)')
+        self.assertEqual(out.decode().split(), ['snapshot'])
+
+    def test_stale(self):
+        # A module file changed after the snapshot was written is imported
+        # from the file.
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        make_script(self.path, 'snapmod', "value = 'changed'")
+        rc, out, err = self.run_snapshot('import snapmod; print(snapmod.value)')
+        self.assertEqual(out.decode().split(), ['changed'])
+
+    def test_stale_mtime(self):
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        st = os.stat(path)
+        os.utime(path, (st.st_atime, st.st_mtime - 10))
+        rc, out, err = self.run_snapshot('import snapmod; print(snapmod.value)')
+        self.assertEqual(out.decode().split(), ['source'])
+
+    def test_shadowed(self):
+        # The module is found in a sys.path directory coming before the one
+        # of the snapshot.
+        other = os.path.join(self.path, 'other')
+        os.mkdir(other)
+        path = make_script(other, 'snapmod', "value = 'other'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        make_script(self.path, 'snapmod', "value = 'source'")
+        code = 'import snapmod; print(snapmod.value)'
+        rc, out, err = assert_python_ok(
+            '-c', code, PYTHONSNAPSHOT=self.snapshot,
+            PYTHONPATH=os.pathsep.join([self.path, other]))
+        self.assertEqual(out.decode().split(), ['source'])
+        # It is used once its directory comes first.
+        rc, out, err = assert_python_ok(
+            '-c', code, PYTHONSNAPSHOT=self.snapshot,
+            PYTHONPATH=os.pathsep.join([other, self.path]))
+        self.assertEqual(out.decode().split(), ['snapshot'])
+
+    def test_bad_magic(self):
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")},
+                            magic=b'\0\0\r\n')
+        rc, out, err = self.run_snapshot('import snapmod; print(snapmod.value)')
+        self.assertEqual(out.decode().split(), ['source'])
+        self.assertIn(b'PYTHONSNAPSHOT failed', err)
+        self.assertIn(b'bad magic number in snapshot', err)
+
+    def test_ignore_environment(self):
+        path = make_script(self.path, 'snapmod', "value = 'source'")
+        self.write_snapshot({'snapmod': (path, "value = 'snapshot'")})
+        code = ('import sys; sys.path.insert(0, {!r}); import snapmod; '
+                'print(snapmod.value)'.format(self.path))
+        rc, out, err = assert_python_ok('-E', '-c', code,
+                                        PYTHONSNAPSHOT=self.snapshot)
+        self.assertEqual(out.decode().split(), ['source'])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,7 +1,9 @@
 import decimal
+import gc
 from io import StringIO, BytesIO
 from collections import OrderedDict
 from test.test_json import PyTest, CTest
+from test.support import cpython_only
 
 
 class TestDecode:
@@ -20,6 +22,17 @@ class TestDecode:
         self.assertEqual(self.loads('[]'), [])
         self.assertEqual(self.loads('""'), "")
 
+    @cpython_only
+    def test_untracked_containers(self):
+        rval = self.loads('[[1, "a", null], {"k": [2.5]}, [[]]]')
+        self.assertTrue(gc.is_tracked(rval))
+        self.assertFalse(gc.is_tracked(rval[0]))
+        self.assertFalse(gc.is_tracked(rval[1]["k"]))
+        self.assertFalse(gc.is_tracked(rval[2][0]))
+        self.assertTrue(gc.is_tracked(rval[2]))
+        pairs = self.loads('{"a": 1}', object_pairs_hook=lambda x: x)
+        self.assertFalse(gc.is_tracked(pairs[0]))
+
     def test_object_pairs_hook(self):
         s = '{"xkd":1, "kcw":2, "art":3, "hxm":4, "qrt":5, "pad":6, "hoy":7}'
         p = [("xkd", 1), ("kcw", 2), ("art", 3), ("hxm", 4),
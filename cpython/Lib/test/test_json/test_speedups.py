@@ -17,6 +17,12 @@ class TestDecode(CTest):
     def test_make_scanner(self):
         self.assertRaises(AttributeError, self.json.scanner.c_make_scanner, 1)
 
+    def test_make_stream_scanner(self):
+        self.assertIs(self.json.decoder.make_stream_scanner,
+                      self.json.decoder.c_make_stream_scanner)
+        self.assertRaises(AttributeError,
+                          self.json.decoder.c_make_stream_scanner, 1)
+
     def test_make_encoder(self):
         self.assertRaises(TypeError, self.json.encoder.c_make_encoder,
             (True, False),
@@ -0,0 +1,223 @@
+import gc
+import pickle
+from io import BytesIO, StringIO
+from collections import OrderedDict
+from decimal import Decimal
+from test.test_json import PyTest, CTest
+from test.support import cpython_only
+
+
+DOC = ('{"id": 1, "name": "café", "tags": ["a", "\\u00e9\\ud834\\udd20"],'
+       ' "nested": {"values": [1.5, -2e3, 0, true, false, null]}}')
+
+
+class TestStreamDecoder:
+    def decode(self, data, chunks=None, **kw):
+        # Feed data in chunks of the given sizes, then the rest of it.
+        decoder = self.json.JSONStreamDecoder(**kw)
+        values = []
+        for size in chunks or ():
+            decoder.feed(data[:size])
+            data = data[size:]
+            values.extend(decoder.read_values())
+        decoder.feed(data)
+        decoder.close()
+        values.extend(decoder.read_values())
+        return values
+
+    def assertSplitsEqual(self, data, expected, **kw):
+        # Every split of data in two chunks, and byte by byte.
+        for i in range(len(data) + 1):
+            self.assertEqual(self.decode(data, [i], **kw), expected, i)
+        self.assertEqual(self.decode(data, [1] * len(data), **kw), expected)
+
+    def test_values(self):
+        self.assertSplitsEqual(DOC.encode('utf-8'), [self.loads(DOC)])
+        for doc in ['[]', '{}', '""', '"\\"\\\\\\/\\b\\f\\n\\r\\t"', '0',
+                    '-0.5', '1E+2', '12345678901234567890', '[[[[]]]]']:
+            self.assertSplitsEqual(doc.encode('utf-8'), [self.loads(doc)])
+
+    def test_stream(self):
+        data = b' {"a": 1}{"b": 2}\n[3]"4" 5\ttrue\r\nnull  '
+        self.assertSplitsEqual(data, [{'a': 1}, {'b': 2}, [3], '4', 5,
+                                      True, None])
+        self.assertEqual(self.decode(b''), [])
+        self.assertEqual(self.decode(b' \n '), [])
+
+    def test_read_values(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b'[1] [2')
+        self.assertEqual(list(decoder.read_values()), [[1]])
+        self.assertEqual(list(decoder.read_values()), [])
+        decoder.feed(b'] 3 4')
+        self.assertEqual(list(decoder.read_values()), [[2], 3])
+        decoder.close()
+        self.assertEqual(list(decoder.read_values()), [4])
+
+    def test_items(self):
+        data = b'[{"id": 1}, [2], "3"] {"id": 4} [] [5]'
+        self.assertSplitsEqual(data, [{'id': 1}, [2], '3', {'id': 4}, 5],
+                               items=True)
+        decoder = self.json.JSONStreamDecoder(items=True)
+        decoder.feed(b'[1, 2, [3')
+        self.assertEqual(list(decoder.read_values()), [1, 2])
+
+    def test_str(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed('["café", "\U0001d120"]')
+        decoder.close()
+        self.assertEqual(list(decoder.read_values()),
+                         [['café', '\U0001d120']])
+
+    def test_bytes_like(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(bytearray(b'[1, '))
+        decoder.feed(memoryview(b'2]'))
+        decoder.close()
+        self.assertEqual(list(decoder.read_values()), [[1, 2]])
+
+    def test_hooks(self):
+        data = b'[{"a": 1.5, "b": 2}, NaN, -Infinity, Infinity]'
+        self.assertSplitsEqual(data, [[{'a': Decimal('1.5'), 'b': 2.0},
+                                       'NaN', '-Infinity', 'Infinity']],
+                               parse_float=Decimal, parse_int=float,
+                               parse_constant=str)
+        pairs = [('c', 1), ('b', 2), ('a', 3)]
+        data = b'{"c": 1, "b": 2, "a": 3}'
+        self.assertSplitsEqual(data, [pairs], object_pairs_hook=lambda x: x)
+        self.assertSplitsEqual(data, [OrderedDict(pairs)],
+                               object_pairs_hook=OrderedDict)
+        self.assertSplitsEqual(data, [tuple(sorted(dict(pairs)))],
+                               object_hook=lambda x: tuple(sorted(x)))
+
+    def test_strict(self):
+        data = b'["a\tb\nc"]'
+        self.assertRaises(self.JSONDecodeError, self.decode, data)
+        self.assertSplitsEqual(data, [['a\tb\nc']], strict=False)
+
+    def test_memo(self):
+        values = self.decode(b'[{"key": 1}, {"key": 2}]')
+        self.assertIs(list(values[0][0])[0], list(values[0][1])[0])
+
+    def check_error(self, data, msg, pos, lineno, colno):
+        for i in range(len(data) + 1):
+            with self.assertRaises(self.JSONDecodeError) as cm:
+                self.decode(data, [i])
+            err = cm.exception
+            self.assertEqual(err.msg, msg)
+            self.assertIsNone(err.doc)
+            self.assertEqual((err.pos, err.lineno, err.colno),
+                             (pos, lineno, colno))
+        self.assertEqual(str(err), '%s: line %d column %d (byte %d)'
+                                   % (msg, lineno, colno, pos))
+
+    def test_errors(self):
+        test_cases = [
+            (b'[1, 2', "Expecting ',' delimiter", 5),
+            (b'[1, 2,', 'Expecting value', 6),
+            (b'[1,]', 'Expecting value', 3),
+            (b'[', 'Expecting value', 1),
+            (b'{', 'Expecting property name enclosed in double quotes', 1),
+            (b'{"a": 1,}', 'Expecting property name enclosed in double quotes',
+             8),
+            (b'{"a"', "Expecting ':' delimiter", 4),
+            (b'{"a" 1}', "Expecting ':' delimiter", 5),
+            (b'{"a":', 'Expecting value', 5),
+            (b'{"a": 1 "b": 2}', "Expecting ',' delimiter", 8),
+            (b'[1] ]', 'Expecting value', 4),
+            (b'[tru]', 'Expecting value', 1),
+            (b'tru', 'Expecting value', 0),
+            (b'[-]', 'Expecting value', 1),
+            (b'[-', 'Expecting value', 1),
+            (b'[01]', "Expecting ',' delimiter", 2),
+            (b'"abc', 'Unterminated string starting at', 0),
+            (b'"abc\\', 'Unterminated string starting at', 0),
+            (b'["\x1f"]', 'Invalid control character at', 2),
+            (b'["\\x"]', 'Invalid \\escape', 2),
+            (b'["\\u12"]', 'Invalid \\uXXXX escape', 3),
+            (b'["\\ud800\\u12xy"]', 'Invalid \\uXXXX escape', 9),
+        ]
+        for data, msg, pos in test_cases:
+            with self.subTest(data=data):
+                self.check_error(data, msg, pos, 1, pos + 1)
+
+    def test_error_position(self):
+        data = '[\n  "éé",\n\n  x]'.encode('utf-8')
+        self.check_error(data, 'Expecting value', 15, 4, 3)
+        data = '["é\né\\x"]'.encode('utf-8')
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.decode(data, strict=False)
+        self.assertEqual((cm.exception.pos, cm.exception.lineno,
+                          cm.exception.colno), (7, 2, 3))
+
+    def test_invalid_utf8(self):
+        self.assertRaises(UnicodeDecodeError, self.decode, b'["\xff"]')
+        self.assertRaises(UnicodeDecodeError, self.decode, b'["\xc3", "\xa9"]')
+        self.assertRaises(self.JSONDecodeError, self.decode, b'[\xc3\xa9]')
+
+    def test_feed_after_close(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b'[1]')
+        decoder.close()
+        decoder.close()
+        self.assertRaises(ValueError, decoder.feed, b'[2]')
+        self.assertEqual(list(decoder.read_values()), [[1]])
+        self.assertRaises(TypeError, self.json.JSONStreamDecoder().feed, 1)
+
+    @cpython_only
+    def test_untracked_containers(self):
+        values = self.decode(b'[[1, "a", null], {"k": [2.5]}, [[]]]')
+        rval = values[0]
+        self.assertTrue(gc.is_tracked(rval))
+        self.assertFalse(gc.is_tracked(rval[0]))
+        self.assertFalse(gc.is_tracked(rval[1]["k"]))
+        self.assertFalse(gc.is_tracked(rval[2][0]))
+        self.assertTrue(gc.is_tracked(rval[2]))
+
+    def test_iterload(self):
+        data = b'[1, 2]\n{"a": "\xc3\xa9"}\n' * 3
+        self.assertEqual(list(self.json.iterload(BytesIO(data))),
+                         [[1, 2], {'a': 'é'}] * 3)
+        self.assertEqual(list(self.json.iterload(StringIO(data.decode()))),
+                         [[1, 2], {'a': 'é'}] * 3)
+        self.assertEqual(list(self.json.iterload(BytesIO(b'[1, 2] [3]'),
+                                                 items=True)),
+                         [1, 2, 3])
+        self.assertEqual(list(self.json.iterload(BytesIO(b'[1.5]'),
+                                                 parse_float=Decimal)),
+                         [[Decimal('1.5')]])
+        values = self.json.iterload(BytesIO(b'[1] [2'))
+        self.assertEqual(next(values), [1])
+        self.assertRaises(self.JSONDecodeError, next, values)
+
+    def test_iterload_chunks(self):
+        # Values and tokens that span several reads
+        items = [{'id': i, 'text': 'xé\n' * (i % 20)} for i in range(2000)]
+        data = self.dumps(items).encode('utf-8')
+        self.assertGreater(len(data), 2 * self.json._ITERLOAD_CHUNK_SIZE)
+        self.assertEqual(list(self.json.iterload(BytesIO(data), items=True)),
+                         items)
+        data = self.dumps(['x' * 200000, 'y']).encode('utf-8')
+        self.assertEqual(list(self.json.iterload(BytesIO(data))),
+                         [['x' * 200000, 'y']])
+
+
+class TestPyStreamDecoder(TestStreamDecoder, PyTest): pass
+
+class TestCStreamDecoder(TestStreamDecoder, CTest):
+    # Only the errors of the C scanner come from the json package in
+    # sys.modules, which pickle looks up.
+    def test_error_pickle(self):
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.decode(b'\n[1, x]')
+        err = pickle.loads(pickle.dumps(cm.exception))
+        self.assertEqual((err.msg, err.doc, err.pos, err.lineno, err.colno),
+                         ('Expecting value', None, 5, 2, 5))
+        self.assertEqual(str(err), str(cm.exception))
+
+    def test_reentrant_feed(self):
+        decoder = None
+        def hook(obj):
+            decoder.feed(b'1')
+        decoder = self.json.JSONStreamDecoder(object_hook=hook)
+        self.assertRaises(RuntimeError, decoder.feed, b'{}')
@@ -879,6 +879,34 @@ class LongTest(unittest.TestCase):
         self.assertIs(i - i, 0)
         self.assertIs(0 * i, 0)
 
+    def test_single_digit_arithmetic(self):
+        # the eval loop handles ints of at most one digit inline
+        shift = sys.int_info.bits_per_digit
+        big = (1 << shift) - 1
+        for x in (0, 1, -1, 7, -7, big, -big):
+            for y in (0, 1, -1, 3, -3, big, -big):
+                self.assertEqual(x + y, int.__add__(x, y))
+                self.assertEqual(x - y, int.__sub__(x, y))
+                self.assertEqual(x * y, int.__mul__(x, y))
+                self.assertEqual(x < y, int.__lt__(x, y))
+                self.assertEqual(x >= y, int.__ge__(x, y))
+                self.assertEqual(x == y, int.__eq__(x, y))
+                z = x
+                z += y
+                self.assertEqual(z, int.__add__(x, y))
+                z = x
+                z -= y
+                self.assertEqual(z, int.__sub__(x, y))
+        self.assertEqual(big + big, 2 * (1 << shift) - 2)
+        self.assertEqual(big * big, (1 << 2 * shift) - (1 << shift + 1) + 1)
+        self.assertEqual(-big - big, -2 * big)
+        # subclasses keep going through their own methods
+        class MyInt(int):
+            def __add__(self, other):
+                return 'add'
+        self.assertEqual(MyInt(1) + 1, 'add')
+        self.assertIs(type(True + True), int)
+
     def test_bit_length(self):
         tiny = 1e-10
         for x in range(-65000, 65000):
@@ -146,6 +146,17 @@ class AbstractMemoryTests:
             l = m.tolist()
             self.assertEqual(l, list(b"abcdef"))
 
+    def test_toreadonly(self):
+        for tp in self._types:
+            b = tp(self._source)
+            m = self._view(b)
+            mm = m.toreadonly()
+            self.assertTrue(mm.readonly)
+            self.assertTrue(memoryview(mm).readonly)
+            self.assertEqual(mm.tobytes(), m.tobytes())
+            mm.release()
+            m.tobytes()
+
     def test_compare(self):
         # memoryviews can compare for equality with other objects
         # having the buffer interface.
@@ -255,6 +266,7 @@ class AbstractMemoryTests:
         with check: bytes(m)
         with check: m.tobytes()
         with check: m.tolist()
+        with check: m.toreadonly()
         with check: m[0]
         with check: m[0] = b'x'
         with check: len(m)
@@ -47,7 +47,7 @@ class TestTranforms(BytecodeTestCase):
             'Adding a docstring made this test fail in Py2.5.0'
             return None
         self.assertNotInBytecode(f, 'LOAD_GLOBAL')
-        self.assertInBytecode(f, 'LOAD_CONST', None)
+        self.assertInBytecode(f, 'LOAD_CONST__RETURN_VALUE', None)
 
     def test_while_one(self):
         # Skip over:  LOAD_CONST trueconst  POP_JUMP_IF_FALSE xx
@@ -62,7 +62,7 @@ class TestTranforms(BytecodeTestCase):
 
     def test_pack_unpack(self):
         for line, elem in (
-            ('a, = a,', 'LOAD_CONST',),
+            ('a, = a,', 'LOAD_CONST__RETURN_VALUE',),
             ('a, b = a, b', 'ROT_TWO',),
             ('a, b, c = a, b, c', 'ROT_THREE',),
             ):
@@ -88,7 +88,8 @@ class TestTranforms(BytecodeTestCase):
         self.assertNotInBytecode(code, 'BUILD_TUPLE')
         # One LOAD_CONST for the tuple, one for the None return value
         load_consts = [instr for instr in dis.get_instructions(code)
-                              if instr.opname == 'LOAD_CONST']
+                              if instr.opname in ('LOAD_CONST',
+                                                  'LOAD_CONST__RETURN_VALUE')]
         self.assertEqual(len(load_consts), 2)
 
         # Bug 1053819:  Tuple of constants misidentified when presented with:
@@ -306,6 +307,91 @@ class TestTranforms(BytecodeTestCase):
                 self.assertFalse(instr.opname.startswith('BUILD_'))
 
 
+class TestSuperinstructions(BytecodeTestCase):
+
+    def test_fused_pairs(self):
+        def f(a, b):
+            if a < b:
+                return a.real
+            return 0
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_FAST', 'a')
+        self.assertInBytecode(f, 'COMPARE_OP__POP_JUMP_IF_FALSE', '<')
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_ATTR', 'a')
+        self.assertInBytecode(f, 'LOAD_CONST__RETURN_VALUE', 0)
+        # the second instruction of each pair stays in place
+        self.assertInBytecode(f, 'LOAD_FAST', 'b')
+        self.assertInBytecode(f, 'POP_JUMP_IF_FALSE')
+        self.assertInBytecode(f, 'LOAD_ATTR', 'real')
+        self.assertEqual(f(1, 2), 1)
+        self.assertEqual(f(2, 1), 0)
+
+    def test_unbound_local_in_superinstruction(self):
+        def f():
+            a.real
+            a = 1
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_ATTR')
+        self.assertRaises(UnboundLocalError, f)
+
+    def test_tracing(self):
+        def f(a, b):
+            if a == b:
+                return a.real
+            return b.imag
+        lines = []
+        def tracer(frame, event, arg):
+            if frame.f_code is f.__code__ and event == 'line':
+                lines.append(frame.f_lineno - f.__code__.co_firstlineno)
+            return tracer
+        sys.settrace(tracer)
+        try:
+            f(1, 1)
+            f(1, 2)
+        finally:
+            sys.settrace(None)
+        self.assertEqual(lines, [1, 2, 1, 3])
+
+    def test_unexpected_second_instruction(self):
+        # In code built by hand, the instruction after a superinstruction
+        # may not be the one its name ends with.
+        import types
+        def f(a, b):
+            return a, b
+        def g(a):
+            return a == a
+        def code(f, ops):
+            co = f.__code__
+            return types.CodeType(co.co_argcount, co.co_kwonlyargcount,
+                                  co.co_nlocals, co.co_stacksize,
+                                  co.co_flags, bytes(ops), co.co_consts,
+                                  co.co_names, co.co_varnames,
+                                  co.co_filename, co.co_name,
+                                  co.co_firstlineno, co.co_lnotab)
+        op = dis.opmap
+        # LOAD_FAST__LOAD_FAST a; ROT_TWO; ... would run ROT_TWO's bytes
+        # as a LOAD_FAST if it were not checked
+        f.__code__ = code(f, [op['LOAD_FAST__LOAD_FAST'], 0, 0,
+                              op['LOAD_FAST'], 1, 0,
+                              op['ROT_TWO'],
+                              op['BUILD_TUPLE'], 2, 0,
+                              op['RETURN_VALUE']])
+        self.assertEqual(f(1, 2), (2, 1))
+        f.__code__ = code(f, [op['LOAD_FAST__LOAD_ATTR'], 1, 0,
+                              op['LOAD_FAST__LOAD_FAST'], 0, 0,
+                              op['BUILD_TUPLE'], 2, 0,
+                              op['RETURN_VALUE']])
+        self.assertEqual(f(1, 2), (2, 1))
+        g.__code__ = code(g, [op['LOAD_FAST'], 0, 0,
+                              op['LOAD_FAST'], 0, 0,
+                              op['COMPARE_OP__POP_JUMP_IF_FALSE'], 2, 0,
+                              op['RETURN_VALUE']])
+        self.assertIs(g(1), True)
+        g.__code__ = code(g, [op['LOAD_CONST__RETURN_VALUE'], 0, 0,
+                              op['POP_TOP'],
+                              op['LOAD_FAST'], 0, 0,
+                              op['RETURN_VALUE']])
+        self.assertEqual(g(1), 1)
+
+
 class TestBuglets(unittest.TestCase):
 
     def test_bug_11510(self):
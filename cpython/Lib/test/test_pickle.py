@@ -6,6 +6,7 @@ import io
 import collections
 import struct
 import sys
+import weakref
 
 import unittest
 from test import support
@@ -33,9 +34,9 @@ class PyPicklerTests(AbstractPickleTests):
     pickler = pickle._Pickler
     unpickler = pickle._Unpickler
 
-    def dumps(self, arg, proto=None):
+    def dumps(self, arg, proto=None, **kwds):
         f = io.BytesIO()
-        p = self.pickler(f, proto)
+        p = self.pickler(f, proto, **kwds)
         p.dump(arg)
         f.seek(0)
         return bytes(f.read())
@@ -51,8 +52,8 @@ class InMemoryPickleTests(AbstractPickleTests, BigmemPickleTests):
     pickler = pickle._Pickler
     unpickler = pickle._Unpickler
 
-    def dumps(self, arg, protocol=None):
-        return pickle.dumps(arg, protocol)
+    def dumps(self, arg, protocol=None, **kwds):
+        return pickle.dumps(arg, protocol, **kwds)
 
     def loads(self, buf, **kwds):
         return pickle.loads(buf, **kwds)
@@ -149,7 +150,7 @@ if has_c_implementation:
         check_sizeof = support.check_sizeof
 
         def test_pickler(self):
-            basesize = support.calcobjsize('5P2n3i2n3iP')
+            basesize = support.calcobjsize('5P2n3i2n3i2P')
             p = _pickle.Pickler(io.BytesIO())
             self.assertEqual(object.__sizeof__(p), basesize)
             MT_size = struct.calcsize('3nP0n')
@@ -166,7 +167,7 @@ if has_c_implementation:
                 0)  # Write buffer is cleared after every dump().
 
         def test_unpickler(self):
-            basesize = support.calcobjsize('2Pn2P 2P2n2i5P 2P3n6P2n2i')
+            basesize = support.calcobjsize('2Pn2P 2P2n2i5P 2P3n6P2n2iP')
             unpickler = _pickle.Unpickler
             P = struct.calcsize('P')  # Size of memo table entry.
             n = struct.calcsize('n')  # Size of mark table entry.
@@ -209,6 +210,48 @@ if has_c_implementation:
             u.load()
             check(u, stdsize + 32 * P + 2 + 1)
 
+    class PickleBufferTests(unittest.TestCase):
+
+        def test_buffer(self):
+            b = bytearray(b'abcdef')
+            pb = _pickle.PickleBuffer(b)
+            with memoryview(pb) as m:
+                self.assertIs(m.obj, b)
+                self.assertFalse(m.readonly)
+                m[0] = ord('x')
+            self.assertEqual(b, b'xbcdef')
+            with memoryview(_pickle.PickleBuffer(b'abc')) as m:
+                self.assertTrue(m.readonly)
+            self.assertRaises(TypeError, _pickle.PickleBuffer, 1)
+
+        def test_raw(self):
+            b = bytearray(b'abcdef')
+            for obj in b, memoryview(b).cast('B', (2, 3)):
+                with _pickle.PickleBuffer(obj).raw() as m:
+                    self.assertEqual(m.format, 'B')
+                    self.assertEqual(m.shape, (6,))
+                    self.assertEqual(m.tobytes(), b'abcdef')
+                    self.assertFalse(m.readonly)
+            pb = _pickle.PickleBuffer(memoryview(b)[::2])
+            self.assertRaises(BufferError, pb.raw)
+
+        def test_release(self):
+            pb = _pickle.PickleBuffer(b'abc')
+            pb.release()
+            pb.release()
+            self.assertRaises(ValueError, memoryview, pb)
+            self.assertRaises(ValueError, pb.raw)
+            with self.assertRaises(ValueError):
+                pickle.dumps(pb, 5)
+
+        def test_weakref(self):
+            pb = _pickle.PickleBuffer(b'abc')
+            wr = weakref.ref(pb)
+            self.assertIs(wr(), pb)
+            del pb
+            support.gc_collect()
+            self.assertIsNone(wr())
+
 
 ALT_IMPORT_MAPPING = {
     ('_elementtree', 'xml.etree.ElementTree'),
@@ -387,7 +430,7 @@ def test_main():
                       PyPicklerUnpicklerObjectTests,
                       CPicklerUnpicklerObjectTests,
                       CDispatchTableTests, CChainDispatchTableTests,
-                      InMemoryPickleTests, SizeofTests])
+                      InMemoryPickleTests, SizeofTests, PickleBufferTests])
     support.run_unittest(*tests)
     support.run_doctest(pickle)
 
@@ -7,8 +7,8 @@ from test.pickletester import AbstractPickleModuleTests
 
 class OptimizedPickleTests(AbstractPickleTests, AbstractPickleModuleTests):
 
-    def dumps(self, arg, proto=None):
-        return pickletools.optimize(pickle.dumps(arg, proto))
+    def dumps(self, arg, proto=None, **kwds):
+        return pickletools.optimize(pickle.dumps(arg, proto, **kwds))
 
     def loads(self, buf, **kwds):
         return pickle.loads(buf, **kwds)
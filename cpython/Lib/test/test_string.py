@@ -1,4 +1,7 @@
 import unittest, string
+import sys
+import textwrap
+from test.support.script_helper import assert_python_ok
 
 
 class ModuleTest(unittest.TestCase):
@@ -29,6 +32,73 @@ class ModuleTest(unittest.TestCase):
         self.assertEqual(string.capwords('\taBc\tDeF\t'), 'Abc Def')
         self.assertEqual(string.capwords('\taBc\tDeF\t', '\t'), '\tAbc\tDef\t')
 
+    def test_builder(self):
+        b = string.Builder()
+        self.assertEqual(b.build(), '')
+        self.assertEqual(len(b), 0)
+        b.append('abc')
+        b += 'd\xe9'
+        b += ''
+        b.append('\u20ac\U0001F600')
+        self.assertEqual(b.build(), 'abcd\xe9\u20ac\U0001F600')
+        self.assertEqual(len(b), 7)
+        # build() keeps the contents
+        b.append('!')
+        self.assertEqual(b.build(), 'abcd\xe9\u20ac\U0001F600!')
+        self.assertEqual(str(b), b.build())
+        self.assertEqual(len(b), 8)
+
+        class S(str):
+            pass
+        b = string.Builder()
+        b += S('x')
+        self.assertIs(type(b.build()), str)
+        self.assertRaises(TypeError, b.append, b'x')
+        with self.assertRaises(TypeError):
+            b += 1
+        self.assertRaises(TypeError, string.Builder, 'x')
+        self.assertRaises(TypeError, hash, b)
+        self.assertEqual(b.build(), 'x')
+
+    def test_builder_many(self):
+        # more strings than the accumulator keeps before joining them
+        b = string.Builder()
+        for i in range(250000):
+            b += str(i % 10)
+        self.assertEqual(len(b), 250000)
+        self.assertEqual(b.build(), '0123456789' * 25000)
+
+    @unittest.skipUnless(sys.platform.startswith('linux'),
+                         'needs RLIMIT_AS to limit malloc()')
+    def test_builder_failed_build(self):
+        # The error of a failed build() is kept, and the builder can't be
+        # used afterwards.
+        code = textwrap.dedent("""
+            import resource, string
+            s = 'x' * 2**20
+            b = string.Builder()
+            for i in range(1024):
+                b += s
+            del s
+            resource.setrlimit(resource.RLIMIT_AS, (2**29, 2**29))
+            try:
+                b.build()
+            except MemoryError:
+                print('MemoryError')
+            for method in (b.build, lambda: b.append('x')):
+                try:
+                    method()
+                except ValueError as exc:
+                    print(exc)
+            print(len(b))
+            """)
+        rc, out, err = assert_python_ok('-c', code)
+        self.assertEqual(out.decode().splitlines(),
+                         ['MemoryError',
+                          'Builder contents were lost by a failed build()',
+                          'Builder contents were lost by a failed build()',
+                          '0'])
+
     def test_basic_formatter(self):
         fmt = string.Formatter()
         self.assertEqual(fmt.format("foo"), "foo")
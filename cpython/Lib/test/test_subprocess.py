@@ -1,4 +1,5 @@
 import unittest
+from unittest import mock
 from test.support import script_helper
 from test import support
 import subprocess
@@ -1671,6 +1672,17 @@ class POSIXProcessTestCase(BaseTestCase):
         self.assertStderrEqual(stderr, b'')
         self.assertEqual(p.wait(), -signal.SIGTERM)
 
+    def test_kill_sends_sigkill(self):
+        # kill() and terminate() are send_signal() with a fixed signal.
+        p = subprocess.Popen([sys.executable, "-c", "pass"])
+        self.addCleanup(p.wait)
+        with mock.patch.object(p, 'send_signal') as send_signal:
+            p.kill()
+            send_signal.assert_called_once_with(signal.SIGKILL)
+            send_signal.reset_mock()
+            p.terminate()
+            send_signal.assert_called_once_with(signal.SIGTERM)
+
     def test_send_signal_dead(self):
         # Sending a signal to a dead process
         self._kill_dead_process('send_signal', signal.SIGINT)
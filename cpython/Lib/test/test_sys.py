@@ -6,6 +6,7 @@ import subprocess
 import textwrap
 import warnings
 import operator
+import re
 import codecs
 import gc
 import sysconfig
@@ -188,6 +189,71 @@ class SysModuleTest(unittest.TestCase):
         finally:
             sys.setswitchinterval(orig)
 
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_gil_mode(self):
+        self.assertRaises(TypeError, sys._setgilmode)
+        self.assertRaises(ValueError, sys._setgilmode, "lifo")
+        orig = sys._getgilmode()
+        self.assertEqual(orig, "classic")
+        try:
+            for mode in "fifo", "classic":
+                sys._setgilmode(mode)
+                self.assertEqual(sys._getgilmode(), mode)
+        finally:
+            sys._setgilmode(orig)
+
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_thread_priority(self):
+        self.assertRaises(TypeError, sys._setthreadpriority, "high")
+        orig = sys._getthreadpriority()
+        self.assertEqual(orig, 0)
+        priorities = []
+        try:
+            sys._setthreadpriority(5)
+            self.assertEqual(sys._getthreadpriority(), 5)
+            # The priority belongs to the thread
+            t = threading.Thread(
+                target=lambda: priorities.append(sys._getthreadpriority()))
+            t.start()
+            t.join()
+            self.assertEqual(priorities, [0])
+        finally:
+            sys._setthreadpriority(orig)
+
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_gil_stats(self):
+        def spin(n):
+            while n:
+                n -= 1
+
+        orig_mode = sys._getgilmode()
+        orig_interval = sys.getswitchinterval()
+        try:
+            for mode in "classic", "fifo":
+                with self.subTest(mode=mode):
+                    sys._setgilmode(mode)
+                    sys.setswitchinterval(1e-4)
+                    sys._setthreadpriority(1)
+                    before = sys._getgilstats()[threading.get_ident()]
+                    threads = [threading.Thread(target=spin, args=(100000,))
+                               for i in range(3)]
+                    for t in threads:
+                        t.start()
+                    spin(100000)
+                    for t in threads:
+                        t.join()
+                    count, total, maxwait, hist = (
+                        sys._getgilstats()[threading.get_ident()])
+                    self.assertGreater(count, before[0])
+                    self.assertEqual(count, sum(hist))
+                    self.assertGreaterEqual(total, before[1])
+                    self.assertGreaterEqual(total, maxwait)
+                    self.assertGreaterEqual(maxwait, 0.0)
+        finally:
+            sys._setthreadpriority(0)
+            sys._setgilmode(orig_mode)
+            sys.setswitchinterval(orig_interval)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -729,6 +795,112 @@ class SysModuleTest(unittest.TestCase):
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
 
+    @unittest.skipUnless(sysconfig.get_config_var('WITH_PYMALLOC'),
+                         'need pymalloc')
+    def test_pymalloc_configuration(self):
+        args = ['-c', 'import sys; sys._debugmallocstats()']
+        ret, out, err = assert_python_ok(*args,
+                                         PYTHONMALLOCARENASIZE='1024',
+                                         PYTHONMALLOCTHRESHOLD='256',
+                                         PYTHONMALLOCALIGNMENT='16')
+        self.assertIn(b"Small block threshold = 256", err)
+        self.assertIn(b"16-byte alignment", err)
+        self.assertIn(b" * 1048576 bytes/arena", err)
+
+        for name, value in [('PYTHONMALLOCARENASIZE', '90'),
+                            ('PYTHONMALLOCARENASIZE', 'big'),
+                            ('PYTHONMALLOCTHRESHOLD', '1024'),
+                            ('PYTHONMALLOCALIGNMENT', '12')]:
+            with self.subTest(name=name, value=value):
+                ret, out, err = assert_python_failure('-c', 'pass',
+                                                      **{name: value})
+                self.assertIn(name.encode('ascii') + b" must be", err)
+
+        # -E and -I ignore the settings, even when options which allocate
+        # objects come first
+        for opt in ['-E', '-I']:
+            with self.subTest(opt=opt):
+                ret, out, err = assert_python_ok('-X', 'faulthandler', opt,
+                                                 *args, __isolated=False,
+                                                 PYTHONMALLOCARENASIZE='big',
+                                                 PYTHONMALLOCTHRESHOLD='256')
+                self.assertIn(b"Small block threshold = 512", err)
+
+    def test_release_memory(self):
+        # Free most objects, but leave some alive in every arena so that
+        # few arenas can be freed.  The free runs between the objects kept
+        # must span whole pages whatever the page size, so they are far
+        # apart: memory is released by pages, which may be larger than
+        # pools, and by huge pages when the arenas are backed by them.
+        code = textwrap.dedent("""
+            import sys
+            n, step = map(int, sys.argv[1:])
+            data = [(i, str(i)) for i in range(n)]
+            keep = data[::step]
+            del data
+            released = sys._release_memory()
+            assert released >= 0, released
+            # released pools can be used again
+            data = [(i, str(i)) for i in range(n)]
+            print(released)
+            sys._debugmallocstats()
+            """)
+        for args, env in [(['100000', '5000'], {}),
+                          (['300000', '20000'],
+                           {'PYTHONMALLOCARENASIZE': '4096',
+                            'PYTHONMALLOCHUGEPAGES': '1'})]:
+            with self.subTest(env=env):
+                ret, out, err = assert_python_ok('-c', code, *args, **env)
+                released = int(out)
+                if (sysconfig.get_config_var('WITH_PYMALLOC')
+                    and sys.platform.startswith('linux')):
+                    self.assertGreater(released, 0)
+                    self.assertIn(b"of them released", err)
+
+    @unittest.skipUnless(sysconfig.get_config_var('WITH_PYMALLOC'),
+                         'need pymalloc')
+    @unittest.skipUnless(threading, 'need threading')
+    def test_thread_caches(self):
+        # The main thread frees the blocks allocated by the producer
+        # threads.  With PYMALLOC_THREAD_CACHE, they go to its cache, which
+        # gives them back to the pools in batches when it grows too large.
+        code = textwrap.dedent("""
+            import queue, sys, threading
+            q = queue.Queue()
+            def produce():
+                for i in range(20000):
+                    q.put([str(i), (i, i + 1)])
+                q.put(None)
+            threads = [threading.Thread(target=produce) for i in range(4)]
+            for t in threads:
+                t.start()
+            done = 0
+            while done < len(threads):
+                item = q.get()
+                if item is None:
+                    done += 1
+            for t in threads:
+                t.join()
+            sys._debugmallocstats()
+            """)
+        ret, out, err = assert_python_ok('-c', code)
+        if b"# thread cache refills" not in err:
+            self.skipTest('need a PYMALLOC_THREAD_CACHE build')
+        stats = {}
+        for line in err.decode('ascii').splitlines():
+            m = re.match(r'(.*?) *= *([\d,]+)$', line)
+            if m:
+                stats[m.group(1)] = int(m.group(2).replace(',', ''))
+        self.assertGreater(stats['# thread cache refills'], 0)
+        self.assertGreater(stats['# thread cache flushes'], 0)
+        # the caches of the producers were emptied when they exited
+        m = re.search(r'\(in (\d+) thread caches\) *= *([\d,]+)',
+                      err.decode('ascii'))
+        self.assertIsNotNone(m)
+        self.assertEqual(int(m.group(1)), 1)
+        self.assertLessEqual(int(m.group(2).replace(',', '')),
+                             stats['# bytes in allocated blocks'])
+
     @unittest.skipUnless(hasattr(sys, "getallocatedblocks"),
                          "sys.getallocatedblocks unavailable on this build")
     def test_getallocatedblocks(self):
@@ -758,6 +930,24 @@ class SysModuleTest(unittest.TestCase):
         c = sys.getallocatedblocks()
         self.assertIn(c, range(b - 50, b + 50))
 
+    def test_getglobalcachestats(self):
+        self.assertRaises(TypeError, sys._getglobalcachestats, None)
+        ns = {}
+        exec("def f():\n    return len", ns)
+        f = ns['f']
+        code = f.__code__
+        self.assertEqual(sys._getglobalcachestats(code), (0, 0))
+        for i in range(10):
+            self.assertIs(f(), len)
+        self.assertEqual(sys._getglobalcachestats(code), (9, 1))
+        # Modifying the globals invalidates the cached entry
+        ns['len'] = 42
+        self.assertEqual(f(), 42)
+        self.assertEqual(sys._getglobalcachestats(code), (9, 2))
+        del ns['len']
+        self.assertIs(f(), len)
+        self.assertEqual(sys._getglobalcachestats(code), (9, 3))
+
     def test_is_finalizing(self):
         self.assertIs(sys.is_finalizing(), False)
         # Don't use the atexit module because _Py_Finalizing is only set
@@ -870,13 +1060,13 @@ class SizeofTest(unittest.TestCase):
             return inner
         check(get_cell().__closure__[0], size('P'))
         # code
-        check(get_cell().__code__, size('5i9Pi3P'))
-        check(get_cell.__code__, size('5i9Pi3P'))
+        check(get_cell().__code__, size('5i9Pi4P'))
+        check(get_cell.__code__, size('5i9Pi4P'))
         def get_cell2(x):
             def inner():
                 return x
             return inner
-        check(get_cell2.__code__, size('5i9Pi3P') + 1)
+        check(get_cell2.__code__, size('5i9Pi4P') + 1)
         # complex
         check(complex(0,1), size('2d'))
         # method_descriptor (descriptor object)
@@ -894,9 +1084,13 @@ class SizeofTest(unittest.TestCase):
         # method-wrapper (descriptor object)
         check({}.__iter__, size('2P'))
         # dict
-        check({}, size('n2P' + '2nPn' + 8*'n2P'))
+        # (PyDictKeysObject + 1-byte indices + control bytes +
+        #  USABLE_FRACTION entries)
+        check({}, size('nQ2P') + struct.calcsize('2nP2n') +
+              8 + 16 + 5*struct.calcsize('n2P'))
         longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
-        check(longdict, size('n2P' + '2nPn') + 16*struct.calcsize('n2P'))
+        check(longdict, size('nQ2P') + struct.calcsize('2nP2n') +
+              16 + 16 + 11*struct.calcsize('n2P'))
         # dictionary-keyiterator
         check({}.keys(), size('P'))
         # dictionary-valueiterator
@@ -938,7 +1132,7 @@ class SizeofTest(unittest.TestCase):
         nfrees = len(x.f_code.co_freevars)
         extras = x.f_code.co_stacksize + x.f_code.co_nlocals +\
                   ncells + nfrees - 1
-        check(x, vsize('12P3ic' + CO_MAXBLOCKS*'3i' + 'P' + extras*'P'))
+        check(x, vsize('12P3i2c' + CO_MAXBLOCKS*'3i' + 'P' + extras*'P'))
         # function
         def func(): pass
         check(func, size('12P'))
@@ -1041,13 +1235,13 @@ class SizeofTest(unittest.TestCase):
         # (PyTypeObject + PyAsyncMethods + PyNumberMethods + PyMappingMethods +
         #  PySequenceMethods + PyBufferProcs + 4P)
         s = vsize('P2n17Pl4Pn9Pn11PIP') + struct.calcsize('34P 3P 3P 10P 2P 4P')
-        # Separate block for PyDictKeysObject with 4 entries
-        s += struct.calcsize("2nPn") + 4*struct.calcsize("n2P")
+        # Separate block for PyDictKeysObject with 8 slots and 5 entries
+        s += struct.calcsize("2nP2n") + 8 + 16 + 5*struct.calcsize("n2P")
         # class
         class newstyleclass(object): pass
         check(newstyleclass, s)
         # dict with shared keys
-        check(newstyleclass().__dict__, size('n2P' + '2nPn'))
+        check(newstyleclass().__dict__, size('nQ2P') + 5*struct.calcsize('P'))
         # unicode
         # each tuple contains a string and its expected character size
         # don't put any static strings here, as they may contain
@@ -194,6 +194,16 @@ class UnicodeTest(string_tests.CommonTest,
         self.checkequal(0, 'a' * 10, 'count', 'a\u0102')
         self.checkequal(0, 'a' * 10, 'count', 'a\U00100304')
         self.checkequal(0, '\u0102' * 10, 'count', '\u0102\U00100304')
+        # test implementation details of the vectorized paths: matches
+        # on both sides of the 16 byte blocks, and overlapping candidates
+        for c in 'a', '\xe9', '\u0102', '\U00100304':
+            for n in range(40):
+                s = c * n + '_' + c * (40 - n)
+                self.checkequal(40, s, 'count', c)
+                self.checkequal(n // 2 + (40 - n) // 2, s, 'count', c * 2)
+                self.checkequal(n // 3 + (40 - n) // 3, s, 'count', c * 3)
+                self.checkequal(1, s, 'count', c * n + '_')
+                self.checkequal(5 if n >= 5 else 4, s, 'count', c, 0, 5)
 
     def test_find(self):
         string_tests.CommonTest.test_find(self)
@@ -225,8 +235,17 @@ class UnicodeTest(string_tests.CommonTest,
         self.checkequal(-1, 'a' * 100, 'find', 'a\u0102')
         self.checkequal(-1, 'a' * 100, 'find', 'a\U00100304')
         self.checkequal(-1, '\u0102' * 100, 'find', '\u0102\U00100304')
+        # test implementation details of the vectorized paths
+        for c in 'a', '\xe9', '\u0102', '\U00100304':
+            for n in range(40):
+                s = c * n + '_' + c * (40 - n)
+                self.checkequal(n, s, 'find', '_')
+                self.checkequal(n, s, 'find', '_' + c)
+                self.checkequal(n - 1 if n else -1, s, 'find', c + '_')
+                self.checkequal(n - 3 if n >= 3 else -1,
+                                s, 'find', c * 3 + '_')
+                self.checkequal(-1, s, 'find', c + '_' + c * 41)
 
-    def test_rfind(self):
         string_tests.CommonTest.test_rfind(self)
         # test implementation details of the memrchr fast path
         self.checkequal(0, '\u0102' + 'a' * 100 , 'rfind', '\u0102')
@@ -1618,6 +1637,29 @@ class UnicodeTest(string_tests.CommonTest,
         for seq, res in sequences:
             self.assertEqual(seq.decode('utf-8'), res)
 
+    def test_utf8_ascii_runs(self):
+        # ASCII runs are copied 16 bytes at a time: put the other
+        # characters on both sides of the blocks, for each string kind
+        for c in '\xe9', '€', '\U0010FFFF':
+            for n in range(40):
+                for s in ('a' * n + c + 'b' * 40,
+                          c + 'a' * n + c + 'b' * (40 - n),
+                          'a' * n + '\x80' * 3 + 'b' * n + c):
+                    data = s.encode('utf-8')
+                    self.assertEqual(data.decode('utf-8'), s)
+                    self.assertEqual(s.encode('utf-8'), data)
+                    k = len(s[:n].encode('utf-8'))
+                    self.assertEqual(
+                        (data[:k] + b'\xff' + data[k:]).decode('utf-8',
+                                                                'replace'),
+                        s[:n] + '\ufffd' + s[n:])
+                    with self.assertRaises(UnicodeDecodeError) as cm:
+                        (data + b'\xff' + b'c' * 20).decode('utf-8')
+                    self.assertEqual(cm.exception.start, len(data))
+                    with self.assertRaises(UnicodeEncodeError) as cm:
+                        (s + '\udc80' + 'c' * 20).encode('utf-8')
+                    self.assertEqual(cm.exception.start, len(s))
+
 
     def test_utf8_decode_invalid_sequences(self):
         # continuation bytes in a sequence of 2, 3, or 4 bytes
@@ -2220,6 +2262,19 @@ class UnicodeTest(string_tests.CommonTest,
         s = 'abc'
         self.assertIs(s.expandtabs(), s)
 
+    @support.cpython_only
+    def test_slice_maxchar(self):
+        # a slice uses the narrowest kind able to hold its characters,
+        # wherever the widest one is relative to the 16 byte blocks
+        for low, high in (('a', '\xe9'), ('a', 'Ă'), ('\xe9', 'Ă'),
+                          ('a', '\U00100304'), ('Ă', '\U00100304')):
+            for n in range(70):
+                s = '\U00100304' + low * 70
+                s = s[:n + 1] + high + s[n + 2:]
+                for sub in s[1:], s[1:n + 1], s[n + 2:]:
+                    self.assertEqual(sys.getsizeof(sub),
+                                     sys.getsizeof(''.join(list(sub))))
+
     def test_raiseMemError(self):
         if struct.calcsize('P') == 8:
             # 64 bits pointers
@@ -14,6 +14,7 @@
 #define PyEncoder_CheckExact(op) (Py_TYPE(op) == &PyEncoderType)
 
 static PyTypeObject PyScannerType;
+static PyTypeObject PyStreamScannerType;
 static PyTypeObject PyEncoderType;
 
 typedef struct _PyScannerObject {
@@ -773,6 +774,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
                 PyObject *item = PyTuple_Pack(2, key, val);
                 if (item == NULL)
                     goto bail;
+                _PyTuple_MaybeUntrack(item);
                 Py_CLEAR(key);
                 Py_CLEAR(val);
                 if (PyList_Append(rval, item) == -1) {
@@ -845,6 +847,8 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     Py_ssize_t next_idx;
     if (rval == NULL)
         return NULL;
+    /* tracked again by PyList_Append() if a container is added */
+    _PyList_MaybeUntrack(rval);
 
     if (PyUnicode_READY(pystr) == -1)
         return NULL;
@@ -1306,6 +1310,980 @@ PyTypeObject PyScannerType = {
     0,/* PyObject_GC_Del, */              /* tp_free */
 };
 
+/* Incremental scanner: decodes a stream of JSON values from chunks of
+   UTF-8 encoded bytes.  Unlike the scanner above, which recurses over a
+   whole document, it keeps the containers being built on an explicit
+   stack, so that parsing can stop at the end of any chunk and resume
+   with the next one.  Only the bytes of an incomplete token are kept
+   between two chunks. */
+
+enum {
+    STREAM_VALUE,           /* a value */
+    STREAM_ARRAY_FIRST,     /* after '[': a value or ']' */
+    STREAM_ARRAY_NEXT,      /* after an array item: ',' or ']' */
+    STREAM_OBJECT_FIRST,    /* after '{': a key or '}' */
+    STREAM_OBJECT_KEY,      /* after ',' in an object: a key */
+    STREAM_OBJECT_COLON,    /* after a key: ':' */
+    STREAM_OBJECT_NEXT      /* after an object item: ',' or '}' */
+};
+
+/* Error messages for a stream that ends in each state */
+static const char *stream_expecting[] = {
+    "Expecting value",
+    "Expecting value",
+    "Expecting ',' delimiter",
+    "Expecting property name enclosed in double quotes",
+    "Expecting property name enclosed in double quotes",
+    "Expecting ':' delimiter",
+    "Expecting ',' delimiter",
+};
+
+typedef struct {
+    PyObject *container;    /* list or dict; NULL for the top-level array
+                               whose items are returned one by one */
+    PyObject *key;          /* key of the item being read in an object */
+    int is_object;
+} StreamFrame;
+
+typedef struct _PyStreamScannerObject {
+    PyObject_HEAD
+    int strict;
+    int items;
+    PyObject *object_hook;
+    PyObject *object_pairs_hook;
+    PyObject *parse_float;
+    PyObject *parse_int;
+    PyObject *parse_constant;
+    PyObject *memo;
+    PyObject *values;       /* values completed by the current call */
+    StreamFrame *stack;
+    Py_ssize_t depth;
+    Py_ssize_t stack_size;
+    int state;
+    int running;
+    int closed;
+    char *buf;              /* buf[buf_start:buf_len] is not parsed yet */
+    Py_ssize_t buf_start;
+    Py_ssize_t buf_len;
+    Py_ssize_t buf_size;
+    Py_ssize_t string_scanned;  /* bytes of an incomplete string already
+                                   checked for its closing quote */
+    int string_escape;      /* ... and whether they hold an escape */
+    Py_ssize_t offset;      /* position of buf[buf_start] in the stream */
+    Py_ssize_t lineno;      /* its line... */
+    Py_ssize_t linestart;   /* ...and the position where that line starts */
+} PyStreamScannerObject;
+
+#define IS_NUMBER_BYTE(c) ((((c) >= '0') && ((c) <= '9')) || ((c) == '-') || ((c) == '+') || ((c) == '.') || ((c) == 'e') || ((c) == 'E'))
+
+static void
+stream_count_lines(const char *buf, Py_ssize_t start, Py_ssize_t end,
+                   Py_ssize_t offset, Py_ssize_t *lineno, Py_ssize_t *linestart)
+{
+    /* Count the newlines in buf[start:end], where buf[start] is at
+       position offset in the stream */
+    const char *p = buf + start;
+    const char *stop = buf + end;
+    const char *nl;
+    while (p < stop && (nl = memchr(p, '\n', stop - p)) != NULL) {
+        (*lineno)++;
+        *linestart = offset + (nl + 1 - (buf + start));
+        p = nl + 1;
+    }
+}
+
+static void
+stream_errmsg(PyStreamScannerObject *s, const char *msg, Py_ssize_t idx)
+{
+    /* Raise a JSONDecodeError for buf[idx].  The stream is not kept, so
+       it is built by json.decoder._stream_error() from the position,
+       rather than from a document as in raise_errmsg() */
+    static PyObject *stream_error = NULL;
+    Py_ssize_t lineno = s->lineno;
+    Py_ssize_t linestart = s->linestart;
+    Py_ssize_t pos = s->offset + (idx - s->buf_start);
+    PyObject *exc;
+    if (stream_error == NULL) {
+        PyObject *decoder = PyImport_ImportModule("json.decoder");
+        if (decoder == NULL)
+            return;
+        stream_error = PyObject_GetAttrString(decoder, "_stream_error");
+        Py_DECREF(decoder);
+        if (stream_error == NULL)
+            return;
+    }
+    stream_count_lines(s->buf, s->buf_start, idx, s->offset,
+                       &lineno, &linestart);
+    exc = PyObject_CallFunction(stream_error, "(znnn)", msg, pos, lineno,
+                                pos - linestart + 1);
+    if (exc) {
+        PyErr_SetObject((PyObject *)Py_TYPE(exc), exc);
+        Py_DECREF(exc);
+    }
+}
+
+static int
+stream_decode_hex(const char *buf, Py_ssize_t idx, Py_UCS4 *c)
+{
+    /* Decode the 4 hex digits at buf[idx] */
+    Py_ssize_t i;
+    *c = 0;
+    for (i = idx; i < idx + 4; i++) {
+        char digit = buf[i];
+        *c <<= 4;
+        if (digit >= '0' && digit <= '9')
+            *c |= (digit - '0');
+        else if (digit >= 'a' && digit <= 'f')
+            *c |= (digit - 'a' + 10);
+        else if (digit >= 'A' && digit <= 'F')
+            *c |= (digit - 'A' + 10);
+        else
+            return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+stream_decode_string(PyStreamScannerObject *s, Py_ssize_t begin, Py_ssize_t end)
+{
+    /* Decode a JSON string with escapes.
+    buf[begin] is the opening quote and buf[end] the closing quote.
+    Escapes are ASCII, so the UTF-8 runs between them are decoded as a
+    whole.
+
+    Returns a new PyUnicode
+    */
+    const char *buf = s->buf;
+    _PyUnicodeWriter writer;
+    Py_ssize_t chunk = begin + 1;
+    Py_ssize_t next;
+    PyObject *text;
+    Py_UCS4 c;
+
+    _PyUnicodeWriter_Init(&writer);
+    writer.min_length = end - begin - 1;
+    while (1) {
+        for (next = chunk; next < end && buf[next] != '\\'; next++)
+            ;
+        if (next != chunk) {
+            text = PyUnicode_DecodeUTF8(buf + chunk, next - chunk, NULL);
+            if (text == NULL)
+                goto bail;
+            if (_PyUnicodeWriter_WriteStr(&writer, text) < 0) {
+                Py_DECREF(text);
+                goto bail;
+            }
+            Py_DECREF(text);
+        }
+        if (next == end)
+            break;
+        /* the scan made sure that a backslash is followed by a byte */
+        c = (unsigned char)buf[next + 1];
+        if (c != 'u') {
+            switch (c) {
+                case '"': break;
+                case '\\': break;
+                case '/': break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'n': c = '\n'; break;
+                case 'r': c = '\r'; break;
+                case 't': c = '\t'; break;
+                default: c = 0;
+            }
+            if (c == 0) {
+                stream_errmsg(s, "Invalid \\escape", next);
+                goto bail;
+            }
+            chunk = next + 2;
+        }
+        else {
+            if (next + 6 > end || stream_decode_hex(buf, next + 2, &c) < 0) {
+                stream_errmsg(s, "Invalid \\uXXXX escape", next + 1);
+                goto bail;
+            }
+            chunk = next + 6;
+            /* Surrogate pair */
+            if (Py_UNICODE_IS_HIGH_SURROGATE(c) && chunk + 6 <= end &&
+                buf[chunk] == '\\' && buf[chunk + 1] == 'u') {
+                Py_UCS4 c2;
+                if (stream_decode_hex(buf, chunk + 2, &c2) < 0) {
+                    stream_errmsg(s, "Invalid \\uXXXX escape", chunk + 1);
+                    goto bail;
+                }
+                if (Py_UNICODE_IS_LOW_SURROGATE(c2)) {
+                    c = Py_UNICODE_JOIN_SURROGATES(c, c2);
+                    chunk += 6;
+                }
+            }
+        }
+        if (_PyUnicodeWriter_WriteChar(&writer, c) < 0)
+            goto bail;
+    }
+    return _PyUnicodeWriter_Finish(&writer);
+bail:
+    _PyUnicodeWriter_Dealloc(&writer);
+    return NULL;
+}
+
+static PyObject *
+stream_scan_string(PyStreamScannerObject *s, Py_ssize_t begin, int final, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON string from the buffer.
+    begin is the index of the opening quote.
+    *next_idx_ptr is a return-by-reference index of the byte after the
+        closing quote.
+
+    Returns a new PyUnicode, or NULL without an exception set if the
+    closing quote is not in the buffer yet.  The next call resumes the
+    scan where this one stopped.
+    */
+    const char *buf = s->buf;
+    Py_ssize_t end = s->buf_len;
+    Py_ssize_t next = begin + 1 + s->string_scanned;
+    int has_escape = s->string_escape;
+    unsigned char c;
+
+    while (next < end) {
+        c = (unsigned char)buf[next];
+        if (c == '"')
+            break;
+        if (c == '\\') {
+            if (next + 1 == end)
+                break;
+            has_escape = 1;
+            next += 2;
+        }
+        else if (s->strict && c <= 0x1f) {
+            stream_errmsg(s, "Invalid control character at", next);
+            return NULL;
+        }
+        else {
+            next++;
+        }
+    }
+    if (next >= end || buf[next] != '"') {
+        if (final) {
+            stream_errmsg(s, "Unterminated string starting at", begin);
+            return NULL;
+        }
+        s->string_scanned = next - begin - 1;
+        s->string_escape = has_escape;
+        return NULL;
+    }
+    s->string_scanned = 0;
+    s->string_escape = 0;
+    *next_idx_ptr = next + 1;
+    if (has_escape)
+        return stream_decode_string(s, begin, next);
+    return PyUnicode_DecodeUTF8(buf + begin + 1, next - begin - 1, NULL);
+}
+
+static PyObject *
+stream_match_literal(PyStreamScannerObject *s, Py_ssize_t idx, int final,
+                     const char *literal, PyObject *value, Py_ssize_t *next_idx_ptr)
+{
+    /* Read the JSON literal at buf[idx].
+    value is the result, or NULL for the constants passed to parse_constant.
+
+    Returns NULL without an exception set if the buffer ends in a prefix
+    of the literal.
+    */
+    Py_ssize_t len = strlen(literal);
+    Py_ssize_t avail = s->buf_len - idx;
+    PyObject *cstr;
+    PyObject *rval;
+
+    if (memcmp(s->buf + idx, literal, Py_MIN(len, avail)) != 0 ||
+        (avail < len && final)) {
+        stream_errmsg(s, "Expecting value", idx);
+        return NULL;
+    }
+    if (avail < len)
+        return NULL;
+    *next_idx_ptr = idx + len;
+    if (value != NULL) {
+        Py_INCREF(value);
+        return value;
+    }
+    cstr = PyUnicode_InternFromString(literal);
+    if (cstr == NULL)
+        return NULL;
+    rval = PyObject_CallFunctionObjArgs(s->parse_constant, cstr, NULL);
+    Py_DECREF(cstr);
+    return rval;
+}
+
+static PyObject *
+stream_match_number(PyStreamScannerObject *s, Py_ssize_t start, int final, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON number from the buffer, as _match_number_unicode() does.
+    start is the index of the first byte of the number.
+
+    Returns NULL without an exception set if the number may continue in
+    the next chunk.
+    */
+    const char *buf = s->buf;
+    Py_ssize_t end_idx;
+    Py_ssize_t idx = start;
+    int is_float = 0;
+    PyObject *rval;
+    PyObject *numstr;
+    PyObject *custom_func;
+
+    /* a number ends at the first byte that cannot be part of it */
+    for (end_idx = start; end_idx < s->buf_len && IS_NUMBER_BYTE(buf[end_idx]); end_idx++)
+        ;
+    if (end_idx == s->buf_len && !final)
+        return NULL;
+    end_idx--;
+
+    /* read a sign if it's there, make sure it's not the end of the number */
+    if (buf[idx] == '-') {
+        idx++;
+        if (idx > end_idx)
+            goto fail;
+    }
+
+    /* read as many integer digits as we find as long as it doesn't start with 0 */
+    if (buf[idx] >= '1' && buf[idx] <= '9') {
+        idx++;
+        while (idx <= end_idx && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+    }
+    /* if it starts with 0 we only expect one integer digit */
+    else if (buf[idx] == '0') {
+        idx++;
+    }
+    /* no integer digits, error */
+    else {
+        goto fail;
+    }
+
+    /* if the next byte is '.' followed by a digit then read all float digits */
+    if (idx < end_idx && buf[idx] == '.' && buf[idx + 1] >= '0' && buf[idx + 1] <= '9') {
+        is_float = 1;
+        idx += 2;
+        while (idx <= end_idx && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+    }
+
+    /* if the next byte is 'e' or 'E' then maybe read the exponent (or backtrack) */
+    if (idx < end_idx && (buf[idx] == 'e' || buf[idx] == 'E')) {
+        Py_ssize_t e_start = idx;
+        idx++;
+
+        /* read an exponent sign if present */
+        if (idx < end_idx && (buf[idx] == '-' || buf[idx] == '+')) idx++;
+
+        /* read all digits */
+        while (idx <= end_idx && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+
+        /* if we got a digit, then parse as float. if not, backtrack */
+        if (buf[idx - 1] >= '0' && buf[idx - 1] <= '9') {
+            is_float = 1;
+        }
+        else {
+            idx = e_start;
+        }
+    }
+
+    if (is_float && s->parse_float != (PyObject *)&PyFloat_Type)
+        custom_func = s->parse_float;
+    else if (!is_float && s->parse_int != (PyObject *) &PyLong_Type)
+        custom_func = s->parse_int;
+    else
+        custom_func = NULL;
+
+    if (custom_func) {
+        numstr = PyUnicode_DecodeASCII(buf + start, idx - start, NULL);
+        if (numstr == NULL)
+            return NULL;
+        rval = PyObject_CallFunctionObjArgs(custom_func, numstr, NULL);
+    }
+    else {
+        /* a NUL-terminated copy for PyLong_FromString() */
+        numstr = PyBytes_FromStringAndSize(buf + start, idx - start);
+        if (numstr == NULL)
+            return NULL;
+        if (is_float)
+            rval = PyFloat_FromString(numstr);
+        else
+            rval = PyLong_FromString(PyBytes_AS_STRING(numstr), NULL, 10);
+    }
+    Py_DECREF(numstr);
+    *next_idx_ptr = idx;
+    return rval;
+fail:
+    stream_errmsg(s, "Expecting value", start);
+    return NULL;
+}
+
+static PyObject *
+stream_scan_term(PyStreamScannerObject *s, Py_ssize_t idx, int final, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON string, literal or number from the buffer.
+
+    Returns NULL without an exception set if the term is not complete.
+    */
+    switch (s->buf[idx]) {
+        case '"':
+            return stream_scan_string(s, idx, final, next_idx_ptr);
+        case 'n':
+            return stream_match_literal(s, idx, final, "null", Py_None, next_idx_ptr);
+        case 't':
+            return stream_match_literal(s, idx, final, "true", Py_True, next_idx_ptr);
+        case 'f':
+            return stream_match_literal(s, idx, final, "false", Py_False, next_idx_ptr);
+        case 'N':
+            return stream_match_literal(s, idx, final, "NaN", NULL, next_idx_ptr);
+        case 'I':
+            return stream_match_literal(s, idx, final, "Infinity", NULL, next_idx_ptr);
+        case '-':
+            if (idx + 1 == s->buf_len && !final)
+                return NULL;
+            if (idx + 1 < s->buf_len && s->buf[idx + 1] == 'I')
+                return stream_match_literal(s, idx, final, "-Infinity", NULL, next_idx_ptr);
+            break;
+    }
+    return stream_match_number(s, idx, final, next_idx_ptr);
+}
+
+static int
+stream_add_value(PyStreamScannerObject *s, PyObject *val)
+{
+    /* Store a completed value in its container, or return it from the
+       current call if it is a top-level value.  Steals a reference to
+       val. */
+    StreamFrame *frame;
+    int rval;
+
+    if (s->depth == 0) {
+        s->state = STREAM_VALUE;
+        rval = PyList_Append(s->values, val);
+        Py_DECREF(val);
+        return rval;
+    }
+    frame = &s->stack[s->depth - 1];
+    if (!frame->is_object) {
+        s->state = STREAM_ARRAY_NEXT;
+        if (frame->container == NULL)
+            rval = PyList_Append(s->values, val);
+        else
+            rval = PyList_Append(frame->container, val);
+    }
+    else {
+        s->state = STREAM_OBJECT_NEXT;
+        if (s->object_pairs_hook != Py_None) {
+            PyObject *item = PyTuple_Pack(2, frame->key, val);
+            if (item == NULL) {
+                Py_DECREF(val);
+                return -1;
+            }
+            _PyTuple_MaybeUntrack(item);
+            rval = PyList_Append(frame->container, item);
+            Py_DECREF(item);
+        }
+        else {
+            rval = PyDict_SetItem(frame->container, frame->key, val);
+        }
+        Py_CLEAR(frame->key);
+    }
+    Py_DECREF(val);
+    return rval;
+}
+
+static int
+stream_push(PyStreamScannerObject *s, int is_object)
+{
+    /* Start an array or an object */
+    StreamFrame *frame;
+    PyObject *container;
+
+    if (s->depth == s->stack_size) {
+        Py_ssize_t size = s->stack_size ? s->stack_size * 2 : 16;
+        StreamFrame *stack = NULL;
+        if ((size_t)size <= PY_SSIZE_T_MAX / sizeof(StreamFrame))
+            stack = PyMem_Realloc(s->stack, size * sizeof(StreamFrame));
+        if (stack == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        s->stack = stack;
+        s->stack_size = size;
+    }
+    if (is_object) {
+        if (s->object_pairs_hook != Py_None)
+            container = PyList_New(0);
+        else
+            container = PyDict_New();
+        if (container == NULL)
+            return -1;
+        s->state = STREAM_OBJECT_FIRST;
+    }
+    else {
+        if (s->items && s->depth == 0) {
+            container = NULL;
+        }
+        else {
+            container = PyList_New(0);
+            if (container == NULL)
+                return -1;
+            /* tracked again by PyList_Append() if a container is added */
+            _PyList_MaybeUntrack(container);
+        }
+        s->state = STREAM_ARRAY_FIRST;
+    }
+    frame = &s->stack[s->depth++];
+    frame->container = container;
+    frame->key = NULL;
+    frame->is_object = is_object;
+    return 0;
+}
+
+static int
+stream_pop(PyStreamScannerObject *s)
+{
+    /* Complete the innermost array or object */
+    StreamFrame *frame = &s->stack[--s->depth];
+    PyObject *val = frame->container;
+    PyObject *hooked;
+
+    frame->container = NULL;
+    if (val == NULL) {
+        /* the items of this array were already returned */
+        s->state = STREAM_VALUE;
+        return 0;
+    }
+    if (frame->is_object) {
+        if (s->object_pairs_hook != Py_None) {
+            hooked = PyObject_CallFunctionObjArgs(s->object_pairs_hook, val, NULL);
+            Py_DECREF(val);
+            val = hooked;
+        }
+        else if (s->object_hook != Py_None) {
+            hooked = PyObject_CallFunctionObjArgs(s->object_hook, val, NULL);
+            Py_DECREF(val);
+            val = hooked;
+        }
+        if (val == NULL)
+            return -1;
+    }
+    return stream_add_value(s, val);
+}
+
+static int
+stream_parse(PyStreamScannerObject *s, int final)
+{
+    /* Parse the buffer up to its last complete token.
+    If final is true, the stream ends with the buffer.
+
+    Returns -1 on error.
+    */
+    const char *buf = s->buf;
+    Py_ssize_t end = s->buf_len;
+    Py_ssize_t idx = s->buf_start;
+    Py_ssize_t next_idx;
+    PyObject *val;
+    PyObject *memokey;
+    unsigned char c;
+
+    while (1) {
+        while (idx < end && IS_WHITESPACE(buf[idx])) idx++;
+        if (idx == end)
+            break;
+        c = (unsigned char)buf[idx];
+        switch (s->state) {
+            case STREAM_VALUE:
+                break;
+            case STREAM_ARRAY_FIRST:
+                if (c != ']')
+                    break;
+                /* fall through */
+            case STREAM_ARRAY_NEXT:
+                if (c == ']') {
+                    idx++;
+                    if (stream_pop(s) < 0)
+                        goto bail;
+                }
+                else if (c == ',') {
+                    idx++;
+                    s->state = STREAM_VALUE;
+                }
+                else {
+                    stream_errmsg(s, "Expecting ',' delimiter", idx);
+                    goto bail;
+                }
+                continue;
+            case STREAM_OBJECT_FIRST:
+            case STREAM_OBJECT_KEY:
+                if (c == '}' && s->state == STREAM_OBJECT_FIRST) {
+                    idx++;
+                    if (stream_pop(s) < 0)
+                        goto bail;
+                    continue;
+                }
+                if (c != '"') {
+                    stream_errmsg(s, "Expecting property name enclosed in double quotes", idx);
+                    goto bail;
+                }
+                val = stream_scan_string(s, idx, final, &next_idx);
+                if (val == NULL) {
+                    if (PyErr_Occurred())
+                        goto bail;
+                    goto incomplete;
+                }
+                memokey = PyDict_GetItem(s->memo, val);
+                if (memokey != NULL) {
+                    Py_INCREF(memokey);
+                    Py_DECREF(val);
+                    val = memokey;
+                }
+                else if (PyDict_SetItem(s->memo, val, val) < 0) {
+                    Py_DECREF(val);
+                    goto bail;
+                }
+                s->stack[s->depth - 1].key = val;
+                s->state = STREAM_OBJECT_COLON;
+                idx = next_idx;
+                continue;
+            case STREAM_OBJECT_COLON:
+                if (c != ':') {
+                    stream_errmsg(s, "Expecting ':' delimiter", idx);
+                    goto bail;
+                }
+                idx++;
+                s->state = STREAM_VALUE;
+                continue;
+            case STREAM_OBJECT_NEXT:
+                if (c == '}') {
+                    idx++;
+                    if (stream_pop(s) < 0)
+                        goto bail;
+                }
+                else if (c == ',') {
+                    idx++;
+                    s->state = STREAM_OBJECT_KEY;
+                }
+                else {
+                    stream_errmsg(s, "Expecting ',' delimiter", idx);
+                    goto bail;
+                }
+                continue;
+        }
+
+        /* read any JSON term */
+        if (c == '{' || c == '[') {
+            idx++;
+            if (stream_push(s, c == '{') < 0)
+                goto bail;
+            continue;
+        }
+        val = stream_scan_term(s, idx, final, &next_idx);
+        if (val == NULL) {
+            if (PyErr_Occurred())
+                goto bail;
+            goto incomplete;
+        }
+        idx = next_idx;
+        if (stream_add_value(s, val) < 0)
+            goto bail;
+    }
+
+    if (final && s->depth > 0) {
+        stream_errmsg(s, stream_expecting[s->state], idx);
+        goto bail;
+    }
+
+incomplete:
+    stream_count_lines(buf, s->buf_start, idx, s->offset,
+                       &s->lineno, &s->linestart);
+    s->offset += idx - s->buf_start;
+    s->buf_start = idx;
+    return 0;
+bail:
+    return -1;
+}
+
+static int
+stream_append(PyStreamScannerObject *s, const char *data, Py_ssize_t len)
+{
+    /* Append a chunk to the unparsed bytes of the buffer */
+    Py_ssize_t pending = s->buf_len - s->buf_start;
+
+    /* Moving the pending bytes costs no more than parsing the consumed
+       ones did, even when a long string spans many chunks */
+    if (s->buf_start > 0 && s->buf_start >= pending) {
+        memmove(s->buf, s->buf + s->buf_start, pending);
+        s->buf_start = 0;
+        s->buf_len = pending;
+    }
+    if (len > s->buf_size - s->buf_len) {
+        Py_ssize_t size;
+        char *buf;
+        if (len > PY_SSIZE_T_MAX - s->buf_len) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        size = s->buf_len + len;
+        if (size <= PY_SSIZE_T_MAX - size / 2)
+            size += size / 2;
+        buf = PyMem_Realloc(s->buf, size);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        s->buf = buf;
+        s->buf_size = size;
+    }
+    memcpy(s->buf + s->buf_len, data, len);
+    s->buf_len += len;
+    return 0;
+}
+
+static PyObject *
+stream_run(PyStreamScannerObject *s, int final)
+{
+    /* Parse the buffer and return the list of completed values */
+    PyObject *values;
+    int rval;
+
+    if (s->running) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "stream scanner called from one of its hooks");
+        return NULL;
+    }
+    s->values = PyList_New(0);
+    if (s->values == NULL)
+        return NULL;
+    s->running = 1;
+    rval = stream_parse(s, final);
+    s->running = 0;
+    PyDict_Clear(s->memo);
+    values = s->values;
+    s->values = NULL;
+    if (rval < 0) {
+        Py_DECREF(values);
+        return NULL;
+    }
+    if (s->buf_start == s->buf_len)
+        s->buf_start = s->buf_len = 0;
+    return values;
+}
+
+PyDoc_STRVAR(stream_scanner_feed_doc,
+"feed(data) -> list\n"
+"\n"
+"Parse a chunk of UTF-8 encoded bytes and return the list of the values\n"
+"completed by it.");
+
+static PyObject *
+stream_scanner_feed(PyObject *self, PyObject *data)
+{
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+    Py_buffer view;
+    int rval;
+
+    if (s->closed) {
+        PyErr_SetString(PyExc_ValueError, "feed() called after close()");
+        return NULL;
+    }
+    if (s->running) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "stream scanner called from one of its hooks");
+        return NULL;
+    }
+    if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0)
+        return NULL;
+    rval = stream_append(s, view.buf, view.len);
+    PyBuffer_Release(&view);
+    if (rval < 0)
+        return NULL;
+    return stream_run(s, 0);
+}
+
+PyDoc_STRVAR(stream_scanner_close_doc,
+"close() -> list\n"
+"\n"
+"Mark the end of the stream and return the list of the values completed\n"
+"by it.  Raise JSONDecodeError if the stream ends inside a value.");
+
+static PyObject *
+stream_scanner_close(PyObject *self, PyObject *unused)
+{
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+    if (s->closed)
+        return PyList_New(0);
+    if (s->running) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "stream scanner called from one of its hooks");
+        return NULL;
+    }
+    s->closed = 1;
+    return stream_run(s, 1);
+}
+
+static PyMethodDef stream_scanner_methods[] = {
+    {"feed", (PyCFunction)stream_scanner_feed, METH_O, stream_scanner_feed_doc},
+    {"close", (PyCFunction)stream_scanner_close, METH_NOARGS, stream_scanner_close_doc},
+    {NULL, NULL}
+};
+
+static PyMemberDef stream_scanner_members[] = {
+    {"object_hook", T_OBJECT, offsetof(PyStreamScannerObject, object_hook), READONLY, "object_hook"},
+    {"object_pairs_hook", T_OBJECT, offsetof(PyStreamScannerObject, object_pairs_hook), READONLY},
+    {"parse_float", T_OBJECT, offsetof(PyStreamScannerObject, parse_float), READONLY, "parse_float"},
+    {"parse_int", T_OBJECT, offsetof(PyStreamScannerObject, parse_int), READONLY, "parse_int"},
+    {"parse_constant", T_OBJECT, offsetof(PyStreamScannerObject, parse_constant), READONLY, "parse_constant"},
+    {NULL}
+};
+
+static int
+stream_scanner_traverse(PyObject *self, visitproc visit, void *arg)
+{
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+    Py_ssize_t i;
+    Py_VISIT(s->object_hook);
+    Py_VISIT(s->object_pairs_hook);
+    Py_VISIT(s->parse_float);
+    Py_VISIT(s->parse_int);
+    Py_VISIT(s->parse_constant);
+    Py_VISIT(s->values);
+    for (i = 0; i < s->depth; i++) {
+        Py_VISIT(s->stack[i].container);
+        Py_VISIT(s->stack[i].key);
+    }
+    return 0;
+}
+
+static int
+stream_scanner_clear(PyObject *self)
+{
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+    Py_CLEAR(s->object_hook);
+    Py_CLEAR(s->object_pairs_hook);
+    Py_CLEAR(s->parse_float);
+    Py_CLEAR(s->parse_int);
+    Py_CLEAR(s->parse_constant);
+    Py_CLEAR(s->memo);
+    Py_CLEAR(s->values);
+    while (s->depth > 0) {
+        s->depth--;
+        Py_CLEAR(s->stack[s->depth].container);
+        Py_CLEAR(s->stack[s->depth].key);
+    }
+    return 0;
+}
+
+static void
+stream_scanner_dealloc(PyObject *self)
+{
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+    PyObject_GC_UnTrack(self);
+    stream_scanner_clear(self);
+    PyMem_Free(s->stack);
+    PyMem_Free(s->buf);
+    Py_TYPE(self)->tp_free(self);
+}
+
+static int
+stream_scanner_init(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    /* Initialize StreamScanner object */
+    PyObject *ctx;
+    PyObject *strict;
+    int items = 0;
+    static char *kwlist[] = {"context", "items", NULL};
+    PyStreamScannerObject *s = (PyStreamScannerObject *)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|p:make_stream_scanner",
+                                     kwlist, &ctx, &items))
+        return -1;
+    if (s->memo != NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "stream scanner is already initialized");
+        return -1;
+    }
+
+    strict = PyObject_GetAttrString(ctx, "strict");
+    if (strict == NULL)
+        return -1;
+    s->strict = PyObject_IsTrue(strict);
+    Py_DECREF(strict);
+    if (s->strict < 0)
+        return -1;
+    s->items = items;
+    s->lineno = 1;
+
+    s->memo = PyDict_New();
+    if (s->memo == NULL)
+        goto bail;
+    s->object_hook = PyObject_GetAttrString(ctx, "object_hook");
+    if (s->object_hook == NULL)
+        goto bail;
+    s->object_pairs_hook = PyObject_GetAttrString(ctx, "object_pairs_hook");
+    if (s->object_pairs_hook == NULL)
+        goto bail;
+    s->parse_float = PyObject_GetAttrString(ctx, "parse_float");
+    if (s->parse_float == NULL)
+        goto bail;
+    s->parse_int = PyObject_GetAttrString(ctx, "parse_int");
+    if (s->parse_int == NULL)
+        goto bail;
+    s->parse_constant = PyObject_GetAttrString(ctx, "parse_constant");
+    if (s->parse_constant == NULL)
+        goto bail;
+
+    return 0;
+
+bail:
+    stream_scanner_clear(self);
+    return -1;
+}
+
+PyDoc_STRVAR(stream_scanner_doc, "Incremental JSON scanner object");
+
+static
+PyTypeObject PyStreamScannerType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_json.StreamScanner",  /* tp_name */
+    sizeof(PyStreamScannerObject), /* tp_basicsize */
+    0,                    /* tp_itemsize */
+    stream_scanner_dealloc, /* tp_dealloc */
+    0,                    /* tp_print */
+    0,                    /* tp_getattr */
+    0,                    /* tp_setattr */
+    0,                    /* tp_compare */
+    0,                    /* tp_repr */
+    0,                    /* tp_as_number */
+    0,                    /* tp_as_sequence */
+    0,                    /* tp_as_mapping */
+    0,                    /* tp_hash */
+    0,                    /* tp_call */
+    0,                    /* tp_str */
+    0,                    /* tp_getattro */
+    0,                    /* tp_setattro */
+    0,                    /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,   /* tp_flags */
+    stream_scanner_doc,   /* tp_doc */
+    stream_scanner_traverse, /* tp_traverse */
+    stream_scanner_clear, /* tp_clear */
+    0,                    /* tp_richcompare */
+    0,                    /* tp_weaklistoffset */
+    0,                    /* tp_iter */
+    0,                    /* tp_iternext */
+    stream_scanner_methods, /* tp_methods */
+    stream_scanner_members, /* tp_members */
+    0,                    /* tp_getset */
+    0,                    /* tp_base */
+    0,                    /* tp_dict */
+    0,                    /* tp_descr_get */
+    0,                    /* tp_descr_set */
+    0,                    /* tp_dictoffset */
+    stream_scanner_init,  /* tp_init */
+    0,                    /* tp_alloc */
+    0,                    /* tp_new */
+    0,                    /* tp_free */
+};
+
 static PyObject *
 encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
@@ -1989,6 +2967,9 @@ PyInit__json(void)
     PyScannerType.tp_new = PyType_GenericNew;
     if (PyType_Ready(&PyScannerType) < 0)
         goto fail;
+    PyStreamScannerType.tp_new = PyType_GenericNew;
+    if (PyType_Ready(&PyStreamScannerType) < 0)
+        goto fail;
     PyEncoderType.tp_new = PyType_GenericNew;
     if (PyType_Ready(&PyEncoderType) < 0)
         goto fail;
@@ -1997,6 +2978,11 @@ PyInit__json(void)
         Py_DECREF((PyObject*)&PyScannerType);
         goto fail;
     }
+    Py_INCREF((PyObject*)&PyStreamScannerType);
+    if (PyModule_AddObject(m, "make_stream_scanner", (PyObject*)&PyStreamScannerType) < 0) {
+        Py_DECREF((PyObject*)&PyStreamScannerType);
+        goto fail;
+    }
     Py_INCREF((PyObject*)&PyEncoderType);
     if (PyModule_AddObject(m, "make_encoder", (PyObject*)&PyEncoderType) < 0) {
         Py_DECREF((PyObject*)&PyEncoderType);
@@ -10,12 +10,13 @@ class _pickle.Pickler "PicklerObject *" "&Pickler_Type"
 class _pickle.PicklerMemoProxy "PicklerMemoProxyObject *" "&PicklerMemoProxyType"
 class _pickle.Unpickler "UnpicklerObject *" "&Unpickler_Type"
 class _pickle.UnpicklerMemoProxy "UnpicklerMemoProxyObject *" "&UnpicklerMemoProxyType"
+class _pickle.PickleBuffer "PickleBufferObject *" "&PickleBuffer_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=4b3e113468a58e6c]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=af7eea402f102bcb]*/
 
 /* Bump this when new opcodes are added to the pickle protocol. */
 enum {
-    HIGHEST_PROTOCOL = 4,
+    HIGHEST_PROTOCOL = 5,
     DEFAULT_PROTOCOL = 3
 };
 
@@ -92,7 +93,12 @@ enum opcode {
     NEWOBJ_EX        = '\x92',
     STACK_GLOBAL     = '\x93',
     MEMOIZE          = '\x94',
-    FRAME            = '\x95'
+    FRAME            = '\x95',
+
+    /* Protocol 5 */
+    BYTEARRAY8       = '\x96',
+    NEXT_BUFFER      = '\x97',
+    READONLY_BUFFER  = '\x98'
 };
 
 enum {
@@ -566,6 +572,8 @@ typedef struct PicklerObject {
     int fix_imports;            /* Indicate whether Pickler should fix
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
+    PyObject *buffer_callback;  /* Callback deciding whether PickleBuffers
+                                   are written out-of-band, can be NULL. */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -604,6 +612,8 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    PyObject *buffers;          /* Iterator over the out-of-band buffers,
+                                   can be NULL. */
 } UnpicklerObject;
 
 typedef struct {
@@ -616,11 +626,19 @@ typedef struct {
     UnpicklerObject *unpickler;
 } UnpicklerMemoProxyObject;
 
+typedef struct {
+    PyObject_HEAD
+    Py_buffer view;             /* Buffer of the wrapped object, view.obj is
+                                   NULL once the PickleBuffer is released. */
+    PyObject *weakreflist;
+} PickleBufferObject;
+
 /* Forward declarations */
 static int save(PicklerObject *, PyObject *, int);
 static int save_reduce(PicklerObject *, PyObject *, PyObject *);
 static PyTypeObject Pickler_Type;
 static PyTypeObject Unpickler_Type;
+static PyTypeObject PickleBuffer_Type;
 
 #include "clinic/_pickle.c.h"
 
@@ -842,6 +860,194 @@ PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
 #undef MT_MINSIZE
 #undef PERTURB_SHIFT
 
+/*************************************************************************
+ PickleBuffer wraps an object exporting the buffer protocol.  With protocol
+ 5 the pickler writes its data without going through __reduce_ex__(), and
+ the buffer_callback can have it transferred out-of-band instead of being
+ copied into the pickle. */
+
+static int
+PickleBuffer_CheckReleased(PickleBufferObject *self)
+{
+    if (self->view.obj == NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "operation forbidden on released PickleBuffer object");
+        return -1;
+    }
+    return 0;
+}
+
+/*[clinic input]
+@classmethod
+_pickle.PickleBuffer.__new__
+
+  obj: object
+  /
+
+Wrapper for potentially out-of-band buffers.
+
+Pickling a PickleBuffer with protocol 5 writes the data of the buffer
+exported by *obj*, or hands it to the pickler's buffer_callback.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_impl(PyTypeObject *type, PyObject *obj)
+/*[clinic end generated code: output=2d21ce3531eb84e0 input=85a5a3935ae318dc]*/
+{
+    PickleBufferObject *self;
+
+    self = (PickleBufferObject *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+    self->weakreflist = NULL;
+    if (PyObject_GetBuffer(obj, &self->view, PyBUF_FULL_RO) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+/*[clinic input]
+_pickle.PickleBuffer.raw
+
+Return a memoryview of the raw memory underlying this buffer.
+
+Raise BufferError if the buffer isn't contiguous.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_raw_impl(PickleBufferObject *self)
+/*[clinic end generated code: output=c78b3fd04355aba5 input=ed5127ea06de6757]*/
+{
+    PyObject *result;
+    PyMemoryViewObject *mv;
+
+    if (PickleBuffer_CheckReleased(self) < 0)
+        return NULL;
+    if (self->view.suboffsets != NULL ||
+        !PyBuffer_IsContiguous(&self->view, 'A')) {
+        PyErr_SetString(PyExc_BufferError,
+                        "cannot extract raw buffer from non-contiguous buffer");
+        return NULL;
+    }
+    result = PyMemoryView_FromObject((PyObject *)self);
+    if (result == NULL)
+        return NULL;
+    /* Turn it into a one-dimensional view of unsigned bytes. */
+    mv = (PyMemoryViewObject *)result;
+    mv->view.format = "B";
+    mv->view.itemsize = 1;
+    mv->view.ndim = 1;
+    mv->view.shape = &mv->view.len;
+    mv->view.strides = &mv->view.itemsize;
+    mv->view.suboffsets = NULL;
+    mv->flags = _Py_MEMORYVIEW_C | _Py_MEMORYVIEW_FORTRAN;
+    return result;
+}
+
+/*[clinic input]
+_pickle.PickleBuffer.release
+
+Release the underlying buffer exposed by the PickleBuffer object.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_release_impl(PickleBufferObject *self)
+/*[clinic end generated code: output=cc7900aaba67e761 input=b9a5e91e3bdd0dc7]*/
+{
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    Py_RETURN_NONE;
+}
+
+static int
+PickleBuffer_getbuffer(PickleBufferObject *self, Py_buffer *view, int flags)
+{
+    if (PickleBuffer_CheckReleased(self) < 0)
+        return -1;
+    return PyObject_GetBuffer(self->view.obj, view, flags);
+}
+
+static int
+PickleBuffer_traverse(PickleBufferObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->view.obj);
+    return 0;
+}
+
+static int
+PickleBuffer_clear(PickleBufferObject *self)
+{
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    return 0;
+}
+
+static void
+PickleBuffer_dealloc(PickleBufferObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    if (self->weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)self);
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyBufferProcs PickleBuffer_as_buffer = {
+    (getbufferproc)PickleBuffer_getbuffer,  /* bf_getbuffer */
+    NULL,                                   /* bf_releasebuffer */
+};
+
+static PyMethodDef PickleBuffer_methods[] = {
+    _PICKLE_PICKLEBUFFER_RAW_METHODDEF
+    _PICKLE_PICKLEBUFFER_RELEASE_METHODDEF
+    {NULL, NULL}                /* sentinel */
+};
+
+static PyTypeObject PickleBuffer_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "pickle.PickleBuffer",              /*tp_name*/
+    sizeof(PickleBufferObject),         /*tp_basicsize*/
+    0,                                  /*tp_itemsize*/
+    (destructor)PickleBuffer_dealloc,   /*tp_dealloc*/
+    0,                                  /*tp_print*/
+    0,                                  /*tp_getattr*/
+    0,                                  /*tp_setattr*/
+    0,                                  /*tp_reserved*/
+    0,                                  /*tp_repr*/
+    0,                                  /*tp_as_number*/
+    0,                                  /*tp_as_sequence*/
+    0,                                  /*tp_as_mapping*/
+    0,                                  /*tp_hash*/
+    0,                                  /*tp_call*/
+    0,                                  /*tp_str*/
+    0,                                  /*tp_getattro*/
+    0,                                  /*tp_setattro*/
+    &PickleBuffer_as_buffer,            /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    _pickle_PickleBuffer__doc__,        /*tp_doc*/
+    (traverseproc)PickleBuffer_traverse,    /*tp_traverse*/
+    (inquiry)PickleBuffer_clear,        /*tp_clear*/
+    0,                                  /*tp_richcompare*/
+    offsetof(PickleBufferObject, weakreflist), /*tp_weaklistoffset*/
+    0,                                  /*tp_iter*/
+    0,                                  /*tp_iternext*/
+    PickleBuffer_methods,               /*tp_methods*/
+    0,                                  /*tp_members*/
+    0,                                  /*tp_getset*/
+    0,                                  /*tp_base*/
+    0,                                  /*tp_dict*/
+    0,                                  /*tp_descr_get*/
+    0,                                  /*tp_descr_set*/
+    0,                                  /*tp_dictoffset*/
+    0,                                  /*tp_init*/
+    0,                                  /*tp_alloc*/
+    _pickle_PickleBuffer,               /*tp_new*/
+    0,                                  /*tp_free*/
+    0,                                  /*tp_is_gc*/
+};
+
 /*************************************************************************/
 
 
@@ -1013,6 +1219,7 @@ _Pickler_New(void)
     self->fast_nesting = 0;
     self->fix_imports = 0;
     self->fast_memo = NULL;
+    self->buffer_callback = NULL;
     self->max_output_len = WRITE_BUF_SIZE;
     self->output_len = 0;
 
@@ -1054,6 +1261,22 @@ _Pickler_SetProtocol(PicklerObject *self, PyObject *protocol, int fix_imports)
     return 0;
 }
 
+/* Must be called after _Pickler_SetProtocol(). */
+static int
+_Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
+{
+    if (buffer_callback == Py_None)
+        buffer_callback = NULL;
+    if (buffer_callback != NULL && self->proto < 5) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer_callback needs protocol >= 5");
+        return -1;
+    }
+    Py_XINCREF(buffer_callback);
+    self->buffer_callback = buffer_callback;
+    return 0;
+}
+
 /* Returns -1 (with an exception set) on failure, 0 on success. This may
    be called once on a freshly created Pickler. */
 static int
@@ -1376,6 +1599,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->buffers = NULL;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -1441,6 +1665,22 @@ _Unpickler_SetInputEncoding(UnpicklerObject *self,
     return 0;
 }
 
+/* Returns -1 (with an exception set) on failure, 0 on success. This may
+   be called once on a freshly created Unpickler. */
+static int
+_Unpickler_SetBuffers(UnpicklerObject *self, PyObject *buffers)
+{
+    if (buffers == NULL || buffers == Py_None) {
+        self->buffers = NULL;
+    }
+    else {
+        self->buffers = PyObject_GetIter(buffers);
+        if (self->buffers == NULL)
+            return -1;
+    }
+    return 0;
+}
+
 /* Generate a GET opcode for an object stored in the memo. */
 static int
 memo_get(PicklerObject *self, PyObject *key)
@@ -1998,6 +2238,49 @@ done:
     return 0;
 }
 
+static int
+_save_bytes_data(PicklerObject *self, PyObject *obj, const char *data,
+                 Py_ssize_t size)
+{
+    char header[9];
+    Py_ssize_t len;
+
+    if (size <= 0xff) {
+        header[0] = SHORT_BINBYTES;
+        header[1] = (unsigned char)size;
+        len = 2;
+    }
+    else if ((size_t)size <= 0xffffffffUL) {
+        header[0] = BINBYTES;
+        header[1] = (unsigned char)(size & 0xff);
+        header[2] = (unsigned char)((size >> 8) & 0xff);
+        header[3] = (unsigned char)((size >> 16) & 0xff);
+        header[4] = (unsigned char)((size >> 24) & 0xff);
+        len = 5;
+    }
+    else if (self->proto >= 4) {
+        header[0] = BINBYTES8;
+        _write_size64(header + 1, size);
+        len = 9;
+    }
+    else {
+        PyErr_SetString(PyExc_OverflowError,
+                        "cannot serialize a bytes object larger than 4 GiB");
+        return -1;          /* string too large */
+    }
+
+    if (_Pickler_Write(self, header, len) < 0)
+        return -1;
+
+    if (_Pickler_Write(self, data, size) < 0)
+        return -1;
+
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
 static int
 save_bytes(PicklerObject *self, PyObject *obj)
 {
@@ -2044,49 +2327,97 @@ save_bytes(PicklerObject *self, PyObject *obj)
         return status;
     }
     else {
-        Py_ssize_t size;
-        char header[9];
-        Py_ssize_t len;
+        return _save_bytes_data(self, obj, PyBytes_AS_STRING(obj),
+                                PyBytes_GET_SIZE(obj));
+    }
+}
 
-        size = PyBytes_GET_SIZE(obj);
-        if (size < 0)
-            return -1;
+static int
+_save_bytearray_data(PicklerObject *self, PyObject *obj, const char *data,
+                     Py_ssize_t size)
+{
+    char header[9];
 
-        if (size <= 0xff) {
-            header[0] = SHORT_BINBYTES;
-            header[1] = (unsigned char)size;
-            len = 2;
-        }
-        else if ((size_t)size <= 0xffffffffUL) {
-            header[0] = BINBYTES;
-            header[1] = (unsigned char)(size & 0xff);
-            header[2] = (unsigned char)((size >> 8) & 0xff);
-            header[3] = (unsigned char)((size >> 16) & 0xff);
-            header[4] = (unsigned char)((size >> 24) & 0xff);
-            len = 5;
-        }
-        else if (self->proto >= 4) {
-            header[0] = BINBYTES8;
-            _write_size64(header + 1, size);
-            len = 9;
-        }
-        else {
-            PyErr_SetString(PyExc_OverflowError,
-                            "cannot serialize a bytes object larger than 4 GiB");
-            return -1;          /* string too large */
-        }
+    header[0] = BYTEARRAY8;
+    _write_size64(header + 1, size);
 
-        if (_Pickler_Write(self, header, len) < 0)
-            return -1;
+    if (_Pickler_Write(self, header, 9) < 0)
+        return -1;
+
+    if (_Pickler_Write(self, data, size) < 0)
+        return -1;
+
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
+/* Protocol 5 has an opcode for bytearray objects, older protocols pickle
+   them with __reduce_ex__(). */
+static int
+save_bytearray(PicklerObject *self, PyObject *obj)
+{
+    return _save_bytearray_data(self, obj, PyByteArray_AS_STRING(obj),
+                                PyByteArray_GET_SIZE(obj));
+}
 
-        if (_Pickler_Write(self, PyBytes_AS_STRING(obj), size) < 0)
+static int
+save_picklebuffer(PicklerObject *self, PyObject *obj)
+{
+    PickleState *st = _Pickle_GetGlobalState();
+    const Py_buffer *view = &((PickleBufferObject *)obj)->view;
+    int in_band = 1;
+
+    if (self->proto < 5) {
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can only be pickled with protocol >= 5");
+        return -1;
+    }
+    if (PickleBuffer_CheckReleased((PickleBufferObject *)obj) < 0)
+        return -1;
+    if (view->suboffsets != NULL || !PyBuffer_IsContiguous(view, 'A')) {
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can not be pickled when pointing to a "
+                        "non-contiguous buffer");
+        return -1;
+    }
+    if (self->buffer_callback != NULL) {
+        PyObject *ret;
+
+        Py_INCREF(obj);
+        ret = _Pickle_FastCall(self->buffer_callback, obj);
+        if (ret == NULL)
+            return -1;
+        in_band = PyObject_IsTrue(ret);
+        Py_DECREF(ret);
+        if (in_band < 0)
+            return -1;
+    }
+    if (in_band) {
+        /* The callback may have released the buffer. */
+        if (PickleBuffer_CheckReleased((PickleBufferObject *)obj) < 0)
             return -1;
+        if (view->readonly)
+            return _save_bytes_data(self, obj, view->buf, view->len);
+        else
+            return _save_bytearray_data(self, obj, view->buf, view->len);
+    }
+    else {
+        /* Only write a reference to the buffer, which the unpickler gets
+           from its buffers argument. */
+        const char next_buffer_op = NEXT_BUFFER;
+        const char readonly_buffer_op = READONLY_BUFFER;
 
+        if (_Pickler_Write(self, &next_buffer_op, 1) < 0)
+            return -1;
+        if (view->readonly &&
+            _Pickler_Write(self, &readonly_buffer_op, 1) < 0)
+            return -1;
         if (memo_put(self, obj) < 0)
             return -1;
-
-        return 0;
     }
+    return 0;
 }
 
 /* A copy of PyUnicode_EncodeRawUnicodeEscape() that also translates
@@ -3767,6 +4098,14 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
         status = save_bytes(self, obj);
         goto done;
     }
+    else if (type == &PyByteArray_Type && self->proto >= 5) {
+        status = save_bytearray(self, obj);
+        goto done;
+    }
+    else if (type == &PickleBuffer_Type) {
+        status = save_picklebuffer(self, obj);
+        goto done;
+    }
     else if (type == &PyUnicode_Type) {
         status = save_unicode(self, obj);
         goto done;
@@ -4043,6 +4382,7 @@ Pickler_dealloc(PicklerObject *self)
     Py_XDECREF(self->pers_func);
     Py_XDECREF(self->dispatch_table);
     Py_XDECREF(self->fast_memo);
+    Py_XDECREF(self->buffer_callback);
 
     PyMemoTable_Del(self->memo);
 
@@ -4056,6 +4396,7 @@ Pickler_traverse(PicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->pers_func);
     Py_VISIT(self->dispatch_table);
     Py_VISIT(self->fast_memo);
+    Py_VISIT(self->buffer_callback);
     return 0;
 }
 
@@ -4067,6 +4408,7 @@ Pickler_clear(PicklerObject *self)
     Py_CLEAR(self->pers_func);
     Py_CLEAR(self->dispatch_table);
     Py_CLEAR(self->fast_memo);
+    Py_CLEAR(self->buffer_callback);
 
     if (self->memo != NULL) {
         PyMemoTable *memo = self->memo;
@@ -4084,11 +4426,12 @@ _pickle.Pickler.__init__
   file: object
   protocol: object = NULL
   fix_imports: bool = True
+  buffer_callback: object = None
 
 This takes a binary file for writing a pickle data stream.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -4103,12 +4446,20 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is None (the default), the data of PickleBuffer
+objects is written to *file* as part of the pickle stream.  Otherwise
+it is called with each PickleBuffer: if it returns a false value, the
+buffer is out-of-band and only a reference to it is pickled; it must
+then be given to the unpickler through its *buffers* argument.  A
+*buffer_callback* needs protocol 5 or higher.
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
-                              PyObject *protocol, int fix_imports)
-/*[clinic end generated code: output=b5f31078dab17fb0 input=b8cdeb7e3f5ee674]*/
+                              PyObject *protocol, int fix_imports,
+                              PyObject *buffer_callback)
+/*[clinic end generated code: output=0abedc50590d259b input=0c21bfb863f22ee5]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4120,6 +4471,9 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetProtocol(self, protocol, fix_imports) < 0)
         return -1;
 
+    if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
+        return -1;
+
     if (_Pickler_SetOutputStream(self, file) < 0)
         return -1;
 
@@ -4921,6 +5275,86 @@ load_counted_binbytes(UnpicklerObject *self, int nbytes)
     return 0;
 }
 
+static int
+load_counted_bytearray(UnpicklerObject *self)
+{
+    PyObject *bytearray;
+    Py_ssize_t size;
+    char *s;
+
+    if (_Unpickler_Read(self, &s, 8) < 0)
+        return -1;
+
+    size = calc_binsize(s, 8);
+    if (size < 0) {
+        PyErr_Format(PyExc_OverflowError,
+                     "BYTEARRAY8 exceeds system's maximum size of %zd bytes",
+                     PY_SSIZE_T_MAX);
+        return -1;
+    }
+
+    if (_Unpickler_Read(self, &s, size) < 0)
+        return -1;
+
+    bytearray = PyByteArray_FromStringAndSize(s, size);
+    if (bytearray == NULL)
+        return -1;
+
+    PDATA_PUSH(self->stack, bytearray, -1);
+    return 0;
+}
+
+static int
+load_next_buffer(UnpicklerObject *self)
+{
+    PyObject *buf;
+
+    if (self->buffers == NULL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->UnpicklingError,
+                        "pickle stream refers to out-of-band data "
+                        "but no *buffers* argument was given");
+        return -1;
+    }
+    buf = PyIter_Next(self->buffers);
+    if (buf == NULL) {
+        if (!PyErr_Occurred()) {
+            PickleState *st = _Pickle_GetGlobalState();
+            PyErr_SetString(st->UnpicklingError,
+                            "not enough out-of-band buffers");
+        }
+        return -1;
+    }
+
+    PDATA_PUSH(self->stack, buf, -1);
+    return 0;
+}
+
+static int
+load_readonly_buffer(UnpicklerObject *self)
+{
+    PyObject *obj, *view;
+    Py_ssize_t len;
+
+    if ((len = Py_SIZE(self->stack)) <= 0)
+        return stack_underflow();
+
+    obj = self->stack->data[len - 1];
+    view = PyMemoryView_FromObject(obj);
+    if (view == NULL)
+        return -1;
+    if (!PyMemoryView_GET_BUFFER(view)->readonly) {
+        /* Replace the writable buffer by a read-only view of it. */
+        PyMemoryView_GET_BUFFER(view)->readonly = 1;
+        self->stack->data[len - 1] = view;
+        Py_DECREF(obj);
+    }
+    else {
+        Py_DECREF(view);
+    }
+    return 0;
+}
+
 static int
 load_unicode(UnpicklerObject *self)
 {
@@ -4982,6 +5416,7 @@ load_tuple(UnpicklerObject *self)
     tuple = Pdata_poptuple(self->stack, i);
     if (tuple == NULL)
         return -1;
+    _PyTuple_MaybeUntrack(tuple);
     PDATA_PUSH(self->stack, tuple, -1);
     return 0;
 }
@@ -5003,6 +5438,7 @@ load_counted_tuple(UnpicklerObject *self, int len)
             return -1;
         PyTuple_SET_ITEM(tuple, len, item);
     }
+    _PyTuple_MaybeUntrack(tuple);
     PDATA_PUSH(self->stack, tuple, -1);
     return 0;
 }
@@ -5014,6 +5450,8 @@ load_empty_list(UnpicklerObject *self)
 
     if ((list = PyList_New(0)) == NULL)
         return -1;
+    /* tracked again by the appends if they add containers */
+    _PyList_MaybeUntrack(list);
     PDATA_PUSH(self->stack, list, -1);
     return 0;
 }
@@ -5052,6 +5490,7 @@ load_list(UnpicklerObject *self)
     list = Pdata_poplist(self->stack, i);
     if (list == NULL)
         return -1;
+    _PyList_MaybeUntrack(list);
     PDATA_PUSH(self->stack, list, -1);
     return 0;
 }
@@ -6167,6 +6606,9 @@ load(UnpicklerObject *self)
         OP_ARG(SHORT_BINBYTES, load_counted_binbytes, 1)
         OP_ARG(BINBYTES, load_counted_binbytes, 4)
         OP_ARG(BINBYTES8, load_counted_binbytes, 8)
+        OP(BYTEARRAY8, load_counted_bytearray)
+        OP(NEXT_BUFFER, load_next_buffer)
+        OP(READONLY_BUFFER, load_readonly_buffer)
         OP_ARG(SHORT_BINSTRING, load_counted_binstring, 1)
         OP_ARG(BINSTRING, load_counted_binstring, 4)
         OP(STRING, load_string)
@@ -6433,6 +6875,7 @@ Unpickler_dealloc(UnpicklerObject *self)
     Py_XDECREF(self->peek);
     Py_XDECREF(self->stack);
     Py_XDECREF(self->pers_func);
+    Py_XDECREF(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6455,6 +6898,7 @@ Unpickler_traverse(UnpicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->peek);
     Py_VISIT(self->stack);
     Py_VISIT(self->pers_func);
+    Py_VISIT(self->buffers);
     return 0;
 }
 
@@ -6466,6 +6910,7 @@ Unpickler_clear(UnpicklerObject *self)
     Py_CLEAR(self->peek);
     Py_CLEAR(self->stack);
     Py_CLEAR(self->pers_func);
+    Py_CLEAR(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6493,6 +6938,7 @@ _pickle.Unpickler.__init__
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = None
 
 This takes a binary file for reading a pickle data stream.
 
@@ -6514,13 +6960,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream refers to an out-of-band
+buffer.  These are the buffers that the pickler's *buffer_callback*
+was called with, in the same order.
 [clinic start generated code]*/
 
 static int
 _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
                                 int fix_imports, const char *encoding,
-                                const char *errors)
-/*[clinic end generated code: output=e2c8ce748edc57b0 input=30b4dc9e976b890c]*/
+                                const char *errors, PyObject *buffers)
+/*[clinic end generated code: output=09f0192649ea3f85 input=771efe3fc3750a96]*/
 {
     _Py_IDENTIFIER(persistent_load);
 
@@ -6534,6 +6985,9 @@ _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
     if (_Unpickler_SetInputEncoding(self, encoding, errors) < 0)
         return -1;
 
+    if (_Unpickler_SetBuffers(self, buffers) < 0)
+        return -1;
+
     self->fix_imports = fix_imports;
     if (self->fix_imports == -1)
         return -1;
@@ -6923,6 +7377,7 @@ _pickle.dump
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = None
 
 Write a pickled representation of obj to the open file object file.
 
@@ -6930,7 +7385,7 @@ This is equivalent to ``Pickler(file, protocol).dump(obj)``, but may
 be more efficient.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -6945,12 +7400,17 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None, it is called with each PickleBuffer
+and the buffer is out-of-band when it returns a false value, see the
+Pickler class.  A *buffer_callback* needs protocol 5 or higher.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file,
-                  PyObject *protocol, int fix_imports)
-/*[clinic end generated code: output=0de7dff89c406816 input=e9e5fdd48de92eae]*/
+                  PyObject *protocol, int fix_imports,
+                  PyObject *buffer_callback)
+/*[clinic end generated code: output=656982757518cedd input=f48381bd76f78285]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -6960,6 +7420,9 @@ _pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+
     if (_Pickler_SetOutputStream(pickler, file) < 0)
         goto error;
 
@@ -6985,11 +7448,12 @@ _pickle.dumps
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = None
 
 Return the pickled representation of the object as a bytes object.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -6999,12 +7463,16 @@ version of Python needed to read the pickle produced.
 If *fix_imports* is True and *protocol* is less than 3, pickle will
 try to map the new Python 3 names to the old module names used in
 Python 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None, it is called with each PickleBuffer
+and the buffer is out-of-band when it returns a false value, see the
+Pickler class.  A *buffer_callback* needs protocol 5 or higher.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports)
-/*[clinic end generated code: output=daa380db56fe07b9 input=293dbeda181580b7]*/
+                   int fix_imports, PyObject *buffer_callback)
+/*[clinic end generated code: output=0addcbb129aa1757 input=0d26ba79c933ec30]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7015,6 +7483,9 @@ _pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7036,6 +7507,7 @@ _pickle.load
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = None
 
 Read and return an object from the pickle data stored in a file.
 
@@ -7060,12 +7532,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream refers to an out-of-band
+buffer.  These are the buffers that the pickler's *buffer_callback*
+was called with, in the same order.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports,
-                  const char *encoding, const char *errors)
-/*[clinic end generated code: output=798f1c57cb2b4eb1 input=da97372e38e510a6]*/
+                  const char *encoding, const char *errors,
+                  PyObject *buffers)
+/*[clinic end generated code: output=f9bb8e33cd94b07f input=027324182a3a158f]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7079,6 +7557,9 @@ _pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports,
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7099,6 +7580,7 @@ _pickle.loads
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = None
 
 Read and return an object from the given pickle data.
 
@@ -7114,12 +7596,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream refers to an out-of-band
+buffer.  These are the buffers that the pickler's *buffer_callback*
+was called with, in the same order.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports,
-                   const char *encoding, const char *errors)
-/*[clinic end generated code: output=61e9cdb01e36a736 input=f57f0fdaa2b4cb8b]*/
+                   const char *encoding, const char *errors,
+                   PyObject *buffers)
+/*[clinic end generated code: output=26822276b4a79405 input=dd3b2a9d7643f015]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7133,6 +7621,9 @@ _pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports,
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7219,6 +7710,8 @@ PyInit__pickle(void)
         return NULL;
     if (PyType_Ready(&UnpicklerMemoProxyType) < 0)
         return NULL;
+    if (PyType_Ready(&PickleBuffer_Type) < 0)
+        return NULL;
 
     /* Create the module and add the functions. */
     m = PyModule_Create(&_picklemodule);
@@ -7231,6 +7724,10 @@ PyInit__pickle(void)
     Py_INCREF(&Unpickler_Type);
     if (PyModule_AddObject(m, "Unpickler", (PyObject *)&Unpickler_Type) < 0)
         return NULL;
+    Py_INCREF(&PickleBuffer_Type);
+    if (PyModule_AddObject(m, "PickleBuffer",
+                           (PyObject *)&PickleBuffer_Type) < 0)
+        return NULL;
 
     st = _Pickle_GetState(m);
 
@@ -183,6 +183,23 @@ test_list_api(PyObject *self)
     return Py_None;
 }
 
+/* Store an item in a list with PyList_SetItem(), which tracks a list
+   untracked by the GC again when the item may take part in a cycle. */
+static PyObject *
+list_setitem(PyObject *self, PyObject *args)
+{
+    PyObject *list, *item;
+    Py_ssize_t index;
+
+    if (!PyArg_ParseTuple(args, "O!nO:list_setitem",
+                          &PyList_Type, &list, &index, &item))
+        return NULL;
+    Py_INCREF(item);
+    if (PyList_SetItem(list, index, item) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
 static int
 test_dict_inner(int count)
 {
@@ -3514,6 +3531,7 @@ static PyMethodDef TestMethods[] = {
     {"test_sizeof_c_types",     (PyCFunction)test_sizeof_c_types, METH_NOARGS},
     {"test_datetime_capi",  test_datetime_capi,              METH_NOARGS},
     {"test_list_api",           (PyCFunction)test_list_api,      METH_NOARGS},
+    {"list_setitem",            list_setitem,                    METH_VARARGS},
     {"test_dict_iteration",     (PyCFunction)test_dict_iteration,METH_NOARGS},
     {"test_lazy_hash_inheritance",      (PyCFunction)test_lazy_hash_inheritance,METH_NOARGS},
     {"test_long_api",           (PyCFunction)test_long_api,      METH_NOARGS},
@@ -26,6 +26,15 @@
 #include "Python.h"
 #include "frameobject.h"        /* for PyFrame_ClearFreeList */
 #include "pytime.h"             /* for _PyTime_GetMonotonicClock() */
+#ifdef WITH_THREAD
+#include "pythread.h"           /* for the threads of parallel collection */
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>             /* for _InterlockedExchangeAdd() */
+#endif
+#ifdef MS_WINDOWS
+#include <windows.h>            /* for GetSystemInfo() */
+#endif
 
 /* Get an object's GC head */
 #define AS_GC(o) ((PyGC_Head *)(o)-1)
@@ -40,6 +49,8 @@ struct gc_generation {
     int threshold; /* collection threshold */
     int count; /* count of allocations or collections of younger
                   generations */
+    int base_threshold; /* threshold set by gc.set_threshold(), which the
+                           adaptive policy scales */
 };
 
 #define NUM_GENERATIONS 3
@@ -47,10 +58,10 @@ struct gc_generation {
 
 /* linked lists of container objects */
 static struct gc_generation generations[NUM_GENERATIONS] = {
-    /* PyGC_Head,                               threshold,      count */
-    {{{GEN_HEAD(0), GEN_HEAD(0), 0}},           700,            0},
-    {{{GEN_HEAD(1), GEN_HEAD(1), 0}},           10,             0},
-    {{{GEN_HEAD(2), GEN_HEAD(2), 0}},           10,             0},
+    /* PyGC_Head,                       threshold,  count,  base_threshold */
+    {{{GEN_HEAD(0), GEN_HEAD(0), 0}},   700,        0,      700},
+    {{{GEN_HEAD(1), GEN_HEAD(1), 0}},   10,         0,      10},
+    {{{GEN_HEAD(2), GEN_HEAD(2), 0}},   10,         0,      10},
 };
 
 PyGC_Head *_PyGC_generation0 = GEN_HEAD(0);
@@ -117,6 +128,77 @@ static Py_ssize_t long_lived_pending = 0;
     http://mail.python.org/pipermail/python-dev/2008-June/080579.html
 */
 
+/*
+   NOTE: about incremental collection.
+
+   A full collection examines every tracked object at once, so its pause
+   grows with the heap.  When incremental collection is enabled with
+   gc.set_incremental(), the collections of the oldest generation that
+   collect_generations() would run are replaced by "passes", each made of
+   bounded increments run after the young collections that follow.
+
+   An increment takes the oldest objects of the oldest generation (the
+   "pending" objects of the pass), adds the not yet visited objects they
+   refer to, transitively, until its budget is used, and runs the usual
+   collection on that set.  Collecting any subset of the objects is sound:
+   update_refs() and subtract_refs() leave every object referenced from
+   outside the subset with gc_refs > 0, whatever the mutator did between
+   two increments, so no write barrier is needed.  Following references
+   keeps garbage cycles in one increment whenever they fit in its budget.
+   The survivors of an increment, as well as the objects young collections
+   promote during the pass, go to the `visited` list, which becomes the
+   oldest generation again once the pending objects are exhausted.
+
+   Objects put in an increment have gc_refs set to the visited mark of the
+   pass, so that following references doesn't take them twice.  The mark
+   alternates between two values from one pass to the next: the marks left
+   by the previous pass then mean "not visited" without having to reset
+   them.  Both values are negative, so the rest of the collector sees them
+   like GC_REACHABLE.
+
+   Garbage cycles that are larger than an increment budget can be split
+   over several increments and survive them.  They are found by the next
+   full collection, which runs when gc.collect() is called or when the
+   survivors of a pass are twice as many as those of the last full
+   collection.  A pass whose increments all took every unvisited object
+   reachable from them can't have split a cycle, and counts as a full
+   collection for this purpose, as does the first pass.
+
+   The budget of an increment is the smaller of the number of objects and
+   the time given to gc.set_incremental(); the time is converted into a
+   number of objects using the cost per object of the previous increment.
+*/
+
+/*
+   NOTE: about the adaptive policy.
+
+   The fixed thresholds suit programs that create garbage cycles at a
+   steady pace, but make the young collections of a program that fills
+   the heap with objects that live on (e.g. loading millions of tuples)
+   pure overhead.  With gc.set_policy("adaptive"), every automatic
+   collection of the young and middle generations is followed by a
+   decision about the threshold of the collected generation, made from:
+
+   - the survival rate: the part of the examined objects that the
+     collection didn't free;
+   - the overhead: the part of the time since the end of the previous
+     automatic collection of the generation taken by this collection.
+
+   A survival rate above ADAPTIVE_RAISE_SURVIVAL doubles the threshold:
+   the collections were mostly wasted.  So does an overhead above
+   ADAPTIVE_RAISE_OVERHEAD, unless the survival rate is below
+   ADAPTIVE_LOWER_SURVIVAL: collecting plenty of garbage costs the same
+   whatever the threshold, and bigger generations are only slower to
+   traverse.  A survival rate below ADAPTIVE_LOWER_SURVIVAL with an
+   overhead below ADAPTIVE_LOWER_OVERHEAD halves the threshold, so that
+   cheap collections which find garbage run sooner.
+   The threshold stays between the one set by gc.set_threshold() divided
+   by 2**-ADAPTIVE_MIN_SHIFT and multiplied by 2**ADAPTIVE_MAX_SHIFT.
+
+   The oldest generation keeps the long-lived objects heuristic above.
+   The decisions are passed to the gc.callbacks with the "stop" phase.
+*/
+
 /*
    NOTE: about untracking of mutable objects.
 
@@ -135,13 +217,16 @@ static Py_ssize_t long_lived_pending = 0;
    recursively, tuples of immutable objects) do not need to be tracked.
    The interpreter creates a large number of tuples, many of which will
    not survive until garbage collection. It is therefore not worthwhile
-   to untrack eligible tuples at creation time.
+   to check every tuple at creation time.
 
-   Instead, all tuples except the empty tuple are tracked when created.
-   During garbage collection it is determined whether any surviving tuples
-   can be untracked. A tuple can be untracked if all of its contents are
-   already not tracked. Tuples are examined for untracking in all garbage
-   collection cycles. It may take more than one cycle to untrack a tuple.
+   Instead, tuples are tracked when created by PyTuple_New(), and only
+   the tuples built by the BUILD_TUPLE opcodes and by the json and pickle
+   loaders, whose items are at hand, are untracked right away when they
+   can be. During garbage collection it is determined whether any
+   surviving tuples can be untracked. A tuple can be untracked if all of
+   its contents are already not tracked. Tuples are examined for
+   untracking in all garbage collection cycles. It may take more than one
+   cycle to untrack a tuple.
 
    Dictionaries containing only immutable objects also do not need to be
    tracked. Dictionaries are untracked when created. If a tracked item is
@@ -150,6 +235,16 @@ static Py_ssize_t long_lived_pending = 0;
    the collector will untrack any dictionaries whose contents are not
    tracked.
 
+   Sets and frozensets are handled like dictionaries, without the
+   untracking during full collections.
+
+   Lists are tracked when created by PyList_New(), since C code fills them
+   with PyList_SET_ITEM.  The lists built by the BUILD_LIST opcodes, by
+   list() and by the json and pickle loaders are untracked when all their
+   items are atomic, and the list mutators track them again when an item
+   that may be tracked is stored in them, like for dictionaries.  Slices,
+   concatenations and repetitions of untracked lists are untracked.
+
    The module provides the python function is_tracked(obj), which returns
    the CURRENT tracking status of the object. Subsequent garbage
    collections may change the tracking status of the object.
@@ -168,6 +263,9 @@ static Py_ssize_t long_lived_pending = 0;
                 DEBUG_SAVEALL
 static int debug;
 
+/* Number of buckets of the pause time histograms */
+#define NUM_PAUSE_BUCKETS 24
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -176,10 +274,84 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total number of increments (oldest generation only) */
+    Py_ssize_t increments;
+    /* histogram of the pauses, see record_pause() */
+    Py_ssize_t pauses[NUM_PAUSE_BUCKETS];
+    /* total and longest pause */
+    _PyTime_t pause_total;
+    _PyTime_t pause_max;
 };
 
 static struct gc_generation_stats generation_stats[NUM_GENERATIONS];
 
+/* Incremental collection of the oldest generation (see the note above) */
+
+/* maximum number of objects and time of an increment, 0 for no limit;
+   incremental collection is disabled when both are 0 */
+static Py_ssize_t incremental_objects = 0;
+static _PyTime_t incremental_time = 0;
+
+/* true while a pass over the oldest generation is in progress */
+static int incremental_pass = 0;
+
+/* objects visited by the current pass */
+static PyGC_Head visited = {{&visited, &visited, 0}};
+
+/* number of objects that survived the increments of the current pass */
+static Py_ssize_t pass_survivors = 0;
+
+/* false if an increment of the current pass left out some of the
+   unvisited objects reachable from it because of its budget */
+static int pass_complete = 0;
+
+/* survivors of the last full collection or complete pass, see the note
+   about incremental collection */
+static Py_ssize_t long_lived_base = 0;
+
+/* cost of an object in the last increment, in nanoseconds */
+static _PyTime_t increment_cost = 0;
+
+/* size of the first increment when only a time budget is given */
+#define FIRST_INCREMENT_SIZE 1000
+
+/* Adaptive policy (see the note about the adaptive policy) */
+
+/* true if the thresholds of the young generations are adapted */
+static int adaptive = 0;
+
+struct adaptive_state {
+    /* the threshold is base_threshold shifted by this */
+    int shift;
+    /* end of the previous automatic collection */
+    _PyTime_t last_end;
+};
+
+static struct adaptive_state adaptive_states[NUM_GENERATIONS - 1];
+
+#define ADAPTIVE_RAISE_SURVIVAL 0.99
+#define ADAPTIVE_RAISE_OVERHEAD 0.05
+#define ADAPTIVE_LOWER_SURVIVAL 0.75
+#define ADAPTIVE_LOWER_OVERHEAD 0.01
+#define ADAPTIVE_MIN_SHIFT (-2)
+#define ADAPTIVE_MAX_SHIFT 6
+
+/* Parallel collection needs threads and atomic read-modify-write
+   operations on gc_refs. */
+#if defined(WITH_THREAD) && (defined(HAVE_BUILTIN_ATOMIC) || defined(_MSC_VER))
+#define GC_PARALLEL
+#endif
+
+/* number of threads examining the objects of a full collection, as set
+   by gc.set_parallel() */
+static int parallel_threads = 1;
+
+/* full collections of fewer objects are done by a single thread */
+#define PARALLEL_MIN_OBJECTS 65536
+
+/* number of objects of the chunks the threads share out */
+#define PARALLEL_CHUNK_SIZE 4096
+
 /*--------------------------------------------------------------------------
 gc_refs values.
 
@@ -217,14 +389,32 @@ GC_TENTATIVELY_UNREACHABLE
     Only objects with GC_TENTATIVELY_UNREACHABLE still set are candidates
     for collection.  If it's decided not to collect such an object (e.g.,
     it has a __del__ method), its gc_refs is restored to GC_REACHABLE again.
+
+With incremental collection, objects can also be left with one of two
+"visited marks" between collections:
+
+GC_VISITED_EVEN, GC_VISITED_ODD
+    The object was put in an increment by the current pass if gc_refs is
+    visited_mark, or by the previous one otherwise.  Apart from that, it is
+    treated like GC_REACHABLE.  Collecting the object sets gc_refs to
+    GC_REACHABLE again.
 ----------------------------------------------------------------------------
 */
 #define GC_UNTRACKED                    _PyGC_REFS_UNTRACKED
 #define GC_REACHABLE                    _PyGC_REFS_REACHABLE
 #define GC_TENTATIVELY_UNREACHABLE      _PyGC_REFS_TENTATIVELY_UNREACHABLE
+#define GC_VISITED_EVEN                 (-5)
+#define GC_VISITED_ODD                  (-6)
+
+/* visited mark of the current pass */
+static int visited_mark = GC_VISITED_EVEN;
+
+#define IS_VISITED_MARK(refs) \
+    ((refs) == GC_VISITED_EVEN || (refs) == GC_VISITED_ODD)
 
 #define IS_TRACKED(o) (_PyGC_REFS(o) != GC_UNTRACKED)
-#define IS_REACHABLE(o) (_PyGC_REFS(o) == GC_REACHABLE)
+#define IS_REACHABLE(o) (_PyGC_REFS(o) == GC_REACHABLE || \
+                         IS_VISITED_MARK(_PyGC_REFS(o)))
 #define IS_TENTATIVELY_UNREACHABLE(o) ( \
     _PyGC_REFS(o) == GC_TENTATIVELY_UNREACHABLE)
 
@@ -341,7 +531,8 @@ update_refs(PyGC_Head *containers)
 {
     PyGC_Head *gc = containers->gc.gc_next;
     for (; gc != containers; gc = gc->gc.gc_next) {
-        assert(_PyGCHead_REFS(gc) == GC_REACHABLE);
+        assert(_PyGCHead_REFS(gc) == GC_REACHABLE ||
+               IS_VISITED_MARK(_PyGCHead_REFS(gc)));
         _PyGCHead_SET_REFS(gc, Py_REFCNT(FROM_GC(gc)));
         /* Python's cyclic gc should never see an incoming refcount
          * of 0:  if something decref'ed to 0, it should have been
@@ -430,14 +621,15 @@ visit_reachable(PyObject *op, PyGC_Head *reachable)
         /* Else there's nothing to do.
          * If gc_refs > 0, it must be in move_unreachable's 'young'
          * list, and move_unreachable will eventually get to it.
-         * If gc_refs == GC_REACHABLE, it's either in some other
-         * generation so we don't care about it, or move_unreachable
-         * already dealt with it.
+         * If gc_refs == GC_REACHABLE (or a visited mark), it's either
+         * in some other generation so we don't care about it, or
+         * move_unreachable already dealt with it.
          * If gc_refs == GC_UNTRACKED, it must be ignored.
          */
          else {
             assert(gc_refs > 0
                    || gc_refs == GC_REACHABLE
+                   || IS_VISITED_MARK(gc_refs)
                    || gc_refs == GC_UNTRACKED);
          }
     }
@@ -506,6 +698,443 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
     }
 }
 
+#ifdef GC_PARALLEL
+
+/*** parallel collection ***/
+
+/* With parallel_threads > 1, full collections of at least
+ * PARALLEL_MIN_OBJECTS objects spread the work of subtract_refs() and
+ * move_unreachable() over a pool of worker threads (see gc.set_parallel()).
+ * The world is stopped: the main thread holds the GIL throughout and the
+ * workers only call tp_traverse, which doesn't change anything, with
+ * callbacks that only update gc_refs.
+ *
+ * The workers are started by gc.set_parallel() and wait on their start
+ * lock between the phases of the collections.  There are never more
+ * threads than CPUs, so a single CPU machine collects serially whatever
+ * parallel_threads is.
+ *
+ * update_refs() is done by the main thread, which also cuts the list into
+ * chunks of PARALLEL_CHUNK_SIZE objects.  The threads then take chunks
+ * until there are none left, once to subtract the internal references,
+ * and once to mark the objects reachable from the ones with gc_refs > 0.
+ * Both use atomic operations on gc_refs, as the objects a chunk refers to
+ * can be in any chunk.  Finally, the main thread moves the objects which
+ * weren't marked to the unreachable list.
+ */
+
+#ifdef HAVE_BUILTIN_ATOMIC
+#define GC_ATOMIC_ADD(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define GC_ATOMIC_CAS(p, expected, desired) \
+    __atomic_compare_exchange_n((p), &(expected), (desired), 0, \
+                                __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#elif SIZEOF_SIZE_T == 8
+#define GC_ATOMIC_ADD(p, v) _InterlockedExchangeAdd64((__int64 *)(p), (v))
+#define GC_ATOMIC_CAS(p, expected, desired) \
+    ((expected) == ((expected) = _InterlockedCompareExchange64( \
+        (__int64 *)(p), (desired), (expected))))
+#else
+#define GC_ATOMIC_ADD(p, v) _InterlockedExchangeAdd((long *)(p), (v))
+#define GC_ATOMIC_CAS(p, expected, desired) \
+    ((expected) == ((expected) = _InterlockedCompareExchange( \
+        (long *)(p), (desired), (expected))))
+#endif
+
+/* Work shared by the threads of a parallel collection */
+struct parallel_job {
+    int mark;                   /* subtracting references or marking? */
+    PyGC_Head *young;           /* the objects being collected */
+    PyGC_Head **chunks;         /* first object of each chunk */
+    Py_ssize_t nchunks;
+    Py_ssize_t next_chunk;      /* next chunk to take */
+    int overflow;               /* true if a mark stack couldn't grow */
+};
+
+/* A thread of the pool */
+struct parallel_worker {
+    PyThread_type_lock start;   /* released to hand the worker pool_job */
+    int quit;                   /* exit instead of doing pool_job */
+};
+
+static struct parallel_worker **workers = NULL;
+static int nworkers = 0;
+#ifdef HAVE_FORK
+static long workers_pid;        /* the process the workers belong to */
+#endif
+
+static struct parallel_job *pool_job = NULL;
+static Py_ssize_t pool_running;     /* number of threads still working */
+static PyThread_type_lock pool_done = NULL;  /* released by the last one */
+
+/* Objects marked reachable whose references are still to be marked */
+struct mark_stack {
+    PyGC_Head **items;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+    int overflow;
+};
+
+/* A traversal callback for the subtracting threads: visit_decref() with
+ * an atomic decrement.  The gc_refs of an object being collected start at
+ * its refcount and can't drop below 0, so they stay > 0 until the last
+ * decrement.
+ */
+static int
+visit_decref_parallel(PyObject *op, void *data)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if (_PyGCHead_REFS(gc) > 0)
+            GC_ATOMIC_ADD(&gc->gc.gc_refs,
+                          -((Py_ssize_t)1 << _PyGC_REFS_SHIFT));
+    }
+    return 0;
+}
+
+/* Set gc_refs of an object being collected to GC_REACHABLE.  Return true
+ * if this call did it, false if the object was marked already or isn't
+ * being collected.
+ */
+static int
+mark_reachable(PyGC_Head *gc)
+{
+    Py_ssize_t refs = gc->gc.gc_refs;
+    Py_ssize_t marked;
+
+    do {
+        if ((refs >> _PyGC_REFS_SHIFT) < 0)
+            return 0;
+        marked = (refs & _PyGC_REFS_MASK_FINALIZED)
+                 | ((size_t)GC_REACHABLE << _PyGC_REFS_SHIFT);
+    } while (!GC_ATOMIC_CAS(&gc->gc.gc_refs, refs, marked));
+    return 1;
+}
+
+static void
+mark_stack_push(struct mark_stack *stack, PyGC_Head *gc)
+{
+    if (stack->size == stack->allocated) {
+        Py_ssize_t allocated = stack->allocated ? 2 * stack->allocated : 256;
+        PyGC_Head **items = PyMem_RawRealloc(stack->items,
+                                             allocated * sizeof(*items));
+        if (items == NULL) {
+            /* leave the references of gc to fix_overflow() */
+            stack->overflow = 1;
+            return;
+        }
+        stack->items = items;
+        stack->allocated = allocated;
+    }
+    stack->items[stack->size++] = gc;
+}
+
+/* A traversal callback for the marking threads. */
+static int
+visit_mark_parallel(PyObject *op, struct mark_stack *stack)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if (mark_reachable(gc))
+            mark_stack_push(stack, gc);
+    }
+    return 0;
+}
+
+/* Do chunks of the job until there are none left. */
+static void
+parallel_work(struct parallel_job *job)
+{
+    struct mark_stack stack = {NULL, 0, 0, 0};
+    Py_ssize_t i;
+
+    while ((i = GC_ATOMIC_ADD(&job->next_chunk, 1)) < job->nchunks) {
+        PyGC_Head *gc = job->chunks[i];
+        PyGC_Head *end = (i + 1 < job->nchunks) ? job->chunks[i + 1]
+                                                : job->young;
+        for (; gc != end; gc = gc->gc.gc_next) {
+            PyObject *op = FROM_GC(gc);
+            if (!job->mark) {
+                (void) Py_TYPE(op)->tp_traverse(op,
+                                                visit_decref_parallel,
+                                                NULL);
+                continue;
+            }
+            /* gc is reachable from outside the objects being collected */
+            if (_PyGCHead_REFS(gc) > 0 && mark_reachable(gc)) {
+                mark_stack_push(&stack, gc);
+                while (stack.size > 0) {
+                    op = FROM_GC(stack.items[--stack.size]);
+                    (void) Py_TYPE(op)->tp_traverse(
+                        op, (visitproc)visit_mark_parallel, &stack);
+                }
+            }
+        }
+    }
+    if (stack.overflow)
+        job->overflow = 1;
+    PyMem_RawFree(stack.items);
+}
+
+/* Called by each thread once it is done with pool_job. */
+static void
+pool_leave(void)
+{
+    if (GC_ATOMIC_ADD(&pool_running, -1) == 1)
+        PyThread_release_lock(pool_done);
+}
+
+static void
+pool_worker(void *arg)
+{
+    struct parallel_worker *worker = (struct parallel_worker *)arg;
+    int quit;
+
+    do {
+        PyThread_acquire_lock(worker->start, WAIT_LOCK);
+        quit = worker->quit;
+        if (!quit)
+            parallel_work(pool_job);
+        /* worker may be freed as soon as the last thread has left */
+        pool_leave();
+    } while (!quit);
+}
+
+/* Wake up workers [first, last) and wait until they and the calling thread
+ * are done.  The calling thread does the job too, if there is one.
+ */
+static void
+pool_run(struct parallel_job *job, int first, int last)
+{
+    int i;
+
+    pool_job = job;
+    pool_running = last - first + 1;
+    PyThread_acquire_lock(pool_done, WAIT_LOCK);
+    for (i = first; i < last; i++)
+        PyThread_release_lock(workers[i]->start);
+    if (job != NULL)
+        parallel_work(job);
+    pool_leave();
+    PyThread_acquire_lock(pool_done, WAIT_LOCK);
+    PyThread_release_lock(pool_done);
+    pool_job = NULL;
+}
+
+/* Stop the workers beyond the first n. */
+static void
+stop_workers(int n)
+{
+    int i;
+
+    if (n >= nworkers)
+        return;
+    for (i = n; i < nworkers; i++)
+        workers[i]->quit = 1;
+    pool_run(NULL, n, nworkers);
+    for (i = n; i < nworkers; i++) {
+        PyThread_free_lock(workers[i]->start);
+        PyMem_RawFree(workers[i]);
+    }
+    nworkers = n;
+}
+
+/* Start workers until there are n of them.  Return the number of workers,
+ * which is smaller than n if a thread couldn't be started.
+ */
+static int
+start_workers(int n)
+{
+    if (n > nworkers) {
+        struct parallel_worker **w = PyMem_RawRealloc(workers,
+                                                      n * sizeof(*w));
+        if (w == NULL)
+            return nworkers;
+        workers = w;
+    }
+    if (pool_done == NULL && (pool_done = PyThread_allocate_lock()) == NULL)
+        return nworkers;
+    while (nworkers < n) {
+        struct parallel_worker *worker = PyMem_RawMalloc(sizeof(*worker));
+        if (worker == NULL)
+            break;
+        worker->quit = 0;
+        worker->start = PyThread_allocate_lock();
+        if (worker->start == NULL) {
+            PyMem_RawFree(worker);
+            break;
+        }
+        PyThread_acquire_lock(worker->start, WAIT_LOCK);
+        if (PyThread_start_new_thread(pool_worker, worker) == -1) {
+            PyThread_free_lock(worker->start);
+            PyMem_RawFree(worker);
+            break;
+        }
+        workers[nworkers++] = worker;
+    }
+#ifdef HAVE_FORK
+    workers_pid = (long)getpid();
+#endif
+    return nworkers;
+}
+
+/* The number of CPUs, or 1 if it isn't known. */
+static int
+cpu_count(void)
+{
+#ifdef MS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#elif defined(HAVE_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 1 && n <= INT_MAX) ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#ifdef HAVE_FORK
+static void workers_after_fork(void);
+#endif
+
+/* Resize the pool for threads threads, the calling one included.  Return
+ * -1 if the workers couldn't all be started.
+ */
+static int
+set_workers(int threads)
+{
+    int n = Py_MIN(threads, cpu_count()) - 1;
+
+#ifdef HAVE_FORK
+    workers_after_fork();
+#endif
+    stop_workers(n);
+    return start_workers(n) == n ? 0 : -1;
+}
+
+#ifdef HAVE_FORK
+/* Only the thread which forked exists in a child process: forget the
+ * workers of the parent and start new ones.
+ */
+static void
+workers_after_fork(void)
+{
+    int i;
+
+    if (nworkers == 0 || workers_pid == (long)getpid())
+        return;
+    for (i = 0; i < nworkers; i++) {
+        PyThread_free_lock(workers[i]->start);
+        PyMem_RawFree(workers[i]);
+    }
+    nworkers = 0;
+    (void) set_workers(parallel_threads);
+}
+#endif
+
+/* A traversal callback for fix_overflow. */
+static int
+visit_mark(PyObject *op, int *changed)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if (_PyGCHead_REFS(gc) >= 0) {
+            _PyGCHead_SET_REFS(gc, GC_REACHABLE);
+            *changed = 1;
+        }
+    }
+    return 0;
+}
+
+/* Finish the marking after a mark stack failed to grow: mark what the
+ * marked objects refer to until there is nothing new.
+ */
+static void
+fix_overflow(PyGC_Head *young)
+{
+    int changed = 1;
+    while (changed) {
+        PyGC_Head *gc;
+        changed = 0;
+        for (gc = young->gc.gc_next; gc != young; gc = gc->gc.gc_next) {
+            if (_PyGCHead_REFS(gc) == GC_REACHABLE)
+                (void) Py_TYPE(FROM_GC(gc))->tp_traverse(
+                    FROM_GC(gc), (visitproc)visit_mark, &changed);
+        }
+    }
+}
+
+/* Do what update_refs(), subtract_refs() and move_unreachable() do, with
+ * parallel_threads threads if there are enough objects.
+ */
+static void
+move_unreachable_parallel(PyGC_Head *young, PyGC_Head *unreachable)
+{
+    struct parallel_job job;
+    PyGC_Head *gc, *next;
+    Py_ssize_t n = 0, allocated = 0;
+    int nomem = 0;
+
+    /* update_refs(), cutting the list into chunks on the way */
+    job.chunks = NULL;
+    job.nchunks = 0;
+    for (gc = young->gc.gc_next; gc != young; gc = gc->gc.gc_next) {
+        assert(_PyGCHead_REFS(gc) == GC_REACHABLE ||
+               IS_VISITED_MARK(_PyGCHead_REFS(gc)));
+        _PyGCHead_SET_REFS(gc, Py_REFCNT(FROM_GC(gc)));
+        assert(_PyGCHead_REFS(gc) != 0);
+        if (n++ % PARALLEL_CHUNK_SIZE == 0 && !nomem) {
+            if (job.nchunks == allocated) {
+                PyGC_Head **chunks;
+                allocated = allocated ? 2 * allocated : 64;
+                chunks = PyMem_RawRealloc(job.chunks,
+                                          allocated * sizeof(*chunks));
+                if (chunks == NULL) {
+                    nomem = 1;
+                    continue;
+                }
+                job.chunks = chunks;
+            }
+            job.chunks[job.nchunks++] = gc;
+        }
+    }
+    if (nomem || n < PARALLEL_MIN_OBJECTS) {
+        PyMem_RawFree(job.chunks);
+        subtract_refs(young);
+        move_unreachable(young, unreachable);
+        return;
+    }
+    job.young = young;
+    job.overflow = 0;
+
+    job.mark = 0;
+    job.next_chunk = 0;
+    pool_run(&job, 0, nworkers);
+    job.mark = 1;
+    job.next_chunk = 0;
+    pool_run(&job, 0, nworkers);
+    if (job.overflow)
+        fix_overflow(young);
+
+    /* The objects which weren't marked are unreachable. */
+    for (gc = young->gc.gc_next; gc != young; gc = next) {
+        next = gc->gc.gc_next;
+        if (_PyGCHead_REFS(gc) >= 0) {
+            gc_list_move(gc, unreachable);
+            _PyGCHead_SET_REFS(gc, GC_TENTATIVELY_UNREACHABLE);
+        }
+        else {
+            assert(_PyGCHead_REFS(gc) == GC_REACHABLE);
+            if (PyTuple_CheckExact(FROM_GC(gc)))
+                _PyTuple_MaybeUntrack(FROM_GC(gc));
+        }
+    }
+
+    PyMem_RawFree(job.chunks);
+}
+
+#endif /* GC_PARALLEL */
+
 /* Try to untrack all currently tracked dictionaries */
 static void
 untrack_dicts(PyGC_Head *head)
@@ -894,70 +1523,254 @@ clear_freelists(void)
     (void)PySet_ClearFreeList();
 }
 
-/* This is the main function.  Read this to understand how the
- * collection process works. */
+/* Account for a pause of `pause` nanoseconds in the statistics of a
+ * generation.
+ */
+static void
+record_pause(struct gc_generation_stats *stats, _PyTime_t pause)
+{
+    _PyTime_t us = pause / 1000;
+    int i = 0;
+
+    /* bucket i > 0 counts pauses in [2**(i-1); 2**i) microseconds */
+    while (us > 0 && i < NUM_PAUSE_BUCKETS - 1) {
+        us >>= 1;
+        i++;
+    }
+    stats->pauses[i]++;
+    stats->pause_total += pause;
+    if (pause > stats->pause_max)
+        stats->pause_max = pause;
+}
+
+/* Deal with the unreachable objects found by move_unreachable(): clear
+ * their weakrefs, finalize them and break their cycles, or move them into
+ * gc.garbage if they have legacy finalizers.  Objects which turn out to be
+ * alive are moved into `old`.  Return the number of collected objects and
+ * store the number of uncollectable ones in *n_uncollectable.
+ */
 static Py_ssize_t
-collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
-        int nofail)
+dispose_unreachable(PyGC_Head *unreachable, PyGC_Head *old,
+                    Py_ssize_t *n_uncollectable)
 {
-    int i;
     Py_ssize_t m = 0; /* # objects collected */
     Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
-    PyGC_Head *young; /* the generation we are examining */
-    PyGC_Head *old; /* next older generation */
-    PyGC_Head unreachable; /* non-problematic unreachable trash */
     PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
     PyGC_Head *gc;
-    _PyTime_t t1 = 0;   /* initialize to prevent a compiler warning */
-
-    struct gc_generation_stats *stats = &generation_stats[generation];
 
-    if (debug & DEBUG_STATS) {
-        PySys_WriteStderr("gc: collecting generation %d...\n",
-                          generation);
-        PySys_WriteStderr("gc: objects in each generation:");
-        for (i = 0; i < NUM_GENERATIONS; i++)
-            PySys_FormatStderr(" %zd",
-                              gc_list_size(GEN_HEAD(i)));
-        t1 = _PyTime_GetMonotonicClock();
+    /* All objects in unreachable are trash, but objects reachable from
+     * legacy finalizers (e.g. tp_del) can't safely be deleted.
+     */
+    gc_list_init(&finalizers);
+    move_legacy_finalizers(unreachable, &finalizers);
+    /* finalizers contains the unreachable objects with a legacy finalizer;
+     * unreachable objects reachable *from* those are also uncollectable,
+     * and we move those into the finalizers list too.
+     */
+    move_legacy_finalizer_reachable(&finalizers);
 
-        PySys_WriteStderr("\n");
+    /* Collect statistics on collectable objects found and print
+     * debugging information.
+     */
+    for (gc = unreachable->gc.gc_next; gc != unreachable;
+                    gc = gc->gc.gc_next) {
+        m++;
+        if (debug & DEBUG_COLLECTABLE) {
+            debug_cycle("collectable", FROM_GC(gc));
+        }
     }
 
-    /* update collection and allocation counters */
-    if (generation+1 < NUM_GENERATIONS)
-        generations[generation+1].count += 1;
-    for (i = 0; i <= generation; i++)
-        generations[i].count = 0;
+    /* Clear weakrefs and invoke callbacks as necessary. */
+    m += handle_weakrefs(unreachable, old);
 
-    /* merge younger generations with one we are currently collecting */
-    for (i = 0; i < generation; i++) {
-        gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
-    }
+    /* Call tp_finalize on objects which have one. */
+    finalize_garbage(unreachable);
 
-    /* handy references */
-    young = GEN_HEAD(generation);
-    if (generation < NUM_GENERATIONS-1)
-        old = GEN_HEAD(generation+1);
-    else
-        old = young;
+    if (check_garbage(unreachable)) {
+        revive_garbage(unreachable);
+        gc_list_merge(unreachable, old);
+    }
+    else {
+        /* Call tp_clear on objects in the unreachable set.  This will cause
+         * the reference cycles to be broken.  It may also cause some objects
+         * in finalizers to be freed.
+         */
+        delete_garbage(unreachable, old);
+    }
+
+    /* Collect statistics on uncollectable objects found and print
+     * debugging information. */
+    for (gc = finalizers.gc.gc_next;
+         gc != &finalizers;
+         gc = gc->gc.gc_next) {
+        n++;
+        if (debug & DEBUG_UNCOLLECTABLE)
+            debug_cycle("uncollectable", FROM_GC(gc));
+    }
+
+    /* Append instances in the uncollectable set to a Python
+     * reachable list of garbage.  The programmer has to deal with
+     * this if they insist on creating this type of structure.
+     */
+    (void)handle_legacy_finalizers(&finalizers, old);
+
+    *n_uncollectable = n;
+    return m;
+}
+
+static void
+debug_stats_done(Py_ssize_t m, Py_ssize_t n, _PyTime_t elapsed)
+{
+    if (m == 0 && n == 0)
+        PySys_WriteStderr("gc: done");
+    else
+        PySys_FormatStderr(
+            "gc: done, %zd unreachable, %zd uncollectable",
+            n+m, n);
+    PySys_WriteStderr(", %.4fs elapsed\n",
+                      _PyTime_AsSecondsDouble(elapsed));
+}
+
+static void
+check_collect_error(int nofail)
+{
+    if (PyErr_Occurred()) {
+        if (nofail) {
+            PyErr_Clear();
+        }
+        else {
+            if (gc_str == NULL)
+                gc_str = PyUnicode_FromString("garbage collection");
+            PyErr_WriteUnraisable(gc_str);
+            Py_FatalError("unexpected exception during garbage collection");
+        }
+    }
+}
+
+/* Start a pass of incremental collection over the oldest generation. */
+static void
+start_incremental_pass(void)
+{
+    assert(!incremental_pass);
+    assert(gc_list_is_empty(&visited));
+    incremental_pass = 1;
+    pass_survivors = 0;
+    pass_complete = 1;
+    long_lived_pending = 0;
+    generations[NUM_GENERATIONS-1].count = 0;
+}
+
+/* End the incremental pass in progress: the visited objects become part
+ * of the oldest generation again, after the objects still pending if the
+ * pass is interrupted.
+ */
+static void
+end_incremental_pass(void)
+{
+    assert(incremental_pass);
+    gc_list_merge(&visited, GEN_HEAD(NUM_GENERATIONS-1));
+    if (visited_mark == GC_VISITED_EVEN)
+        visited_mark = GC_VISITED_ODD;
+    else
+        visited_mark = GC_VISITED_EVEN;
+    incremental_pass = 0;
+}
+
+/* End the incremental pass in progress if incremental collection was
+ * disabled during a collection.  gc.set_incremental() can't end the pass
+ * then, as the collection may still move objects to the visited list.
+ */
+static void
+end_disabled_incremental_pass(void)
+{
+    assert(!collecting);
+    if (incremental_pass && incremental_objects == 0 && incremental_time == 0)
+        end_incremental_pass();
+}
+
+/* This is the main function.  Read this to understand how the
+ * collection process works. */
+static Py_ssize_t
+collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
+        int nofail)
+{
+    int i;
+    Py_ssize_t m = 0; /* # objects collected */
+    Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
+    PyGC_Head *young; /* the generation we are examining */
+    PyGC_Head *old; /* next older generation */
+    PyGC_Head unreachable; /* non-problematic unreachable trash */
+    _PyTime_t t1, t2;
+
+    struct gc_generation_stats *stats = &generation_stats[generation];
+
+    t1 = _PyTime_GetMonotonicClock();
+    if (debug & DEBUG_STATS) {
+        PySys_WriteStderr("gc: collecting generation %d...\n",
+                          generation);
+        PySys_WriteStderr("gc: objects in each generation:");
+        for (i = 0; i < NUM_GENERATIONS; i++)
+            PySys_FormatStderr(" %zd",
+                              gc_list_size(GEN_HEAD(i)));
+        if (incremental_pass)
+            PySys_FormatStderr(" (%zd visited)", gc_list_size(&visited));
+        PySys_WriteStderr("\n");
+    }
+
+    /* update collection and allocation counters */
+    if (generation+1 < NUM_GENERATIONS)
+        generations[generation+1].count += 1;
+    for (i = 0; i <= generation; i++)
+        generations[i].count = 0;
+
+    /* a full collection does the work of the incremental pass in
+       progress, if any */
+    if (generation == NUM_GENERATIONS-1 && incremental_pass)
+        end_incremental_pass();
+
+    /* merge younger generations with one we are currently collecting */
+    for (i = 0; i < generation; i++) {
+        gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
+    }
+
+    /* handy references */
+    young = GEN_HEAD(generation);
+    if (generation < NUM_GENERATIONS-1)
+        old = GEN_HEAD(generation+1);
+    else
+        old = young;
+    /* the objects promoted during an incremental pass wait for the next
+       one */
+    if (old == GEN_HEAD(NUM_GENERATIONS-1) && incremental_pass)
+        old = &visited;
 
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(young);
-    subtract_refs(young);
-
-    /* Leave everything reachable from outside young in young, and move
-     * everything else (in young) to unreachable.
-     * NOTE:  This used to move the reachable objects into a reachable
-     * set instead.  But most things usually turn out to be reachable,
-     * so it's more efficient to move the unreachable things.
-     */
     gc_list_init(&unreachable);
-    move_unreachable(young, &unreachable);
+#ifdef GC_PARALLEL
+#ifdef HAVE_FORK
+    workers_after_fork();
+#endif
+    if (generation == NUM_GENERATIONS-1 && nworkers > 0 &&
+        long_lived_total + long_lived_pending >= PARALLEL_MIN_OBJECTS)
+        move_unreachable_parallel(young, &unreachable);
+    else
+#endif
+    {
+        update_refs(young);
+        subtract_refs(young);
+
+        /* Leave everything reachable from outside young in young, and move
+         * everything else (in young) to unreachable.
+         * NOTE:  This used to move the reachable objects into a reachable
+         * set instead.  But most things usually turn out to be reachable,
+         * so it's more efficient to move the unreachable things.
+         */
+        move_unreachable(young, &unreachable);
+    }
 
     /* Move reachable objects to next generation. */
     if (young != old) {
@@ -972,102 +1785,187 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
         untrack_dicts(young);
         long_lived_pending = 0;
         long_lived_total = gc_list_size(young);
+        long_lived_base = long_lived_total;
     }
 
-    /* All objects in unreachable are trash, but objects reachable from
-     * legacy finalizers (e.g. tp_del) can't safely be deleted.
-     */
-    gc_list_init(&finalizers);
-    move_legacy_finalizers(&unreachable, &finalizers);
-    /* finalizers contains the unreachable objects with a legacy finalizer;
-     * unreachable objects reachable *from* those are also uncollectable,
-     * and we move those into the finalizers list too.
-     */
-    move_legacy_finalizer_reachable(&finalizers);
+    m = dispose_unreachable(&unreachable, old, &n);
 
-    /* Collect statistics on collectable objects found and print
-     * debugging information.
-     */
-    for (gc = unreachable.gc.gc_next; gc != &unreachable;
-                    gc = gc->gc.gc_next) {
-        m++;
-        if (debug & DEBUG_COLLECTABLE) {
-            debug_cycle("collectable", FROM_GC(gc));
-        }
+    /* Clear free list only during the collection of the highest
+     * generation */
+    if (generation == NUM_GENERATIONS-1) {
+        clear_freelists();
     }
 
-    /* Clear weakrefs and invoke callbacks as necessary. */
-    m += handle_weakrefs(&unreachable, old);
+    t2 = _PyTime_GetMonotonicClock();
+    if (debug & DEBUG_STATS)
+        debug_stats_done(m, n, t2 - t1);
 
-    /* Call tp_finalize on objects which have one. */
-    finalize_garbage(&unreachable);
+    check_collect_error(nofail);
 
-    if (check_garbage(&unreachable)) {
-        revive_garbage(&unreachable);
-        gc_list_merge(&unreachable, old);
-    }
-    else {
-        /* Call tp_clear on objects in the unreachable set.  This will cause
-         * the reference cycles to be broken.  It may also cause some objects
-         * in finalizers to be freed.
+    /* Update stats */
+    if (n_collected)
+        *n_collected = m;
+    if (n_uncollectable)
+        *n_uncollectable = n;
+    stats->collections++;
+    stats->collected += m;
+    stats->uncollectable += n;
+    record_pause(stats, t2 - t1);
+    return n+m;
+}
+
+/* Argument of visit_take() */
+struct increment_state {
+    PyGC_Head *list;
+    Py_ssize_t size;
+    Py_ssize_t budget;
+    int truncated;  /* true if an object was left out for lack of budget */
+};
+
+/* A traversal callback for take_increment. */
+static int
+visit_take(PyObject *op, struct increment_state *state)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        const Py_ssize_t gc_refs = _PyGCHead_REFS(gc);
+
+        /* Take the objects this pass hasn't visited, whatever generation
+         * they are in.
          */
-        delete_garbage(&unreachable, old);
+        if (gc_refs == GC_REACHABLE
+            || (IS_VISITED_MARK(gc_refs) && gc_refs != visited_mark)) {
+            if (state->size >= state->budget) {
+                state->truncated = 1;
+                return 0;
+            }
+            gc_list_move(gc, state->list);
+            _PyGCHead_SET_REFS(gc, visited_mark);
+            state->size++;
+        }
     }
+    return 0;
+}
 
-    /* Collect statistics on uncollectable objects found and print
-     * debugging information. */
-    for (gc = finalizers.gc.gc_next;
-         gc != &finalizers;
-         gc = gc->gc.gc_next) {
-        n++;
-        if (debug & DEBUG_UNCOLLECTABLE)
-            debug_cycle("uncollectable", FROM_GC(gc));
+/* Move the next increment of the pass into `increment`: the oldest pending
+ * objects, each followed by the unvisited objects reachable from it, until
+ * there are `budget` objects.  Return the number of objects moved.
+ */
+static Py_ssize_t
+take_increment(PyGC_Head *increment, Py_ssize_t budget)
+{
+    PyGC_Head *pending = GEN_HEAD(NUM_GENERATIONS-1);
+    PyGC_Head *gc = increment; /* last object whose references are taken */
+    struct increment_state state;
+
+    state.list = increment;
+    state.size = 0;
+    state.budget = budget;
+    state.truncated = 0;
+    while (state.size < budget && !gc_list_is_empty(pending)) {
+        PyGC_Head *first = pending->gc.gc_next;
+
+        gc_list_move(first, increment);
+        _PyGCHead_SET_REFS(first, visited_mark);
+        state.size++;
+        /* Note that the increment grows during this. */
+        while (state.size < budget && gc->gc.gc_next != increment) {
+            traverseproc traverse;
+
+            gc = gc->gc.gc_next;
+            traverse = Py_TYPE(FROM_GC(gc))->tp_traverse;
+            (void) traverse(FROM_GC(gc),
+                            (visitproc)visit_take,
+                            (void *)&state);
+        }
     }
-    if (debug & DEBUG_STATS) {
-        _PyTime_t t2 = _PyTime_GetMonotonicClock();
+    if (state.truncated || gc->gc.gc_next != increment)
+        pass_complete = 0;
+    return state.size;
+}
 
-        if (m == 0 && n == 0)
-            PySys_WriteStderr("gc: done");
-        else
-            PySys_FormatStderr(
-                "gc: done, %zd unreachable, %zd uncollectable",
-                n+m, n);
-        PySys_WriteStderr(", %.4fs elapsed\n",
-                          _PyTime_AsSecondsDouble(t2 - t1));
+/* Collect the next increment of the incremental pass in progress, and end
+ * the pass if there are no pending objects left.
+ */
+static Py_ssize_t
+collect_increment(Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable)
+{
+    Py_ssize_t m = 0; /* # objects collected */
+    Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
+    Py_ssize_t budget, size;
+    PyGC_Head increment; /* the objects we are examining */
+    PyGC_Head unreachable; /* non-problematic unreachable trash */
+    PyGC_Head *gc;
+    _PyTime_t t1, t2;
+
+    struct gc_generation_stats *stats = &generation_stats[NUM_GENERATIONS-1];
+
+    assert(incremental_pass);
+    t1 = _PyTime_GetMonotonicClock();
+
+    budget = incremental_objects;
+    if (incremental_time > 0) {
+        _PyTime_t objects = FIRST_INCREMENT_SIZE;
+        if (increment_cost > 0)
+            objects = incremental_time / increment_cost;
+        if (budget == 0 || objects < budget)
+            budget = (Py_ssize_t)objects;
     }
+    if (budget < 1)
+        budget = 1;
 
-    /* Append instances in the uncollectable set to a Python
-     * reachable list of garbage.  The programmer has to deal with
-     * this if they insist on creating this type of structure.
+    gc_list_init(&increment);
+    size = take_increment(&increment, budget);
+
+    if (debug & DEBUG_STATS) {
+        PySys_FormatStderr("gc: collecting an increment of generation %d "
+                           "(%zd objects)...\n",
+                           NUM_GENERATIONS-1, size);
+    }
+
+    /* This is collect() with the increment in the role of the young
+     * generation, and the visited objects in the role of the older one.
      */
-    (void)handle_legacy_finalizers(&finalizers, old);
+    update_refs(&increment);
+    subtract_refs(&increment);
+    gc_list_init(&unreachable);
+    move_unreachable(&increment, &unreachable);
 
-    /* Clear free list only during the collection of the highest
-     * generation */
-    if (generation == NUM_GENERATIONS-1) {
-        clear_freelists();
+    untrack_dicts(&increment);
+    for (gc = increment.gc.gc_next; gc != &increment; gc = gc->gc.gc_next) {
+        _PyGCHead_SET_REFS(gc, visited_mark);
+        pass_survivors++;
     }
+    gc_list_merge(&increment, &visited);
 
-    if (PyErr_Occurred()) {
-        if (nofail) {
-            PyErr_Clear();
-        }
-        else {
-            if (gc_str == NULL)
-                gc_str = PyUnicode_FromString("garbage collection");
-            PyErr_WriteUnraisable(gc_str);
-            Py_FatalError("unexpected exception during garbage collection");
-        }
+    m = dispose_unreachable(&unreachable, &visited, &n);
+
+    if (gc_list_is_empty(GEN_HEAD(NUM_GENERATIONS-1))) {
+        end_incremental_pass();
+        long_lived_total = pass_survivors;
+        if (pass_complete || long_lived_base == 0)
+            long_lived_base = long_lived_total;
+        clear_freelists();
+        stats->collections++;
     }
 
+    t2 = _PyTime_GetMonotonicClock();
+    if (debug & DEBUG_STATS)
+        debug_stats_done(m, n, t2 - t1);
+
+    check_collect_error(0);
+
     /* Update stats */
     if (n_collected)
         *n_collected = m;
     if (n_uncollectable)
         *n_uncollectable = n;
-    stats->collections++;
+    stats->increments++;
     stats->collected += m;
     stats->uncollectable += n;
+    record_pause(stats, t2 - t1);
+    if (size > 0)
+        increment_cost = (t2 - t1) / size;
     return n+m;
 }
 
@@ -1076,7 +1974,8 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
  */
 static void
 invoke_gc_callback(const char *phase, int generation,
-                   Py_ssize_t collected, Py_ssize_t uncollectable)
+                   Py_ssize_t collected, Py_ssize_t uncollectable,
+                   const char *decision)
 {
     Py_ssize_t i;
     PyObject *info = NULL;
@@ -1087,10 +1986,12 @@ invoke_gc_callback(const char *phase, int generation,
     /* The local variable cannot be rebound, check it for sanity */
     assert(callbacks != NULL && PyList_CheckExact(callbacks));
     if (PyList_GET_SIZE(callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsisz}",
             "generation", generation,
             "collected", collected,
-            "uncollectable", uncollectable);
+            "uncollectable", uncollectable,
+            "threshold", generations[generation].threshold,
+            "decision", decision);
         if (info == NULL) {
             PyErr_WriteUnraisable(NULL);
             return;
@@ -1115,9 +2016,100 @@ static Py_ssize_t
 collect_with_callback(int generation)
 {
     Py_ssize_t result, collected, uncollectable;
-    invoke_gc_callback("start", generation, 0, 0);
+    invoke_gc_callback("start", generation, 0, 0, NULL);
     result = collect(generation, &collected, &uncollectable, 0);
-    invoke_gc_callback("stop", generation, collected, uncollectable);
+    invoke_gc_callback("stop", generation, collected, uncollectable, NULL);
+    return result;
+}
+
+/* Return base shifted by shift, as a threshold */
+static int
+scale_threshold(int base, int shift)
+{
+    if (base <= 0)
+        return base;
+    if (shift < 0) {
+        base >>= -shift;
+        return base > 0 ? base : 1;
+    }
+    if (base > (INT_MAX >> shift))
+        return INT_MAX;
+    return base << shift;
+}
+
+/* Adapt the threshold of a young generation after an automatic collection
+ * that examined `examined` objects, freed `collected` of them and ran from
+ * `start` to `end`.  Return the decision taken.
+ */
+static const char *
+adapt_threshold(int generation, Py_ssize_t examined, Py_ssize_t collected,
+                _PyTime_t start, _PyTime_t end)
+{
+    struct gc_generation *gen = &generations[generation];
+    struct adaptive_state *state = &adaptive_states[generation];
+    _PyTime_t period = end - state->last_end;
+    double survival, overhead;
+    const char *decision = "keep";
+
+    if (examined > collected)
+        survival = (double)(examined - collected) / examined;
+    else
+        survival = examined > 0 ? 0.0 : 1.0;
+    overhead = period > 0 ? (double)(end - start) / period : 0.0;
+    state->last_end = end;
+
+    if (survival > ADAPTIVE_RAISE_SURVIVAL
+        || (survival >= ADAPTIVE_LOWER_SURVIVAL
+            && overhead > ADAPTIVE_RAISE_OVERHEAD)) {
+        if (state->shift < ADAPTIVE_MAX_SHIFT) {
+            state->shift++;
+            decision = "raise";
+        }
+    }
+    else if (survival < ADAPTIVE_LOWER_SURVIVAL
+             && overhead < ADAPTIVE_LOWER_OVERHEAD) {
+        if (state->shift > ADAPTIVE_MIN_SHIFT) {
+            state->shift--;
+            decision = "lower";
+        }
+    }
+    gen->threshold = scale_threshold(gen->base_threshold, state->shift);
+    return decision;
+}
+
+/* Perform an automatic collection of a young generation under the adaptive
+ * policy and invoke progress callbacks.
+ */
+static Py_ssize_t
+collect_adaptive(int generation)
+{
+    int i;
+    Py_ssize_t result, collected, uncollectable, examined = 0;
+    _PyTime_t t1, t2;
+    const char *decision;
+
+    assert(generation < NUM_GENERATIONS - 1);
+    invoke_gc_callback("start", generation, 0, 0, NULL);
+    for (i = 0; i <= generation; i++)
+        examined += gc_list_size(GEN_HEAD(i));
+    t1 = _PyTime_GetMonotonicClock();
+    result = collect(generation, &collected, &uncollectable, 0);
+    t2 = _PyTime_GetMonotonicClock();
+    decision = adapt_threshold(generation, examined, collected, t1, t2);
+    invoke_gc_callback("stop", generation, collected, uncollectable,
+                       decision);
+    return result;
+}
+
+/* Collect an increment and invoke progress callbacks. */
+static Py_ssize_t
+collect_increment_with_callback(void)
+{
+    Py_ssize_t result, collected, uncollectable;
+    invoke_gc_callback("start", NUM_GENERATIONS - 1, 0, 0, NULL);
+    result = collect_increment(&collected, &uncollectable);
+    invoke_gc_callback("stop", NUM_GENERATIONS - 1, collected, uncollectable,
+                       NULL);
     return result;
 }
 
@@ -1132,17 +2124,32 @@ collect_generations(void)
      * generations younger than it will be collected. */
     for (i = NUM_GENERATIONS-1; i >= 0; i--) {
         if (generations[i].count > generations[i].threshold) {
-            /* Avoid quadratic performance degradation in number
-               of tracked objects. See comments at the beginning
-               of this file, and issue #4074.
-            */
-            if (i == NUM_GENERATIONS - 1
-                && long_lived_pending < long_lived_total / 4)
-                continue;
-            n = collect_with_callback(i);
+            if (i == NUM_GENERATIONS - 1) {
+                /* Avoid quadratic performance degradation in number
+                   of tracked objects. See comments at the beginning
+                   of this file, and issue #4074.
+                */
+                if (long_lived_pending < long_lived_total / 4)
+                    continue;
+                /* Collect the oldest generation incrementally, unless
+                   its garbage has to be looked for by a full collection
+                   (see the note about incremental collection). */
+                if ((incremental_objects > 0 || incremental_time > 0)
+                    && long_lived_total <= 2 * long_lived_base) {
+                    if (!incremental_pass)
+                        start_incremental_pass();
+                    continue;
+                }
+            }
+            if (adaptive && i < NUM_GENERATIONS - 1)
+                n = collect_adaptive(i);
+            else
+                n = collect_with_callback(i);
             break;
         }
     }
+    if (incremental_pass)
+        n += collect_increment_with_callback();
     return n;
 }
 
@@ -1212,6 +2219,7 @@ gc_collect(PyObject *self, PyObject *args, PyObject *kws)
         collecting = 1;
         n = collect_with_callback(genarg);
         collecting = 0;
+        end_disabled_incremental_pass();
     }
 
     return PyLong_FromSsize_t(n);
@@ -1256,20 +2264,26 @@ PyDoc_STRVAR(gc_set_thresh__doc__,
 "set_threshold(threshold0, [threshold1, threshold2]) -> None\n"
 "\n"
 "Sets the collection thresholds.  Setting threshold0 to zero disables\n"
-"collection.\n");
+"collection.  The adaptive policy scales the thresholds of the young\n"
+"generations from these.\n");
 
 static PyObject *
 gc_set_thresh(PyObject *self, PyObject *args)
 {
     int i;
     if (!PyArg_ParseTuple(args, "i|ii:set_threshold",
-                          &generations[0].threshold,
-                          &generations[1].threshold,
-                          &generations[2].threshold))
+                          &generations[0].base_threshold,
+                          &generations[1].base_threshold,
+                          &generations[2].base_threshold))
         return NULL;
     for (i = 2; i < NUM_GENERATIONS; i++) {
         /* generations higher than 2 get the same threshold */
-        generations[i].threshold = generations[2].threshold;
+        generations[i].base_threshold = generations[2].base_threshold;
+    }
+    for (i = 0; i < NUM_GENERATIONS; i++) {
+        int shift = i < NUM_GENERATIONS - 1 ? adaptive_states[i].shift : 0;
+        generations[i].threshold = scale_threshold(
+            generations[i].base_threshold, shift);
     }
 
     Py_INCREF(Py_None);
@@ -1285,9 +2299,151 @@ static PyObject *
 gc_get_thresh(PyObject *self, PyObject *noargs)
 {
     return Py_BuildValue("(iii)",
-                         generations[0].threshold,
-                         generations[1].threshold,
-                         generations[2].threshold);
+                         generations[0].base_threshold,
+                         generations[1].base_threshold,
+                         generations[2].base_threshold);
+}
+
+PyDoc_STRVAR(gc_set_policy__doc__,
+"set_policy(policy) -> None\n"
+"\n"
+"Set the policy deciding when to collect the young generations: 'fixed'\n"
+"uses the thresholds given to set_threshold(), 'adaptive' raises and\n"
+"lowers them after each collection according to the survival rate and\n"
+"the cost of the collections.\n");
+
+static PyObject *
+gc_set_policy(PyObject *self, PyObject *args)
+{
+    const char *policy;
+    int i;
+
+    if (!PyArg_ParseTuple(args, "s:set_policy", &policy))
+        return NULL;
+    if (strcmp(policy, "fixed") == 0)
+        adaptive = 0;
+    else if (strcmp(policy, "adaptive") == 0)
+        adaptive = 1;
+    else {
+        PyErr_Format(PyExc_ValueError, "unknown policy: %s", policy);
+        return NULL;
+    }
+    /* both policies start from the thresholds set by set_threshold() */
+    for (i = 0; i < NUM_GENERATIONS - 1; i++) {
+        adaptive_states[i].shift = 0;
+        adaptive_states[i].last_end = 0;
+        generations[i].threshold = generations[i].base_threshold;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_policy__doc__,
+"get_policy() -> policy\n"
+"\n"
+"Return the current collection policy, 'fixed' or 'adaptive'.\n");
+
+static PyObject *
+gc_get_policy(PyObject *self, PyObject *noargs)
+{
+    return PyUnicode_FromString(adaptive ? "adaptive" : "fixed");
+}
+
+PyDoc_STRVAR(gc_set_incremental__doc__,
+"set_incremental(objects[, time]) -> None\n"
+"\n"
+"Collect the oldest generation in increments of at most the given number\n"
+"of objects and time in seconds, instead of in one go.  Zero means no\n"
+"limit; setting both to zero disables incremental collection.\n");
+
+static PyObject *
+gc_set_incremental(PyObject *self, PyObject *args)
+{
+    Py_ssize_t objects;
+    PyObject *time_obj = NULL;
+    _PyTime_t time = 0;
+
+    if (!PyArg_ParseTuple(args, "n|O:set_incremental", &objects, &time_obj))
+        return NULL;
+    if (time_obj != NULL &&
+        _PyTime_FromSecondsObject(&time, time_obj, _PyTime_ROUND_CEILING) < 0)
+        return NULL;
+    if (objects < 0 || time < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "increment limits must be non-negative");
+        return NULL;
+    }
+    incremental_objects = objects;
+    incremental_time = time;
+    /* during a collection, e.g. from a finalizer, the pass is ended once
+       the collection is done */
+    if (!collecting)
+        end_disabled_incremental_pass();
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_incremental__doc__,
+"get_incremental() -> (objects, time)\n"
+"\n"
+"Return the current limits of the increments.\n");
+
+static PyObject *
+gc_get_incremental(PyObject *self, PyObject *noargs)
+{
+    return Py_BuildValue("(nd)",
+                         incremental_objects,
+                         _PyTime_AsSecondsDouble(incremental_time));
+}
+
+PyDoc_STRVAR(gc_set_parallel__doc__,
+"set_parallel(threads) -> None\n"
+"\n"
+"Set the number of threads examining the objects of full collections.\n"
+"The threads are started now; there are never more than CPUs.\n");
+
+static PyObject *
+gc_set_parallel(PyObject *self, PyObject *args)
+{
+    int threads;
+
+    if (!PyArg_ParseTuple(args, "i:set_parallel", &threads))
+        return NULL;
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "number of threads must be at least 1");
+        return NULL;
+    }
+#ifdef GC_PARALLEL
+    if (set_workers(threads) < 0) {
+        (void) set_workers(parallel_threads);
+        PyErr_SetString(PyExc_RuntimeError, "can't start new thread");
+        return NULL;
+    }
+#else
+    if (threads > 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "parallel collection is not supported");
+        return NULL;
+    }
+#endif
+    parallel_threads = threads;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_parallel__doc__,
+"get_parallel() -> threads\n"
+"\n"
+"Return the number of threads examining the objects of full collections.\n");
+
+static PyObject *
+gc_get_parallel(PyObject *self, PyObject *noargs)
+{
+    return PyLong_FromLong(parallel_threads);
 }
 
 PyDoc_STRVAR(gc_get_count__doc__,
@@ -1350,6 +2506,10 @@ gc_get_referrers(PyObject *self, PyObject *args)
             return NULL;
         }
     }
+    if (!(gc_referrers_for(args, &visited, result))) {
+        Py_DECREF(result);
+        return NULL;
+    }
     return result;
 }
 
@@ -1411,6 +2571,10 @@ gc_get_objects(PyObject *self, PyObject *noargs)
             return NULL;
         }
     }
+    if (append_objects(result, &visited)) {
+        Py_DECREF(result);
+        return NULL;
+    }
     return result;
 }
 
@@ -1437,12 +2601,30 @@ gc_get_stats(PyObject *self, PyObject *noargs)
         return NULL;
 
     for (i = 0; i < NUM_GENERATIONS; i++) {
-        PyObject *dict;
+        PyObject *dict, *pauses;
+        int j;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        pauses = PyTuple_New(NUM_PAUSE_BUCKETS);
+        if (pauses == NULL)
+            goto error;
+        for (j = 0; j < NUM_PAUSE_BUCKETS; j++) {
+            PyObject *count = PyLong_FromSsize_t(st->pauses[j]);
+            if (count == NULL) {
+                Py_DECREF(pauses);
+                goto error;
+            }
+            PyTuple_SET_ITEM(pauses, j, count);
+        }
+        dict = Py_BuildValue("{snsnsnsnsNsdsd}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "increments", st->increments,
+                             "pauses", pauses,
+                             "pause_total",
+                             _PyTime_AsSecondsDouble(st->pause_total),
+                             "pause_max",
+                             _PyTime_AsSecondsDouble(st->pause_max)
                             );
         if (dict == NULL)
             goto error;
@@ -1494,6 +2676,12 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_policy() -- Choose between fixed and adaptive thresholds.\n"
+"get_policy() -- Return the current collection policy.\n"
+"set_incremental() -- Set the limits of incremental collection.\n"
+"get_incremental() -- Return the limits of incremental collection.\n"
+"set_parallel() -- Set the number of threads of full collections.\n"
+"get_parallel() -- Return the number of threads of full collections.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "get_referrers() -- Return the list of objects that refer to an object.\n"
@@ -1508,6 +2696,14 @@ static PyMethodDef GcMethods[] = {
     {"get_count",          gc_get_count,  METH_NOARGS,  gc_get_count__doc__},
     {"set_threshold",  gc_set_thresh, METH_VARARGS, gc_set_thresh__doc__},
     {"get_threshold",  gc_get_thresh, METH_NOARGS,  gc_get_thresh__doc__},
+    {"set_policy",     gc_set_policy, METH_VARARGS, gc_set_policy__doc__},
+    {"get_policy",     gc_get_policy, METH_NOARGS,  gc_get_policy__doc__},
+    {"set_incremental", gc_set_incremental, METH_VARARGS,
+        gc_set_incremental__doc__},
+    {"get_incremental", gc_get_incremental, METH_NOARGS,
+        gc_get_incremental__doc__},
+    {"set_parallel",   gc_set_parallel, METH_VARARGS, gc_set_parallel__doc__},
+    {"get_parallel",   gc_get_parallel, METH_NOARGS,  gc_get_parallel__doc__},
     {"collect",            (PyCFunction)gc_collect,
         METH_VARARGS | METH_KEYWORDS,           gc_collect__doc__},
     {"get_objects",    gc_get_objects,METH_NOARGS,  gc_get_objects__doc__},
@@ -1582,6 +2778,7 @@ PyGC_Collect(void)
         collecting = 1;
         n = collect_with_callback(NUM_GENERATIONS - 1);
         collecting = 0;
+        end_disabled_incremental_pass();
     }
 
     return n;
@@ -1604,6 +2801,7 @@ _PyGC_CollectNoFail(void)
         collecting = 1;
         n = collect(NUM_GENERATIONS - 1, NULL, NULL, 1);
         collecting = 0;
+        end_disabled_incremental_pass();
     }
     return n;
 }
@@ -1648,6 +2846,10 @@ void
 _PyGC_Fini(void)
 {
     Py_CLEAR(callbacks);
+#ifdef GC_PARALLEL
+    parallel_threads = 1;
+    (void) set_workers(1);
+#endif
 }
 
 /* for debugging */
@@ -1707,6 +2909,7 @@ _PyObject_GC_Alloc(int use_calloc, size_t basicsize)
         collecting = 1;
         collect_generations();
         collecting = 0;
+        end_disabled_incremental_pass();
     }
     op = FROM_GC(g);
     return op;
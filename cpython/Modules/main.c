@@ -349,8 +349,8 @@ Py_Main(int argc, wchar_t **argv)
     orig_argc = argc;           /* For Py_GetArgcArgv() */
     orig_argv = argv;
 
-    /* Hash randomization needed early for all string operations
-       (including -W and -X options). */
+    /* Hash randomization and the pymalloc settings are needed early for all
+       string operations (including -W and -X options). */
     _PyOS_opterr = 0;  /* prevent printing the error in 1st pass */
     while ((c = _PyOS_GetOpt(argc, argv, PROGRAM_OPTS)) != EOF) {
         if (c == 'm' || c == 'c') {
@@ -358,7 +358,7 @@ Py_Main(int argc, wchar_t **argv)
                not interpreter options. */
             break;
         }
-        if (c == 'E') {
+        if (c == 'E' || c == 'I') {
             Py_IgnoreEnvironmentFlag++;
             break;
         }
@@ -367,6 +367,7 @@ Py_Main(int argc, wchar_t **argv)
     /* UWP apps do not have environment variables */
     Py_IgnoreEnvironmentFlag++;
 #endif
+    _PyObject_ConfigureMalloc();
 
     Py_HashRandomizationFlag = 1;
     _PyRandom_Init();
@@ -417,7 +418,7 @@ Py_Main(int argc, wchar_t **argv)
         case 'I':
             Py_IsolatedFlag++;
             Py_NoUserSiteDirectory++;
-            Py_IgnoreEnvironmentFlag++;
+            /* -I implies -E, already handled above */
             break;
 
         /* case 'J': reserved for Jython */
@@ -1,5 +1,6 @@
 #include "Python.h"
 #include "code.h"
+#include "opcode.h"
 #include "structmember.h"
 
 #define NAME_CHARS \
@@ -150,7 +151,8 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_firstlineno = firstlineno;
     Py_INCREF(lnotab);
     co->co_lnotab = lnotab;
-    co->co_zombieframe = NULL;
+    co->co_globalcache = NULL;
+    co->co_attrcache = NULL;
     co->co_weakreflist = NULL;
     return co;
 }
@@ -372,8 +374,16 @@ code_dealloc(PyCodeObject *co)
     Py_XDECREF(co->co_lnotab);
     if (co->co_cell2arg != NULL)
         PyMem_FREE(co->co_cell2arg);
-    if (co->co_zombieframe != NULL)
-        PyObject_GC_Del(co->co_zombieframe);
+    if (co->co_globalcache != NULL)
+        PyMem_FREE(co->co_globalcache);
+    if (co->co_attrcache != NULL) {
+        Py_ssize_t i;
+        for (i = 0; i < co->co_attrcache->nsites; i++) {
+            if (co->co_attrcache->entries[i].keys != NULL)
+                _PyDictKeys_DecRef(co->co_attrcache->entries[i].keys);
+        }
+        PyMem_FREE(co->co_attrcache);
+    }
     if (co->co_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject*)co);
     PyObject_DEL(co);
@@ -387,6 +397,13 @@ code_sizeof(PyCodeObject *co, void *unused)
     res = sizeof(PyCodeObject);
     if (co->co_cell2arg != NULL && co->co_cellvars != NULL)
         res += PyTuple_GET_SIZE(co->co_cellvars) * sizeof(unsigned char);
+    if (co->co_globalcache != NULL)
+        res += sizeof(_PyGlobalCache) +
+               (PyTuple_GET_SIZE(co->co_names) - 1) * sizeof(_PyGlobalCacheEntry);
+    if (co->co_attrcache != NULL)
+        res += sizeof(_PyAttrCache) +
+               (co->co_attrcache->nsites - 1) * sizeof(_PyAttrCacheEntry) +
+               PyBytes_GET_SIZE(co->co_code) * sizeof(unsigned short);
     return PyLong_FromSsize_t(res);
 }
 
@@ -612,3 +629,69 @@ _PyCode_CheckLineNumber(PyCodeObject* co, int lasti, PyAddrPair *bounds)
 
     return line;
 }
+
+int
+_PyCode_InitGlobalCache(PyCodeObject *co)
+{
+    Py_ssize_t nnames = PyTuple_GET_SIZE(co->co_names);
+    _PyGlobalCache *cache;
+
+    assert(co->co_globalcache == NULL);
+    assert(nnames > 0);
+    cache = (_PyGlobalCache *)PyMem_MALLOC(
+        sizeof(_PyGlobalCache) + (nnames - 1) * sizeof(_PyGlobalCacheEntry));
+    if (cache == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    /* Version tags are never zero, so zeroed entries never match */
+    memset(cache, 0, sizeof(_PyGlobalCache) +
+                     (nnames - 1) * sizeof(_PyGlobalCacheEntry));
+    co->co_globalcache = cache;
+    return 0;
+}
+
+int
+_PyCode_InitAttrCache(PyCodeObject *co)
+{
+    unsigned char *code = (unsigned char *)PyBytes_AS_STRING(co->co_code);
+    Py_ssize_t codelen = PyBytes_GET_SIZE(co->co_code);
+    Py_ssize_t i, nsites = 0;
+    size_t entries_size;
+    _PyAttrCache *cache;
+
+    assert(co->co_attrcache == NULL);
+    for (i = 0; i < codelen; i += HAS_ARG(code[i]) ? 3 : 1) {
+        if (code[i] == LOAD_ATTR)
+            nsites++;
+    }
+    /* Sites past the range of site_index are simply not cached */
+    if (nsites >= _PyAttrCache_NOSITE)
+        nsites = _PyAttrCache_NOSITE - 1;
+    assert(nsites > 0);
+    entries_size = sizeof(_PyAttrCache) + (nsites - 1) * sizeof(_PyAttrCacheEntry);
+    cache = (_PyAttrCache *)PyMem_MALLOC(
+        entries_size + codelen * sizeof(unsigned short));
+    if (cache == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(cache, 0, entries_size);
+    cache->nsites = nsites;
+    cache->site_index = (unsigned short *)((char *)cache + entries_size);
+    nsites = 0;
+    for (i = 0; i < codelen; i++) {
+        if (code[i] == LOAD_ATTR && nsites < cache->nsites) {
+            cache->site_index[i] = (unsigned short)nsites++;
+        }
+        else {
+            cache->site_index[i] = _PyAttrCache_NOSITE;
+        }
+        if (HAS_ARG(code[i])) {
+            cache->site_index[++i] = _PyAttrCache_NOSITE;
+            cache->site_index[++i] = _PyAttrCache_NOSITE;
+        }
+    }
+    co->co_attrcache = cache;
+    return 0;
+}
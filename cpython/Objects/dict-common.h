@@ -8,15 +8,52 @@ typedef struct {
     PyObject *me_value; /* This field is only meaningful for combined tables */
 } PyDictKeyEntry;
 
-typedef PyDictKeyEntry *(*dict_lookup_func)
-(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject ***value_addr);
+/* dict_lookup_func() returns the index of the entry for key, usable as
+ * DK_ENTRIES(dk)[index], or DKIX_EMPTY if the key is not present, or
+ * DKIX_ERROR if a comparison raised an exception.  If hashpos is not NULL,
+ * it receives the slot of dk_indices holding that index or, for a missing
+ * key, the slot where the key would be inserted.
+ */
+typedef Py_ssize_t (*dict_lookup_func)
+(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject ***value_addr,
+ Py_ssize_t *hashpos);
 
+#define DKIX_EMPTY (-1)
+#define DKIX_DUMMY (-2)  /* Used internally */
+#define DKIX_ERROR (-3)
+
+/* See dictobject.c for the actual layout of PyDictKeysObject */
 struct _dictkeysobject {
     Py_ssize_t dk_refcnt;
+    /* Size of the hash table (dk_indices).  It must be a power of 2. */
     Py_ssize_t dk_size;
     dict_lookup_func dk_lookup;
+    /* Number of usable entries in dk_entries. */
     Py_ssize_t dk_usable;
-    PyDictKeyEntry dk_entries[1];
+    /* Number of used entries in dk_entries. */
+    Py_ssize_t dk_nentries;
+    /* Actual hash table of dk_size slots.  Each slot holds an index into
+       dk_entries, or DKIX_EMPTY or DKIX_DUMMY.  The width of a slot depends
+       on dk_size: 1 byte up to 0xff, 2 bytes up to 0xffff, 4 bytes up to
+       0xffffffff and 8 bytes otherwise.
+
+       Dynamically sized, 8 bytes is the minimum. */
+    union {
+        signed char as_1[8];
+        short as_2[4];
+        PY_INT32_T as_4[2];
+#if SIZEOF_VOID_P > 4
+        PY_INT64_T as_8[1];
+#endif
+    } dk_indices;
+
+    /* "signed char dk_ctrl[DK_CTRL_SIZE(dk_size)];" follows: one control
+       byte per slot of dk_indices (a hash tag, or DK_CTRL_EMPTY or
+       DK_CTRL_DUMMY), padded to a whole probe group.  See the DK_CTRL()
+       macro.
+
+       "PyDictKeyEntry dk_entries[USABLE_FRACTION(dk_size)];" follows,
+       see the DK_ENTRIES() macro. */
 };
 
 #endif
@@ -9,53 +9,70 @@
 
 
 /*
-There are four kinds of slots in the table:
-
-1. Unused.  me_key == me_value == NULL
+A PyDictKeysObject is laid out as a hash table of dk_size slots
+(dk_indices) followed by a dense array of USABLE_FRACTION(dk_size)
+entries (dk_entries, see DK_ENTRIES()).  Entries are appended in insertion
+order and the hash table only holds their indices, using the smallest
+integer type that can index the table.  This makes dicts both more compact
+(most of the unused space is now one-byte slots rather than three-word
+entries) and ordered: iterating walks the entries array.
+
+There are four kinds of slots in the table (slot is the value of
+dk_indices[i], and DK_ENTRIES(keys)[slot] is its entry if slot >= 0):
+
+1. Unused.  slot == DKIX_EMPTY
    Does not hold an active (key, value) pair now and never did.  Unused can
-   transition to Active upon key insertion.  This is the only case in which
-   me_key is NULL, and is each slot's initial state.
+   transition to Active upon key insertion.  This is each slot's initial
+   state.
 
-2. Active.  me_key != NULL and me_key != dummy and me_value != NULL
-   Holds an active (key, value) pair.  Active can transition to Dummy or
-   Pending upon key deletion (for combined and split tables respectively).
-   This is the only case in which me_value != NULL.
+2. Active.  slot >= 0, me_key != NULL and me_value != NULL
+   Holds an active (key, value) pair.  Active can transition to Dummy upon
+   key deletion.  This is the only case in which me_value != NULL.
 
-3. Dummy.  me_key == dummy and me_value == NULL
+3. Dummy.  slot == DKIX_DUMMY  (combined only)
    Previously held an active (key, value) pair, but that was deleted and an
    active pair has not yet overwritten the slot.  Dummy can transition to
    Active upon key insertion.  Dummy slots cannot be made Unused again
-   (cannot have me_key set to NULL), else the probe sequence in case of
-   collision would have no way to know they were once active.
-
-4. Pending. Not yet inserted or deleted from a split-table.
-   key != NULL, key != dummy and value == NULL
+   else the probe sequence in case of collision would have no way to know
+   they were once active.  The entry it pointed to keeps NULL key and value
+   until the table is resized.
+
+4. Pending.  slot >= 0, me_key != NULL and value == NULL  (split only)
+   The key is known to the shared keys object but this dict does not hold
+   a value for it (yet).
+
+Next to the hash table, dk_ctrl holds one control byte per slot:
+DK_CTRL_EMPTY for Unused slots, DK_CTRL_DUMMY for Dummy slots, and a 7-bit
+fragment of the key's hash (DK_HASH_TAG()) for the others.  Lookups probe a
+group of DK_GROUP_WIDTH consecutive slots at a time, comparing all their
+control bytes against the tag at once (with SSE2 where available, else a
+few word-sized operations), and only follow the slots whose tag matches
+into dk_entries.  This avoids most of the cache misses of comparing hashes
+in the entries array, which is what makes missing keys and long collision
+chains expensive.
 
 The DictObject can be in one of two forms.
 Either:
   A combined table:
     ma_values == NULL, dk_refcnt == 1.
     Values are stored in the me_value field of the PyDictKeysObject.
-    Slot kind 4 is not allowed i.e.
-        key != NULL, key != dummy and value == NULL is illegal.
 Or:
   A split table:
     ma_values != NULL, dk_refcnt >= 1
-    Values are stored in the ma_values array.
-    Only string (unicode) keys are allowed, no <dummy> keys are present.
-
-Note: .popitem() abuses the me_hash field of an Unused or Dummy slot to
-hold a search finger.  The me_hash field of Unused or Dummy slots has no
-meaning otherwise. As a consequence of this popitem always converts the dict
-to the combined-table form.
+    Values are stored in the ma_values array, indexed like dk_entries.
+    Only string (unicode) keys are allowed.
+    All dicts sharing the same keys must have the same insertion order:
+    a dict holds values for a prefix of the shared entries, so inserting
+    out of order, or deleting, converts it to a combined table.
 */
 
 /* PyDict_MINSIZE_SPLIT is the minimum size of a split dictionary.
- * It must be a power of 2, and at least 4.
+ * It must be a power of 2, and at least 8 so that the one-byte hash table
+ * keeps the entries array that follows it pointer aligned.
  * Resizing of split dictionaries is very rare, so the saving memory is more
  * important than the cost of resizing.
  */
-#define PyDict_MINSIZE_SPLIT 4
+#define PyDict_MINSIZE_SPLIT 8
 
 /* PyDict_MINSIZE_COMBINED is the starting size for any new, non-split dict.
  * 8 allows dicts with no more than 5 active entries; experiments suggested
@@ -69,6 +86,7 @@ to the combined-table form.
 #include "Python.h"
 #include "dict-common.h"
 #include "stringlib/eq.h"
+#include <stddef.h>
 
 /*[clinic input]
 class dict "PyDictObject *" "&PyDict_Type"
@@ -178,34 +196,192 @@ masked); and the PyDictObject struct required a member to hold the table's
 polynomial.  In Tim's experiments the current scheme ran faster, produced
 equally good collision statistics, needed less code & used less memory.
 
-*/
+The recurrence above now runs over groups of DK_GROUP_WIDTH slots rather than
+over single slots: j is a group number, the initial group is the one holding
+slot hash % 2**i, and every slot of a group is tested at once through its
+control byte.  Within a group slots are tried in order, and the first group
+with an Unused slot ends an unsuccessful search.  The argument above still
+holds for groups, so every group is eventually visited.
+
+A key is always stored in its own slot (hash % 2**i) when that slot is
+free, and slots never become Unused again until the table is rebuilt.  So
+if that slot is Unused the key is missing.  In tables smaller than
+DK_CTRL_FIRST_MINSIZE, lookups test that slot through dk_indices as they did
+before groups existed: everything is in the L1 cache, and most keys are
+found there without touching the control bytes at all.  In larger ones that
+slot is tested through its control byte too, which saves loading entries
+that cannot match.
 
-/* Object used as dummy key to fill deleted entries
- * This could be any unique object,
- * use a custom type in order to minimise coupling.
 */
-static PyObject _dummy_struct;
 
-#define dummy (&_dummy_struct)
+/* Control bytes (see the comment at the top of the file).  Tags are
+ * 0..0x7f, so all special values have the sign bit set; DK_CTRL_SENTINEL
+ * pads tables smaller than a group and matches nothing.
+ */
+#define DK_CTRL_EMPTY    (-128)
+#define DK_CTRL_DUMMY    (-2)
+#define DK_CTRL_SENTINEL (-1)
+
+/* Mix the high bits of the hash into the tag: the low ones mostly select
+ * the group already. */
+#define DK_HASH_TAG(hash) \
+    ((signed char)(((size_t)(hash) ^ \
+                    ((size_t)(hash) >> (8 * SIZEOF_SIZE_T - 7))) & 0x7f))
+
+/* Match a group of control bytes.  dk_group_match() returns a mask of the
+ * slots whose tag is tag, dk_group_match_empty() of the Unused slots and
+ * dk_group_match_free() of the Unused and Dummy ones.  Iterate over a mask
+ * with dk_groupmask_first() and DK_GROUPMASK_NEXT().
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
 
-#ifdef Py_REF_DEBUG
-PyObject *
-_PyDict_Dummy(void)
+#define DK_GROUP_WIDTH 16
+typedef unsigned int dk_groupmask_t;
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match(const signed char *ctrl, signed char tag)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (dk_groupmask_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(g, _mm_set1_epi8(tag)));
+}
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match_empty(const signed char *ctrl)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (dk_groupmask_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(g, _mm_set1_epi8(DK_CTRL_EMPTY)));
+}
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match_free(const signed char *ctrl)
+{
+    /* DK_CTRL_EMPTY and DK_CTRL_DUMMY are the only values below
+       DK_CTRL_SENTINEL */
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (dk_groupmask_t)_mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(DK_CTRL_SENTINEL), g));
+}
+
+#define DK_GROUPMASK_SHIFT 0
+
+#else
+/* Portable version: a group is a machine word and its masks have the high
+ * bit of each matching byte set.  dk_group_match() may report false
+ * positives (only above a real match), which lookups reject anyway. */
+
+#define DK_GROUP_WIDTH SIZEOF_SIZE_T
+typedef size_t dk_groupmask_t;
+
+#define DK_LSBS ((size_t)-1 / 0xff)
+#define DK_MSBS (DK_LSBS << 7)
+
+Py_LOCAL_INLINE(size_t)
+dk_group_load(const signed char *ctrl)
+{
+    size_t g;
+    memcpy(&g, ctrl, sizeof(g));
+#ifdef WORDS_BIGENDIAN
+    /* Keep slot k in byte k, counting from the least significant one */
+    {
+        size_t r = 0;
+        int k;
+        for (k = 0; k < SIZEOF_SIZE_T; k++) {
+            r = (r << 8) | (g & 0xff);
+            g >>= 8;
+        }
+        g = r;
+    }
+#endif
+    return g;
+}
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match(const signed char *ctrl, signed char tag)
+{
+    size_t x = dk_group_load(ctrl) ^ (DK_LSBS * (unsigned char)tag);
+    return (x - DK_LSBS) & ~x & DK_MSBS;
+}
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match_empty(const signed char *ctrl)
+{
+    /* Sign bit set and bit 1 clear: only DK_CTRL_EMPTY */
+    size_t g = dk_group_load(ctrl);
+    return g & (~g << 6) & DK_MSBS;
+}
+
+Py_LOCAL_INLINE(dk_groupmask_t)
+dk_group_match_free(const signed char *ctrl)
+{
+    /* Sign bit set and bit 0 clear: DK_CTRL_EMPTY or DK_CTRL_DUMMY */
+    size_t g = dk_group_load(ctrl);
+    return g & (~g << 7) & DK_MSBS;
+}
+
+#define DK_GROUPMASK_SHIFT 3
+
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* Index within its group of the first slot of a non-zero mask */
+Py_LOCAL_INLINE(Py_ssize_t)
+dk_groupmask_first(dk_groupmask_t m)
 {
-    return dummy;
+    Py_ssize_t n;
+#ifdef _MSC_VER
+    unsigned long r;
+#endif
+    assert(m != 0);
+#if defined(__GNUC__) && SIZEOF_SIZE_T == SIZEOF_LONG
+    n = __builtin_ctzl((unsigned long)m);
+#elif defined(__GNUC__) && SIZEOF_SIZE_T == SIZEOF_LONG_LONG
+    n = __builtin_ctzll((unsigned long long)m);
+#elif defined(_MSC_VER) && SIZEOF_SIZE_T == 8
+    _BitScanForward64(&r, m);
+    n = r;
+#elif defined(_MSC_VER)
+    _BitScanForward(&r, (unsigned long)m);
+    n = r;
+#else
+    for (n = 0; !(m & 1); n++)
+        m >>= 1;
+#endif
+    return n >> DK_GROUPMASK_SHIFT;
 }
+
+#define DK_GROUPMASK_NEXT(m) ((m) & ((m) - 1))
+
+/* Tables at least this large are probed through their control bytes from
+ * the first slot on. */
+#define DK_CTRL_FIRST_MINSIZE 1024
+
+#if defined(__GNUC__)
+#define DK_NO_INLINE __attribute__((__noinline__))
+#else
+#define DK_NO_INLINE
 #endif
 
 /* forward declarations */
-static PyDictKeyEntry *lookdict(PyDictObject *mp, PyObject *key,
-                                Py_hash_t hash, PyObject ***value_addr);
-static PyDictKeyEntry *lookdict_unicode(PyDictObject *mp, PyObject *key,
-                                        Py_hash_t hash, PyObject ***value_addr);
-static PyDictKeyEntry *
+static Py_ssize_t lookdict(PyDictObject *mp, PyObject *key,
+                           Py_hash_t hash, PyObject ***value_addr,
+                           Py_ssize_t *hashpos);
+static Py_ssize_t lookdict_unicode(PyDictObject *mp, PyObject *key,
+                                   Py_hash_t hash, PyObject ***value_addr,
+                                   Py_ssize_t *hashpos);
+static Py_ssize_t
 lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
-                         Py_hash_t hash, PyObject ***value_addr);
-static PyDictKeyEntry *lookdict_split(PyDictObject *mp, PyObject *key,
-                                      Py_hash_t hash, PyObject ***value_addr);
+                         Py_hash_t hash, PyObject ***value_addr,
+                         Py_ssize_t *hashpos);
+static Py_ssize_t lookdict_split(PyDictObject *mp, PyObject *key,
+                                 Py_hash_t hash, PyObject ***value_addr,
+                                 Py_ssize_t *hashpos);
 
 static int dictresize(PyDictObject *mp, Py_ssize_t minused);
 
@@ -216,6 +392,14 @@ static int dictresize(PyDictObject *mp, Py_ssize_t minused);
 static PyDictObject *free_list[PyDict_MAXFREELIST];
 static int numfree = 0;
 
+/* Global counter used to set ma_version_tag field of dictionary.
+ * It is incremented each time that a dictionary is created and each
+ * time that a dictionary is modified, so that a (dict, version) pair
+ * observed once identifies the exact same mapping later on. */
+static PY_UINT64_T pydict_global_version = 0;
+
+#define DICT_NEXT_VERSION() (++pydict_global_version)
+
 #include "clinic/dictobject.c.h"
 
 int
@@ -252,8 +436,98 @@ PyDict_Fini(void)
 #define DK_INCREF(dk) (DK_DEBUG_INCREF ++(dk)->dk_refcnt)
 #define DK_DECREF(dk) if (DK_DEBUG_DECREF (--(dk)->dk_refcnt) == 0) free_keys_object(dk)
 #define DK_SIZE(dk) ((dk)->dk_size)
+#if SIZEOF_VOID_P > 4
+#define DK_IXSIZE(dk)                          \
+    (DK_SIZE(dk) <= 0xff ?                     \
+        1 : DK_SIZE(dk) <= 0xffff ?            \
+            2 : DK_SIZE(dk) <= 0xffffffff ?    \
+                sizeof(PY_INT32_T) : sizeof(PY_INT64_T))
+#else
+#define DK_IXSIZE(dk)                          \
+    (DK_SIZE(dk) <= 0xff ?                     \
+        1 : DK_SIZE(dk) <= 0xffff ?            \
+            2 : sizeof(PY_INT32_T))
+#endif
+/* The control bytes are padded to 16, the widest group, whatever the
+   group width of this build, to keep the layout the same everywhere. */
+#define DK_CTRL_SIZE(size) ((size) < 16 ? 16 : (size))
+#define DK_CTRL(dk) \
+    ((signed char *)(dk)->dk_indices.as_1 + DK_SIZE(dk) * DK_IXSIZE(dk))
+#define DK_ENTRIES(dk) \
+    ((PyDictKeyEntry*)(DK_CTRL(dk) + DK_CTRL_SIZE(DK_SIZE(dk))))
 #define DK_MASK(dk) (((dk)->dk_size)-1)
 #define IS_POWER_OF_2(x) (((x) & (x-1)) == 0)
+/* Mask to apply to a group number */
+#define DK_GROUP_MASK(dk) \
+    (DK_SIZE(dk) <= DK_GROUP_WIDTH ? \
+        0 : ((size_t)DK_SIZE(dk) / DK_GROUP_WIDTH) - 1)
+
+/* Size of a keys object of the given table size, in bytes */
+#define KEYS_OBJECT_SIZE(size, ixsize)                          \
+    (offsetof(PyDictKeysObject, dk_indices) + (ixsize) * (size) + \
+     DK_CTRL_SIZE(size) + sizeof(PyDictKeyEntry) * USABLE_FRACTION(size))
+
+/* Return the index stored in slot i of the hash table */
+Py_LOCAL_INLINE(Py_ssize_t)
+dk_get_index(PyDictKeysObject *keys, Py_ssize_t i)
+{
+    Py_ssize_t s = DK_SIZE(keys);
+    Py_ssize_t ix;
+
+    if (s <= 0xff) {
+        ix = keys->dk_indices.as_1[i];
+    }
+    else if (s <= 0xffff) {
+        ix = keys->dk_indices.as_2[i];
+    }
+#if SIZEOF_VOID_P > 4
+    else if (s <= 0xffffffff) {
+        ix = keys->dk_indices.as_4[i];
+    }
+    else {
+        ix = keys->dk_indices.as_8[i];
+    }
+#else
+    else {
+        ix = keys->dk_indices.as_4[i];
+    }
+#endif
+    assert(ix >= DKIX_DUMMY);
+    return ix;
+}
+
+/* Store ix in slot i of the hash table and update its control byte.
+   hash is the hash of the entry's key; it is ignored for DKIX_DUMMY. */
+Py_LOCAL_INLINE(void)
+dk_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix,
+             Py_hash_t hash)
+{
+    Py_ssize_t s = DK_SIZE(keys);
+
+    assert(ix >= DKIX_DUMMY);
+    DK_CTRL(keys)[i] = ix == DKIX_DUMMY ? DK_CTRL_DUMMY : DK_HASH_TAG(hash);
+    if (s <= 0xff) {
+        assert(ix <= 0x7f);
+        keys->dk_indices.as_1[i] = (signed char)ix;
+    }
+    else if (s <= 0xffff) {
+        assert(ix <= 0x7fff);
+        keys->dk_indices.as_2[i] = (short)ix;
+    }
+#if SIZEOF_VOID_P > 4
+    else if (s <= 0xffffffff) {
+        assert(ix <= 0x7fffffff);
+        keys->dk_indices.as_4[i] = (PY_INT32_T)ix;
+    }
+    else {
+        keys->dk_indices.as_8[i] = ix;
+    }
+#else
+    else {
+        keys->dk_indices.as_4[i] = ix;
+    }
+#endif
+}
 
 /* USABLE_FRACTION is the maximum dictionary load.
  * Currently set to (2n+1)/3. Increasing this ratio makes dictionaries more
@@ -301,55 +575,83 @@ PyDict_Fini(void)
 
 /* This immutable, empty PyDictKeysObject is used for PyDict_Clear()
  * (which cannot fail and thus can do no allocation).
+ * It is a table of 8 slots so that its control bytes follow dk_indices
+ * directly; being full (dk_usable == 0), it is never inserted into.
  */
-static PyDictKeysObject empty_keys_struct = {
-        2, /* dk_refcnt 1 for this struct, 1 for dummy_struct */
-        1, /* dk_size */
+static struct {
+    PyDictKeysObject keys;
+    signed char ctrl[DK_CTRL_SIZE(8)];
+} empty_keys_struct = {
+    {
+        1, /* dk_refcnt */
+        8, /* dk_size */
         lookdict_split, /* dk_lookup */
         0, /* dk_usable (immutable) */
+        0, /* dk_nentries */
         {
-            { 0, 0, 0 } /* dk_entries (empty) */
-        }
+            { DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY,
+              DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY }
+        } /* dk_indices */
+    },
+    {
+        DK_CTRL_EMPTY, DK_CTRL_EMPTY, DK_CTRL_EMPTY, DK_CTRL_EMPTY,
+        DK_CTRL_EMPTY, DK_CTRL_EMPTY, DK_CTRL_EMPTY, DK_CTRL_EMPTY,
+        DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+        DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+        DK_CTRL_SENTINEL, DK_CTRL_SENTINEL
+    } /* dk_ctrl */
 };
 
-static PyObject *empty_values[1] = { NULL };
+static PyObject *empty_values[USABLE_FRACTION(8)] = { NULL };
 
-#define Py_EMPTY_KEYS &empty_keys_struct
+#define Py_EMPTY_KEYS (&empty_keys_struct.keys)
 
 static PyDictKeysObject *new_keys_object(Py_ssize_t size)
 {
     PyDictKeysObject *dk;
-    Py_ssize_t i;
-    PyDictKeyEntry *ep0;
+    Py_ssize_t es, usable;
 
     assert(size >= PyDict_MINSIZE_SPLIT);
     assert(IS_POWER_OF_2(size));
-    dk = PyMem_MALLOC(sizeof(PyDictKeysObject) +
-                      sizeof(PyDictKeyEntry) * (size-1));
+
+    usable = USABLE_FRACTION(size);
+    if (size <= 0xff) {
+        es = 1;
+    }
+    else if (size <= 0xffff) {
+        es = 2;
+    }
+#if SIZEOF_VOID_P > 4
+    else if (size <= 0xffffffff) {
+        es = sizeof(PY_INT32_T);
+    }
+#endif
+    else {
+        es = sizeof(Py_ssize_t);
+    }
+    dk = PyMem_MALLOC(KEYS_OBJECT_SIZE(size, es));
     if (dk == NULL) {
         PyErr_NoMemory();
         return NULL;
     }
     DK_DEBUG_INCREF dk->dk_refcnt = 1;
     dk->dk_size = size;
-    dk->dk_usable = USABLE_FRACTION(size);
-    ep0 = &dk->dk_entries[0];
-    /* Hash value of slot 0 is used by popitem, so it must be initialized */
-    ep0->me_hash = 0;
-    for (i = 0; i < size; i++) {
-        ep0[i].me_key = NULL;
-        ep0[i].me_value = NULL;
-    }
+    dk->dk_usable = usable;
     dk->dk_lookup = lookdict_unicode_nodummy;
+    dk->dk_nentries = 0;
+    memset(&dk->dk_indices.as_1[0], 0xff, es * size);
+    memset(DK_CTRL(dk), DK_CTRL_EMPTY, size);
+    memset(DK_CTRL(dk) + size, DK_CTRL_SENTINEL, DK_CTRL_SIZE(size) - size);
+    memset(DK_ENTRIES(dk), 0, sizeof(PyDictKeyEntry) * usable);
     return dk;
 }
 
 static void
 free_keys_object(PyDictKeysObject *keys)
 {
-    PyDictKeyEntry *entries = &keys->dk_entries[0];
+    PyDictKeyEntry *entries = DK_ENTRIES(keys);
     Py_ssize_t i, n;
-    for (i = 0, n = DK_SIZE(keys); i < n; i++) {
+    for (i = 0, n = keys->dk_nentries; i < n; i++) {
         Py_XDECREF(entries[i].me_key);
         Py_XDECREF(entries[i].me_value);
     }
@@ -383,6 +685,7 @@ new_dict(PyDictKeysObject *keys, PyObject **values)
     mp->ma_keys = keys;
     mp->ma_values = values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return (PyObject *)mp;
 }
 
@@ -393,7 +696,7 @@ new_dict_with_shared_keys(PyDictKeysObject *keys)
     PyObject **values;
     Py_ssize_t i, size;
 
-    size = DK_SIZE(keys);
+    size = USABLE_FRACTION(DK_SIZE(keys));
     values = new_values(size);
     if (values == NULL) {
         DK_DECREF(keys);
@@ -429,52 +732,83 @@ The details in this version are due to Tim Peters, building on many past
 contributions by Reimer Behrends, Jyrki Alakuijala, Vladimir Marangozov and
 Christian Tismer.
 
-lookdict() is general-purpose, and may return NULL if (and only if) a
+lookdict() is general-purpose, and may return DKIX_ERROR if (and only if) a
 comparison raises an exception (this was new in Python 2.5).
 lookdict_unicode() below is specialized to string keys, comparison of which can
-never raise an exception; that function can never return NULL.
+never raise an exception; that function can never return DKIX_ERROR when key
+is string.  Otherwise, it falls back to lookdict().
 lookdict_unicode_nodummy is further specialized for string keys that cannot be
 the <dummy> value.
-For both, when the key isn't found a PyDictEntry* is returned
-where the key would have been found, *value_addr points to the matching value
-slot.
+For all of them, *value_addr points to the matching value slot when the key
+is found and is set to NULL otherwise; *hashpos (if not NULL) is set to the
+slot of the hash table where the key was found, or where it should be
+inserted.
 */
-static PyDictKeyEntry *
+static Py_ssize_t
 lookdict(PyDictObject *mp, PyObject *key,
-         Py_hash_t hash, PyObject ***value_addr)
+         Py_hash_t hash, PyObject ***value_addr, Py_ssize_t *hashpos)
 {
-    size_t i;
+    size_t g, i, home;
     size_t perturb;
-    PyDictKeyEntry *freeslot;
-    size_t mask;
+    Py_ssize_t ix, freeslot;
+    PyDictKeysObject *dk;
+    signed char *ctrl;
     PyDictKeyEntry *ep0;
     PyDictKeyEntry *ep;
+    dk_groupmask_t m;
+    signed char tag;
     int cmp;
     PyObject *startkey;
 
 top:
-    mask = DK_MASK(mp->ma_keys);
-    ep0 = &mp->ma_keys->dk_entries[0];
-    i = (size_t)hash & mask;
-    ep = &ep0[i];
-    if (ep->me_key == NULL || ep->me_key == key) {
-        *value_addr = &ep->me_value;
-        return ep;
-    }
-    if (ep->me_key == dummy)
-        freeslot = ep;
+    dk = mp->ma_keys;
+    ep0 = DK_ENTRIES(dk);
+    home = i = (size_t)hash & DK_MASK(dk);
+    if (DK_SIZE(dk) >= DK_CTRL_FIRST_MINSIZE) {
+        ctrl = DK_CTRL(dk);
+        if (ctrl[i] == DK_CTRL_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        freeslot = (ctrl[i] == DK_CTRL_DUMMY) ? (Py_ssize_t)i : -1;
+        home = (size_t)-1;
+        goto probe_groups;
+    }
+    ix = dk_get_index(dk, i);
+    if (ix == DKIX_EMPTY) {
+        if (hashpos != NULL)
+            *hashpos = i;
+        *value_addr = NULL;
+        return DKIX_EMPTY;
+    }
+    if (ix == DKIX_DUMMY)
+        freeslot = i;
     else {
+        ep = &ep0[ix];
+        assert(ep->me_key != NULL);
+        if (ep->me_key == key) {
+            *value_addr = &ep->me_value;
+            if (hashpos != NULL)
+                *hashpos = i;
+            return ix;
+        }
         if (ep->me_hash == hash) {
             startkey = ep->me_key;
             Py_INCREF(startkey);
             cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
             Py_DECREF(startkey);
-            if (cmp < 0)
-                return NULL;
-            if (ep0 == mp->ma_keys->dk_entries && ep->me_key == startkey) {
+            if (cmp < 0) {
+                *value_addr = NULL;
+                return DKIX_ERROR;
+            }
+            if (dk == mp->ma_keys && ep->me_key == startkey) {
                 if (cmp > 0) {
                     *value_addr = &ep->me_value;
-                    return ep;
+                    if (hashpos != NULL)
+                        *hashpos = i;
+                    return ix;
                 }
             }
             else {
@@ -482,158 +816,256 @@ top:
                 goto top;
             }
         }
-        freeslot = NULL;
+        freeslot = -1;
     }
 
-    /* In the loop, me_key == dummy is by far (factor of 100s) the
-       least likely outcome, so test for that last. */
+probe_groups:
+    ctrl = DK_CTRL(dk);
+    tag = DK_HASH_TAG(hash);
+    g = ((size_t)hash & DK_MASK(dk)) / DK_GROUP_WIDTH;
     for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
-        if (ep->me_key == NULL) {
-            if (freeslot == NULL) {
+        signed char *grp = ctrl + g * DK_GROUP_WIDTH;
+        for (m = dk_group_match(grp, tag); m; m = DK_GROUPMASK_NEXT(m)) {
+            i = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
+            ix = dk_get_index(dk, i);
+            /* The first slot was compared above already */
+            if (ix < 0 || i == home)
+                continue;
+            ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            if (ep->me_key == key) {
+                if (hashpos != NULL)
+                    *hashpos = i;
                 *value_addr = &ep->me_value;
-                return ep;
-            } else {
-                *value_addr = &freeslot->me_value;
-                return freeslot;
-            }
-        }
-        if (ep->me_key == key) {
-            *value_addr = &ep->me_value;
-            return ep;
-        }
-        if (ep->me_hash == hash && ep->me_key != dummy) {
-            startkey = ep->me_key;
-            Py_INCREF(startkey);
-            cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
-            Py_DECREF(startkey);
-            if (cmp < 0) {
-                *value_addr = NULL;
-                return NULL;
+                return ix;
             }
-            if (ep0 == mp->ma_keys->dk_entries && ep->me_key == startkey) {
-                if (cmp > 0) {
-                    *value_addr = &ep->me_value;
-                    return ep;
+            if (ep->me_hash == hash) {
+                startkey = ep->me_key;
+                Py_INCREF(startkey);
+                cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
+                Py_DECREF(startkey);
+                if (cmp < 0) {
+                    *value_addr = NULL;
+                    return DKIX_ERROR;
+                }
+                if (dk == mp->ma_keys && ep->me_key == startkey) {
+                    if (cmp > 0) {
+                        if (hashpos != NULL)
+                            *hashpos = i;
+                        *value_addr = &ep->me_value;
+                        return ix;
+                    }
+                }
+                else {
+                    /* The dict was mutated, restart */
+                    goto top;
                 }
             }
-            else {
-                /* The dict was mutated, restart */
-                goto top;
+        }
+        if (freeslot == -1 && (m = dk_group_match_free(grp)) != 0)
+            freeslot = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
+        if (dk_group_match_empty(grp)) {
+            if (hashpos != NULL)
+                *hashpos = freeslot;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        g = ((g << 2) + g + perturb + 1) & DK_GROUP_MASK(dk);
+        home = (size_t)-1;
+    }
+    assert(0);          /* NOT REACHED */
+    return 0;
+}
+
+/* Probe the groups of dk for a string key, starting with the group of its
+ * first slot (which the caller may have tested already).  Return the index
+ * of its entry and set *hashpos to its slot, or return DKIX_EMPTY and set
+ * *hashpos to freeslot if it is not -1, else to the first free slot.
+ * Kept out of line so that the string lookups' fast path stays small.
+ */
+static Py_ssize_t DK_NO_INLINE
+lookdict_unicode_groups(PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
+                        Py_ssize_t freeslot, Py_ssize_t *hashpos)
+{
+    size_t g, i;
+    size_t perturb;
+    size_t gmask = DK_GROUP_MASK(dk);
+    Py_ssize_t ix;
+    signed char *ctrl = DK_CTRL(dk);
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
+    PyDictKeyEntry *ep;
+    dk_groupmask_t m;
+    signed char tag = DK_HASH_TAG(hash);
+
+    g = ((size_t)hash & DK_MASK(dk)) / DK_GROUP_WIDTH;
+    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
+        signed char *grp = ctrl + g * DK_GROUP_WIDTH;
+        for (m = dk_group_match(grp, tag); m; m = DK_GROUPMASK_NEXT(m)) {
+            i = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
+            ix = dk_get_index(dk, i);
+            if (ix < 0)
+                continue;
+            ep = &ep0[ix];
+            assert(ep->me_key != NULL && PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key
+                || (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                *hashpos = i;
+                return ix;
             }
         }
-        else if (ep->me_key == dummy && freeslot == NULL)
-            freeslot = ep;
+        /* Dummy slots are by far (factor of 100s) the least likely, so
+           only look for a free slot once per group */
+        if (freeslot == -1 && (m = dk_group_match_free(grp)) != 0)
+            freeslot = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
+        if (dk_group_match_empty(grp)) {
+            *hashpos = freeslot;
+            return DKIX_EMPTY;
+        }
+        g = ((g << 2) + g + perturb + 1) & gmask;
     }
     assert(0);          /* NOT REACHED */
     return 0;
 }
 
 /* Specialized version for string-only keys */
-static PyDictKeyEntry *
+static Py_ssize_t
 lookdict_unicode(PyDictObject *mp, PyObject *key,
-                 Py_hash_t hash, PyObject ***value_addr)
+                 Py_hash_t hash, PyObject ***value_addr, Py_ssize_t *hashpos)
 {
     size_t i;
-    size_t perturb;
-    PyDictKeyEntry *freeslot;
-    size_t mask = DK_MASK(mp->ma_keys);
-    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
+    Py_ssize_t ix, freeslot, pos;
+    PyDictKeysObject *dk = mp->ma_keys;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
     PyDictKeyEntry *ep;
 
+    assert(mp->ma_values == NULL);
     /* Make sure this function doesn't have to handle non-unicode keys,
        including subclasses of str; e.g., one reason to subclass
        unicodes is to override __eq__, and for speed we don't cater to
        that here. */
     if (!PyUnicode_CheckExact(key)) {
-        mp->ma_keys->dk_lookup = lookdict;
-        return lookdict(mp, key, hash, value_addr);
-    }
-    i = (size_t)hash & mask;
-    ep = &ep0[i];
-    if (ep->me_key == NULL || ep->me_key == key) {
-        *value_addr = &ep->me_value;
-        return ep;
+        dk->dk_lookup = lookdict;
+        return lookdict(mp, key, hash, value_addr, hashpos);
+    }
+    i = (size_t)hash & DK_MASK(dk);
+    if (DK_SIZE(dk) >= DK_CTRL_FIRST_MINSIZE) {
+        signed char c = DK_CTRL(dk)[i];
+        if (c == DK_CTRL_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        if (c == DK_HASH_TAG(hash)) {
+            ix = dk_get_index(dk, i);
+            ep = &ep0[ix];
+            if (ep->me_key == key
+                || (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                if (hashpos != NULL)
+                    *hashpos = i;
+                *value_addr = &ep->me_value;
+                return ix;
+            }
+        }
+        freeslot = (c == DK_CTRL_DUMMY) ? (Py_ssize_t)i : -1;
     }
-    if (ep->me_key == dummy)
-        freeslot = ep;
     else {
-        if (ep->me_hash == hash && unicode_eq(ep->me_key, key)) {
-            *value_addr = &ep->me_value;
-            return ep;
+        ix = dk_get_index(dk, i);
+        if (ix == DKIX_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
         }
-        freeslot = NULL;
-    }
-
-    /* In the loop, me_key == dummy is by far (factor of 100s) the
-       least likely outcome, so test for that last. */
-    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
-        if (ep->me_key == NULL) {
-            if (freeslot == NULL) {
+        if (ix == DKIX_DUMMY)
+            freeslot = i;
+        else {
+            ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            if (ep->me_key == key
+                || (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                if (hashpos != NULL)
+                    *hashpos = i;
                 *value_addr = &ep->me_value;
-                return ep;
-            } else {
-                *value_addr = &freeslot->me_value;
-                return freeslot;
+                return ix;
             }
+            freeslot = -1;
         }
-        if (ep->me_key == key
-            || (ep->me_hash == hash
-            && ep->me_key != dummy
-            && unicode_eq(ep->me_key, key))) {
-            *value_addr = &ep->me_value;
-            return ep;
-        }
-        if (ep->me_key == dummy && freeslot == NULL)
-            freeslot = ep;
     }
-    assert(0);          /* NOT REACHED */
-    return 0;
+    ix = lookdict_unicode_groups(dk, key, hash, freeslot, &pos);
+    if (hashpos != NULL)
+        *hashpos = pos;
+    *value_addr = (ix >= 0) ? &ep0[ix].me_value : NULL;
+    return ix;
 }
 
 /* Faster version of lookdict_unicode when it is known that no <dummy> keys
  * will be present. */
-static PyDictKeyEntry *
+static Py_ssize_t
 lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
-                         Py_hash_t hash, PyObject ***value_addr)
+                         Py_hash_t hash, PyObject ***value_addr,
+                         Py_ssize_t *hashpos)
 {
     size_t i;
-    size_t perturb;
-    size_t mask = DK_MASK(mp->ma_keys);
-    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
+    Py_ssize_t ix, pos;
+    PyDictKeysObject *dk = mp->ma_keys;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
     PyDictKeyEntry *ep;
 
+    assert(mp->ma_values == NULL);
     /* Make sure this function doesn't have to handle non-unicode keys,
        including subclasses of str; e.g., one reason to subclass
        unicodes is to override __eq__, and for speed we don't cater to
        that here. */
     if (!PyUnicode_CheckExact(key)) {
-        mp->ma_keys->dk_lookup = lookdict;
-        return lookdict(mp, key, hash, value_addr);
-    }
-    i = (size_t)hash & mask;
-    ep = &ep0[i];
-    assert(ep->me_key == NULL || PyUnicode_CheckExact(ep->me_key));
-    if (ep->me_key == NULL || ep->me_key == key ||
-        (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
-        *value_addr = &ep->me_value;
-        return ep;
+        dk->dk_lookup = lookdict;
+        return lookdict(mp, key, hash, value_addr, hashpos);
+    }
+    i = (size_t)hash & DK_MASK(dk);
+    if (DK_SIZE(dk) >= DK_CTRL_FIRST_MINSIZE) {
+        signed char c = DK_CTRL(dk)[i];
+        if (c == DK_CTRL_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        if (c == DK_HASH_TAG(hash)) {
+            ix = dk_get_index(dk, i);
+            ep = &ep0[ix];
+            if (ep->me_key == key ||
+                (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                if (hashpos != NULL)
+                    *hashpos = i;
+                *value_addr = &ep->me_value;
+                return ix;
+            }
+        }
     }
-    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
-        assert(ep->me_key == NULL || PyUnicode_CheckExact(ep->me_key));
-        if (ep->me_key == NULL || ep->me_key == key ||
+    else {
+        ix = dk_get_index(dk, i);
+        assert (ix != DKIX_DUMMY);
+        if (ix == DKIX_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        ep = &ep0[ix];
+        assert(ep->me_key != NULL && PyUnicode_CheckExact(ep->me_key));
+        if (ep->me_key == key ||
             (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+            if (hashpos != NULL)
+                *hashpos = i;
             *value_addr = &ep->me_value;
-            return ep;
+            return ix;
         }
     }
-    assert(0);          /* NOT REACHED */
-    return 0;
+    ix = lookdict_unicode_groups(dk, key, hash, -1, &pos);
+    if (hashpos != NULL)
+        *hashpos = pos;
+    *value_addr = (ix >= 0) ? &ep0[ix].me_value : NULL;
+    return ix;
 }
 
 /* Version of lookdict for split tables.
@@ -641,43 +1073,100 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
  * Split tables only contain unicode keys and no dummy keys,
  * so algorithm is the same as lookdict_unicode_nodummy.
  */
-static PyDictKeyEntry *
+static Py_ssize_t
 lookdict_split(PyDictObject *mp, PyObject *key,
-               Py_hash_t hash, PyObject ***value_addr)
+               Py_hash_t hash, PyObject ***value_addr, Py_ssize_t *hashpos)
 {
     size_t i;
-    size_t perturb;
-    size_t mask = DK_MASK(mp->ma_keys);
-    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
+    Py_ssize_t ix, pos;
+    PyDictKeysObject *dk = mp->ma_keys;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
     PyDictKeyEntry *ep;
 
     if (!PyUnicode_CheckExact(key)) {
-        ep = lookdict(mp, key, hash, value_addr);
+        ix = lookdict(mp, key, hash, value_addr, hashpos);
         /* lookdict expects a combined-table, so fix value_addr */
-        i = ep - ep0;
-        *value_addr = &mp->ma_values[i];
-        return ep;
+        if (ix >= 0)
+            *value_addr = &mp->ma_values[ix];
+        return ix;
+    }
+    i = (size_t)hash & DK_MASK(dk);
+    if (DK_SIZE(dk) >= DK_CTRL_FIRST_MINSIZE) {
+        signed char c = DK_CTRL(dk)[i];
+        if (c == DK_CTRL_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        if (c == DK_HASH_TAG(hash)) {
+            ix = dk_get_index(dk, i);
+            ep = &ep0[ix];
+            if (ep->me_key == key ||
+                (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                if (hashpos != NULL)
+                    *hashpos = i;
+                *value_addr = &mp->ma_values[ix];
+                return ix;
+            }
+        }
     }
-    i = (size_t)hash & mask;
-    ep = &ep0[i];
-    assert(ep->me_key == NULL || PyUnicode_CheckExact(ep->me_key));
-    if (ep->me_key == NULL || ep->me_key == key ||
-        (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
-        *value_addr = &mp->ma_values[i];
-        return ep;
+    else {
+        ix = dk_get_index(dk, i);
+        assert (ix != DKIX_DUMMY);
+        if (ix == DKIX_EMPTY) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = NULL;
+            return DKIX_EMPTY;
+        }
+        assert(ix < dk->dk_nentries);
+        ep = &ep0[ix];
+        assert(ep->me_key != NULL && PyUnicode_CheckExact(ep->me_key));
+        if (ep->me_key == key ||
+            (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+            if (hashpos != NULL)
+                *hashpos = i;
+            *value_addr = &mp->ma_values[ix];
+            return ix;
+        }
     }
+    ix = lookdict_unicode_groups(dk, key, hash, -1, &pos);
+    assert(ix < dk->dk_nentries);
+    if (hashpos != NULL)
+        *hashpos = pos;
+    *value_addr = (ix >= 0) ? &mp->ma_values[ix] : NULL;
+    return ix;
+}
+
+/* Search the hash table for the slot holding the entry index "index",
+ * knowing the hash of its key.  Used by popitem(), which has the entry
+ * but not the slot pointing to it.
+ */
+static Py_ssize_t
+lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
+{
+    size_t g, i;
+    size_t perturb;
+    size_t gmask = DK_GROUP_MASK(k);
+    signed char *ctrl = DK_CTRL(k);
+    dk_groupmask_t m;
+    signed char tag = DK_HASH_TAG(hash);
+
+    g = ((size_t)hash & DK_MASK(k)) / DK_GROUP_WIDTH;
     for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
-        assert(ep->me_key == NULL || PyUnicode_CheckExact(ep->me_key));
-        if (ep->me_key == NULL || ep->me_key == key ||
-            (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
-            *value_addr = &mp->ma_values[i & mask];
-            return ep;
+        signed char *grp = ctrl + g * DK_GROUP_WIDTH;
+        for (m = dk_group_match(grp, tag); m; m = DK_GROUPMASK_NEXT(m)) {
+            i = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
+            if (dk_get_index(k, i) == index)
+                return i;
         }
+        if (dk_group_match_empty(grp))
+            return DKIX_EMPTY;
+        g = ((g << 2) + g + perturb + 1) & gmask;
     }
     assert(0);          /* NOT REACHED */
-    return 0;
+    return DKIX_ERROR;
 }
 
 int
@@ -710,27 +1199,27 @@ _PyDict_MaybeUntrack(PyObject *op)
 {
     PyDictObject *mp;
     PyObject *value;
-    Py_ssize_t i, size;
+    Py_ssize_t i, numentries;
+    PyDictKeyEntry *ep0;
 
     if (!PyDict_CheckExact(op) || !_PyObject_GC_IS_TRACKED(op))
         return;
 
     mp = (PyDictObject *) op;
-    size = DK_SIZE(mp->ma_keys);
+    ep0 = DK_ENTRIES(mp->ma_keys);
+    numentries = mp->ma_keys->dk_nentries;
     if (_PyDict_HasSplitTable(mp)) {
-        for (i = 0; i < size; i++) {
+        for (i = 0; i < numentries; i++) {
             if ((value = mp->ma_values[i]) == NULL)
                 continue;
             if (_PyObject_GC_MAY_BE_TRACKED(value)) {
-                assert(!_PyObject_GC_MAY_BE_TRACKED(
-                    mp->ma_keys->dk_entries[i].me_key));
+                assert(!_PyObject_GC_MAY_BE_TRACKED(ep0[i].me_key));
                 return;
             }
         }
     }
     else {
-        PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
-        for (i = 0; i < size; i++) {
+        for (i = 0; i < numentries; i++) {
             if ((value = ep0[i].me_value) == NULL)
                 continue;
             if (_PyObject_GC_MAY_BE_TRACKED(value) ||
@@ -743,32 +1232,38 @@ _PyDict_MaybeUntrack(PyObject *op)
 
 /* Internal function to find slot for an item from its hash
  * when it is known that the key is not present in the dict.
+ * The dict must be combined.
  */
-static PyDictKeyEntry *
+static void
 find_empty_slot(PyDictObject *mp, PyObject *key, Py_hash_t hash,
-                PyObject ***value_addr)
+                PyObject ***value_addr, Py_ssize_t *hashpos)
 {
-    size_t i;
+    size_t g, i;
     size_t perturb;
-    size_t mask = DK_MASK(mp->ma_keys);
-    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
-    PyDictKeyEntry *ep;
+    size_t gmask = DK_GROUP_MASK(mp->ma_keys);
+    signed char *ctrl = DK_CTRL(mp->ma_keys);
+    dk_groupmask_t m;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
 
+    assert(!_PyDict_HasSplitTable(mp));
+    assert(hashpos != NULL);
     assert(key != NULL);
     if (!PyUnicode_CheckExact(key))
         mp->ma_keys->dk_lookup = lookdict;
-    i = hash & mask;
-    ep = &ep0[i];
-    for (perturb = hash; ep->me_key != NULL; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
+    assert(ep0[mp->ma_keys->dk_nentries].me_value == NULL);
+    *value_addr = &ep0[mp->ma_keys->dk_nentries].me_value;
+    i = (size_t)hash & DK_MASK(mp->ma_keys);
+    if (ctrl[i] < DK_CTRL_SENTINEL) {
+        *hashpos = i;
+        return;
     }
-    assert(ep->me_value == NULL);
-    if (mp->ma_values)
-        *value_addr = &mp->ma_values[i & mask];
-    else
-        *value_addr = &ep->me_value;
-    return ep;
+    g = i / DK_GROUP_WIDTH;
+    for (perturb = hash;
+         (m = dk_group_match_free(ctrl + g * DK_GROUP_WIDTH)) == 0;
+         perturb >>= PERTURB_SHIFT) {
+        g = ((g << 2) + g + perturb + 1) & gmask;
+    }
+    *hashpos = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
 }
 
 static int
@@ -788,57 +1283,81 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     PyObject *old_value;
     PyObject **value_addr;
     PyDictKeyEntry *ep;
-    assert(key != dummy);
+    Py_ssize_t hashpos, ix;
 
     if (mp->ma_values != NULL && !PyUnicode_CheckExact(key)) {
         if (insertion_resize(mp) < 0)
             return -1;
     }
 
-    ep = mp->ma_keys->dk_lookup(mp, key, hash, &value_addr);
-    if (ep == NULL) {
+    ix = mp->ma_keys->dk_lookup(mp, key, hash, &value_addr, &hashpos);
+    if (ix == DKIX_ERROR) {
         return -1;
     }
     assert(PyUnicode_CheckExact(key) || mp->ma_keys->dk_lookup == lookdict);
     Py_INCREF(value);
     MAINTAIN_TRACKING(mp, key, value);
-    old_value = *value_addr;
-    if (old_value != NULL) {
-        assert(ep->me_key != NULL && ep->me_key != dummy);
-        *value_addr = value;
-        Py_DECREF(old_value); /* which **CAN** re-enter (see issue #22653) */
+
+    /* A split table holds values for a prefix of the shared entries only:
+     * inserting out of the shared order would make its iteration order
+     * differ from its insertion order, so convert it to a combined table.
+     */
+    if (_PyDict_HasSplitTable(mp) &&
+        ((ix >= 0 && *value_addr == NULL && mp->ma_used != ix) ||
+         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+        if (insertion_resize(mp) < 0) {
+            Py_DECREF(value);
+            return -1;
+        }
+        find_empty_slot(mp, key, hash, &value_addr, &hashpos);
+        ix = DKIX_EMPTY;
     }
-    else {
-        if (ep->me_key == NULL) {
-            Py_INCREF(key);
-            if (mp->ma_keys->dk_usable <= 0) {
-                /* Need to resize. */
-                if (insertion_resize(mp) < 0) {
-                    Py_DECREF(key);
-                    Py_DECREF(value);
-                    return -1;
-                }
-                ep = find_empty_slot(mp, key, hash, &value_addr);
+
+    if (ix == DKIX_EMPTY) {
+        /* Insert into new slot. */
+        Py_INCREF(key);
+        if (mp->ma_keys->dk_usable <= 0) {
+            /* Need to resize. */
+            if (insertion_resize(mp) < 0) {
+                Py_DECREF(key);
+                Py_DECREF(value);
+                return -1;
             }
-            mp->ma_keys->dk_usable--;
-            assert(mp->ma_keys->dk_usable >= 0);
-            ep->me_key = key;
-            ep->me_hash = hash;
+            find_empty_slot(mp, key, hash, &value_addr, &hashpos);
+        }
+        ep = &DK_ENTRIES(mp->ma_keys)[mp->ma_keys->dk_nentries];
+        dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries, hash);
+        ep->me_key = key;
+        ep->me_hash = hash;
+        if (mp->ma_values) {
+            assert(mp->ma_values[mp->ma_keys->dk_nentries] == NULL);
+            mp->ma_values[mp->ma_keys->dk_nentries] = value;
         }
         else {
-            if (ep->me_key == dummy) {
-                Py_INCREF(key);
-                ep->me_key = key;
-                ep->me_hash = hash;
-                Py_DECREF(dummy);
-            } else {
-                assert(_PyDict_HasSplitTable(mp));
-            }
+            ep->me_value = value;
         }
         mp->ma_used++;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        mp->ma_keys->dk_usable--;
+        mp->ma_keys->dk_nentries++;
+        assert(mp->ma_keys->dk_usable >= 0);
+        return 0;
+    }
+
+    old_value = *value_addr;
+    if (old_value != NULL) {
         *value_addr = value;
-        assert(ep->me_key != NULL && ep->me_key != dummy);
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        Py_DECREF(old_value); /* which **CAN** re-enter (see issue #22653) */
+        return 0;
     }
+
+    /* pending state */
+    assert(_PyDict_HasSplitTable(mp));
+    assert(ix == mp->ma_used);
+    *value_addr = value;
+    mp->ma_used++;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return 0;
 }
 
@@ -856,25 +1375,33 @@ static void
 insertdict_clean(PyDictObject *mp, PyObject *key, Py_hash_t hash,
                  PyObject *value)
 {
-    size_t i;
+    size_t g, i;
     size_t perturb;
     PyDictKeysObject *k = mp->ma_keys;
-    size_t mask = (size_t)DK_SIZE(k)-1;
-    PyDictKeyEntry *ep0 = &k->dk_entries[0];
+    size_t gmask = DK_GROUP_MASK(k);
+    signed char *ctrl = DK_CTRL(k);
+    dk_groupmask_t m;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(k);
     PyDictKeyEntry *ep;
 
     assert(k->dk_lookup != NULL);
     assert(value != NULL);
     assert(key != NULL);
-    assert(key != dummy);
     assert(PyUnicode_CheckExact(key) || k->dk_lookup == lookdict);
-    i = hash & mask;
-    ep = &ep0[i];
-    for (perturb = hash; ep->me_key != NULL; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        ep = &ep0[i & mask];
+    i = (size_t)hash & DK_MASK(k);
+    if (ctrl[i] != DK_CTRL_EMPTY) {
+        g = i / DK_GROUP_WIDTH;
+        for (perturb = hash;
+             (m = dk_group_match_empty(ctrl + g * DK_GROUP_WIDTH)) == 0;
+             perturb >>= PERTURB_SHIFT) {
+            g = ((g << 2) + g + perturb + 1) & gmask;
+        }
+        i = g * DK_GROUP_WIDTH + dk_groupmask_first(m);
     }
+    ep = &ep0[k->dk_nentries];
     assert(ep->me_value == NULL);
+    dk_set_index(k, i, k->dk_nentries, hash);
+    k->dk_nentries++;
     ep->me_key = key;
     ep->me_hash = hash;
     ep->me_value = value;
@@ -896,7 +1423,8 @@ dictresize(PyDictObject *mp, Py_ssize_t minused)
     Py_ssize_t newsize;
     PyDictKeysObject *oldkeys;
     PyObject **oldvalues;
-    Py_ssize_t i, oldsize;
+    PyDictKeyEntry *ep0;
+    Py_ssize_t i, numentries;
 
 /* Find the smallest table size > minused. */
     for (newsize = PyDict_MINSIZE_COMBINED;
@@ -917,52 +1445,45 @@ dictresize(PyDictObject *mp, Py_ssize_t minused)
     }
     if (oldkeys->dk_lookup == lookdict)
         mp->ma_keys->dk_lookup = lookdict;
-    oldsize = DK_SIZE(oldkeys);
     mp->ma_values = NULL;
     /* If empty then nothing to copy so just return */
-    if (oldsize == 1) {
-        assert(oldkeys == Py_EMPTY_KEYS);
+    if (oldkeys == Py_EMPTY_KEYS) {
         DK_DECREF(oldkeys);
         return 0;
     }
+    ep0 = DK_ENTRIES(oldkeys);
+    numentries = oldkeys->dk_nentries;
     /* Main loop below assumes we can transfer refcount to new keys
      * and that value is stored in me_value.
      * Increment ref-counts and copy values here to compensate
      * This (resizing a split table) should be relatively rare */
     if (oldvalues != NULL) {
-        for (i = 0; i < oldsize; i++) {
+        for (i = 0; i < numentries; i++) {
             if (oldvalues[i] != NULL) {
-                Py_INCREF(oldkeys->dk_entries[i].me_key);
-                oldkeys->dk_entries[i].me_value = oldvalues[i];
+                Py_INCREF(ep0[i].me_key);
+                ep0[i].me_value = oldvalues[i];
             }
         }
     }
-    /* Main loop */
-    for (i = 0; i < oldsize; i++) {
-        PyDictKeyEntry *ep = &oldkeys->dk_entries[i];
+    /* Main loop: entries are reinserted in order, dropping the holes
+       left by deleted items */
+    for (i = 0; i < numentries; i++) {
+        PyDictKeyEntry *ep = &ep0[i];
         if (ep->me_value != NULL) {
-            assert(ep->me_key != dummy);
             insertdict_clean(mp, ep->me_key, ep->me_hash, ep->me_value);
         }
     }
     mp->ma_keys->dk_usable -= mp->ma_used;
     if (oldvalues != NULL) {
         /* NULL out me_value slot in oldkeys, in case it was shared */
-        for (i = 0; i < oldsize; i++)
-            oldkeys->dk_entries[i].me_value = NULL;
+        for (i = 0; i < numentries; i++)
+            ep0[i].me_value = NULL;
         assert(oldvalues != empty_values);
         free_values(oldvalues);
         DK_DECREF(oldkeys);
     }
     else {
         assert(oldkeys->dk_lookup != lookdict_split);
-        if (oldkeys->dk_lookup != lookdict_unicode_nodummy) {
-            PyDictKeyEntry *ep0 = &oldkeys->dk_entries[0];
-            for (i = 0; i < oldsize; i++) {
-                if (ep0[i].me_key == dummy)
-                    Py_DECREF(dummy);
-            }
-        }
         assert(oldkeys->dk_refcnt == 1);
         DK_DEBUG_DECREF PyMem_FREE(oldkeys);
     }
@@ -994,8 +1515,8 @@ make_keys_shared(PyObject *op)
         }
         assert(mp->ma_keys->dk_lookup == lookdict_unicode_nodummy);
         /* Copy values into a new array */
-        ep0 = &mp->ma_keys->dk_entries[0];
-        size = DK_SIZE(mp->ma_keys);
+        ep0 = DK_ENTRIES(mp->ma_keys);
+        size = USABLE_FRACTION(DK_SIZE(mp->ma_keys));
         values = new_values(size);
         if (values == NULL) {
             PyErr_SetString(PyExc_MemoryError,
@@ -1043,7 +1564,7 @@ PyDict_GetItem(PyObject *op, PyObject *key)
 {
     Py_hash_t hash;
     PyDictObject *mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyThreadState *tstate;
     PyObject **value_addr;
 
@@ -1070,15 +1591,15 @@ PyDict_GetItem(PyObject *op, PyObject *key)
         /* preserve the existing exception */
         PyObject *err_type, *err_value, *err_tb;
         PyErr_Fetch(&err_type, &err_value, &err_tb);
-        ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
         /* ignore errors */
         PyErr_Restore(err_type, err_value, err_tb);
-        if (ep == NULL)
+        if (ix < 0)
             return NULL;
     }
     else {
-        ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-        if (ep == NULL) {
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+        if (ix < 0) {
             PyErr_Clear();
             return NULL;
         }
@@ -1090,7 +1611,7 @@ PyObject *
 _PyDict_GetItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
 {
     PyDictObject *mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyThreadState *tstate;
     PyObject **value_addr;
 
@@ -1108,15 +1629,15 @@ _PyDict_GetItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
         /* preserve the existing exception */
         PyObject *err_type, *err_value, *err_tb;
         PyErr_Fetch(&err_type, &err_value, &err_tb);
-        ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
         /* ignore errors */
         PyErr_Restore(err_type, err_value, err_tb);
-        if (ep == NULL)
+        if (ix < 0)
             return NULL;
     }
     else {
-        ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-        if (ep == NULL) {
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+        if (ix < 0) {
             PyErr_Clear();
             return NULL;
         }
@@ -1133,7 +1654,7 @@ PyDict_GetItemWithError(PyObject *op, PyObject *key)
 {
     Py_hash_t hash;
     PyDictObject*mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
     if (!PyDict_Check(op)) {
@@ -1149,8 +1670,8 @@ PyDict_GetItemWithError(PyObject *op, PyObject *key)
         }
     }
 
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix < 0)
         return NULL;
     return *value_addr;
 }
@@ -1176,20 +1697,20 @@ _PyDict_LoadGlobal(PyDictObject *globals, PyDictObject *builtins, PyObject *key)
         PyObject **value_addr;
         Py_hash_t hash = ((PyASCIIObject *)key)->hash;
         if (hash != -1) {
-            PyDictKeyEntry *e;
-            e = globals->ma_keys->dk_lookup(globals, key, hash, &value_addr);
-            if (e == NULL) {
+            Py_ssize_t ix;
+            ix = globals->ma_keys->dk_lookup(globals, key, hash,
+                                             &value_addr, NULL);
+            if (ix == DKIX_ERROR) {
                 return NULL;
             }
-            x = *value_addr;
-            if (x != NULL)
-                return x;
-            e = builtins->ma_keys->dk_lookup(builtins, key, hash, &value_addr);
-            if (e == NULL) {
+            if (ix != DKIX_EMPTY && *value_addr != NULL)
+                return *value_addr;
+            ix = builtins->ma_keys->dk_lookup(builtins, key, hash,
+                                              &value_addr, NULL);
+            if (ix < 0) {
                 return NULL;
             }
-            x = *value_addr;
-            return x;
+            return *value_addr;
         }
     }
     x = PyDict_GetItemWithError((PyObject *)globals, key);
@@ -1253,6 +1774,7 @@ PyDict_DelItem(PyObject *op, PyObject *key)
 {
     PyDictObject *mp;
     Py_hash_t hash;
+    Py_ssize_t hashpos, ix;
     PyDictKeyEntry *ep;
     PyObject *old_key, *old_value;
     PyObject **value_addr;
@@ -1269,23 +1791,33 @@ PyDict_DelItem(PyObject *op, PyObject *key)
             return -1;
     }
     mp = (PyDictObject *)op;
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, &hashpos);
+    if (ix == DKIX_ERROR)
         return -1;
-    if (*value_addr == NULL) {
+    if (ix == DKIX_EMPTY || *value_addr == NULL) {
         _PyErr_SetKeyError(key);
         return -1;
     }
+    /* Split tables only hold a prefix of the shared entries, so they
+       cannot have holes: combine the table first. */
+    if (_PyDict_HasSplitTable(mp)) {
+        /* the entries always fit in a table of the same size */
+        if (dictresize(mp, DK_SIZE(mp->ma_keys) - 1))
+            return -1;
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, &hashpos);
+        assert(ix >= 0);
+    }
+    assert(dk_get_index(mp->ma_keys, hashpos) == ix);
     old_value = *value_addr;
     *value_addr = NULL;
     mp->ma_used--;
-    if (!_PyDict_HasSplitTable(mp)) {
-        ENSURE_ALLOWS_DELETIONS(mp);
-        old_key = ep->me_key;
-        Py_INCREF(dummy);
-        ep->me_key = dummy;
-        Py_DECREF(old_key);
-    }
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    ENSURE_ALLOWS_DELETIONS(mp);
+    dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY, 0);
+    ep = &DK_ENTRIES(mp->ma_keys)[ix];
+    old_key = ep->me_key;
+    ep->me_key = NULL;
+    Py_DECREF(old_key);
     Py_DECREF(old_value);
     return 0;
 }
@@ -1306,13 +1838,15 @@ PyDict_Clear(PyObject *op)
     if (oldvalues == empty_values)
         return;
     /* Empty the dict... */
+    assert(DK_CTRL(Py_EMPTY_KEYS) == empty_keys_struct.ctrl);
     DK_INCREF(Py_EMPTY_KEYS);
     mp->ma_keys = Py_EMPTY_KEYS;
     mp->ma_values = empty_values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     /* ...then clear the keys and values */
     if (oldvalues != NULL) {
-        n = DK_SIZE(oldkeys);
+        n = oldkeys->dk_nentries;
         for (i = 0; i < n; i++)
             Py_CLEAR(oldvalues[i]);
         free_values(oldvalues);
@@ -1330,7 +1864,7 @@ PyDict_Clear(PyObject *op)
 Py_LOCAL_INLINE(Py_ssize_t)
 dict_next(PyObject *op, Py_ssize_t i, PyObject **pvalue)
 {
-    Py_ssize_t mask, offset;
+    Py_ssize_t n, offset;
     PyDictObject *mp;
     PyObject **value_ptr;
 
@@ -1340,20 +1874,22 @@ dict_next(PyObject *op, Py_ssize_t i, PyObject **pvalue)
     mp = (PyDictObject *)op;
     if (i < 0)
         return -1;
+    n = mp->ma_keys->dk_nentries;
+    if (i >= n)
+        return -1;
     if (mp->ma_values) {
         value_ptr = &mp->ma_values[i];
         offset = sizeof(PyObject *);
     }
     else {
-        value_ptr = &mp->ma_keys->dk_entries[i].me_value;
+        value_ptr = &DK_ENTRIES(mp->ma_keys)[i].me_value;
         offset = sizeof(PyDictKeyEntry);
     }
-    mask = DK_MASK(mp->ma_keys);
-    while (i <= mask && *value_ptr == NULL) {
+    while (i < n && *value_ptr == NULL) {
         value_ptr = (PyObject **)(((char *)value_ptr) + offset);
         i++;
     }
-    if (i > mask)
+    if (i >= n)
         return -1;
     if (pvalue)
         *pvalue = *value_ptr;
@@ -1385,7 +1921,7 @@ PyDict_Next(PyObject *op, Py_ssize_t *ppos, PyObject **pkey, PyObject **pvalue)
     mp = (PyDictObject *)op;
     *ppos = i+1;
     if (pkey)
-        *pkey = mp->ma_keys->dk_entries[i].me_key;
+        *pkey = DK_ENTRIES(mp->ma_keys)[i].me_key;
     return 1;
 }
 
@@ -1402,9 +1938,9 @@ _PyDict_Next(PyObject *op, Py_ssize_t *ppos, PyObject **pkey,
         return 0;
     mp = (PyDictObject *)op;
     *ppos = i+1;
-    *phash = mp->ma_keys->dk_entries[i].me_hash;
+    *phash = DK_ENTRIES(mp->ma_keys)[i].me_hash;
     if (pkey)
-        *pkey = mp->ma_keys->dk_entries[i].me_key;
+        *pkey = DK_ENTRIES(mp->ma_keys)[i].me_key;
     return 1;
 }
 
@@ -1416,6 +1952,7 @@ _PyDict_Pop(PyDictObject *mp, PyObject *key, PyObject *deflt)
     PyObject *old_value, *old_key;
     PyDictKeyEntry *ep;
     PyObject **value_addr;
+    Py_ssize_t hashpos, ix;
 
     if (mp->ma_used == 0) {
         if (deflt) {
@@ -1431,11 +1968,10 @@ _PyDict_Pop(PyDictObject *mp, PyObject *key, PyObject *deflt)
         if (hash == -1)
             return NULL;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, &hashpos);
+    if (ix == DKIX_ERROR)
         return NULL;
-    old_value = *value_addr;
-    if (old_value == NULL) {
+    if (ix == DKIX_EMPTY || *value_addr == NULL) {
         if (deflt) {
             Py_INCREF(deflt);
             return deflt;
@@ -1443,15 +1979,23 @@ _PyDict_Pop(PyDictObject *mp, PyObject *key, PyObject *deflt)
         _PyErr_SetKeyError(key);
         return NULL;
     }
+    /* Split tables cannot have holes, see PyDict_DelItem() */
+    if (_PyDict_HasSplitTable(mp)) {
+        if (dictresize(mp, DK_SIZE(mp->ma_keys) - 1))
+            return NULL;
+        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, &hashpos);
+        assert(ix >= 0);
+    }
+    old_value = *value_addr;
     *value_addr = NULL;
     mp->ma_used--;
-    if (!_PyDict_HasSplitTable(mp)) {
-        ENSURE_ALLOWS_DELETIONS(mp);
-        old_key = ep->me_key;
-        Py_INCREF(dummy);
-        ep->me_key = dummy;
-        Py_DECREF(old_key);
-    }
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    ENSURE_ALLOWS_DELETIONS(mp);
+    dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY, 0);
+    ep = &DK_ENTRIES(mp->ma_keys)[ix];
+    old_key = ep->me_key;
+    ep->me_key = NULL;
+    Py_DECREF(old_key);
     return old_value;
 }
 
@@ -1555,7 +2099,7 @@ dict_dealloc(PyDictObject *mp)
     Py_TRASHCAN_SAFE_BEGIN(mp)
     if (values != NULL) {
         if (values != empty_values) {
-            for (i = 0, n = DK_SIZE(mp->ma_keys); i < n; i++) {
+            for (i = 0, n = mp->ma_keys->dk_nentries; i < n; i++) {
                 Py_XDECREF(values[i]);
             }
             free_values(values);
@@ -1668,7 +2212,7 @@ dict_subscript(PyDictObject *mp, PyObject *key)
 {
     PyObject *v;
     Py_hash_t hash;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
     if (!PyUnicode_CheckExact(key) ||
@@ -1677,10 +2221,10 @@ dict_subscript(PyDictObject *mp, PyObject *key)
         if (hash == -1)
             return NULL;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix == DKIX_ERROR)
         return NULL;
-    v = *value_addr;
+    v = (ix == DKIX_EMPTY) ? NULL : *value_addr;
     if (v == NULL) {
         if (!PyDict_CheckExact(mp)) {
             /* Look up __missing__ method if we're a subclass. */
@@ -1740,8 +2284,8 @@ dict_keys(PyDictObject *mp)
         Py_DECREF(v);
         goto again;
     }
-    ep = &mp->ma_keys->dk_entries[0];
-    size = DK_SIZE(mp->ma_keys);
+    ep = DK_ENTRIES(mp->ma_keys);
+    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
         value_ptr = mp->ma_values;
         offset = sizeof(PyObject *);
@@ -1783,13 +2327,13 @@ dict_values(PyDictObject *mp)
         Py_DECREF(v);
         goto again;
     }
-    size = DK_SIZE(mp->ma_keys);
+    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
         value_ptr = mp->ma_values;
         offset = sizeof(PyObject *);
     }
     else {
-        value_ptr = &mp->ma_keys->dk_entries[0].me_value;
+        value_ptr = &DK_ENTRIES(mp->ma_keys)->me_value;
         offset = sizeof(PyDictKeyEntry);
     }
     for (i = 0, j = 0; i < size; i++) {
@@ -1840,8 +2384,8 @@ dict_items(PyDictObject *mp)
         goto again;
     }
     /* Nothing we do below makes any function calls. */
-    ep = mp->ma_keys->dk_entries;
-    size = DK_SIZE(mp->ma_keys);
+    ep = DK_ENTRIES(mp->ma_keys);
+    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
         value_ptr = mp->ma_values;
         offset = sizeof(PyObject *);
@@ -2038,9 +2582,9 @@ PyDict_Merge(PyObject *a, PyObject *b, int override)
         if (mp->ma_keys->dk_usable * 3 < other->ma_used * 2)
             if (dictresize(mp, (mp->ma_used + other->ma_used)*2) != 0)
                return -1;
-        for (i = 0, n = DK_SIZE(other->ma_keys); i < n; i++) {
+        for (i = 0, n = other->ma_keys->dk_nentries; i < n; i++) {
             PyObject *value;
-            entry = &other->ma_keys->dk_entries[i];
+            entry = &DK_ENTRIES(other->ma_keys)[i];
             if (other->ma_values)
                 value = other->ma_values[i];
             else
@@ -2054,6 +2598,11 @@ PyDict_Merge(PyObject *a, PyObject *b, int override)
                                value) != 0)
                     return -1;
             }
+            if (n != other->ma_keys->dk_nentries) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "dict mutated during update");
+                return -1;
+            }
         }
     }
     else {
@@ -2123,7 +2672,9 @@ PyDict_Copy(PyObject *o)
     mp = (PyDictObject *)o;
     if (_PyDict_HasSplitTable(mp)) {
         PyDictObject *split_copy;
-        PyObject **newvalues = new_values(DK_SIZE(mp->ma_keys));
+        PyObject **newvalues;
+        n = USABLE_FRACTION(DK_SIZE(mp->ma_keys));
+        newvalues = new_values(n);
         if (newvalues == NULL)
             return PyErr_NoMemory();
         split_copy = PyObject_GC_New(PyDictObject, &PyDict_Type);
@@ -2134,8 +2685,9 @@ PyDict_Copy(PyObject *o)
         split_copy->ma_values = newvalues;
         split_copy->ma_keys = mp->ma_keys;
         split_copy->ma_used = mp->ma_used;
+        split_copy->ma_version_tag = DICT_NEXT_VERSION();
         DK_INCREF(mp->ma_keys);
-        for (i = 0, n = DK_SIZE(mp->ma_keys); i < n; i++) {
+        for (i = 0; i < n; i++) {
             PyObject *value = mp->ma_values[i];
             Py_XINCREF(value);
             split_copy->ma_values[i] = value;
@@ -2206,8 +2758,8 @@ dict_equal(PyDictObject *a, PyDictObject *b)
         /* can't be equal if # of entries differ */
         return 0;
     /* Same # of entries -- check all of 'em.  Exit early on any diff. */
-    for (i = 0; i < DK_SIZE(a->ma_keys); i++) {
-        PyDictKeyEntry *ep = &a->ma_keys->dk_entries[i];
+    for (i = 0; i < a->ma_keys->dk_nentries; i++) {
+        PyDictKeyEntry *ep = &DK_ENTRIES(a->ma_keys)[i];
         PyObject *aval;
         if (a->ma_values)
             aval = a->ma_values[i];
@@ -2224,7 +2776,8 @@ dict_equal(PyDictObject *a, PyDictObject *b)
             /* ditto for key */
             Py_INCREF(key);
             /* reuse the known hash value */
-            if ((b->ma_keys->dk_lookup)(b, key, ep->me_hash, &vaddr) == NULL)
+            if ((b->ma_keys->dk_lookup)(b, key, ep->me_hash,
+                                        &vaddr, NULL) < 0)
                 bval = NULL;
             else
                 bval = *vaddr;
@@ -2282,7 +2835,7 @@ dict___contains__(PyDictObject *self, PyObject *key)
 {
     register PyDictObject *mp = self;
     Py_hash_t hash;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
     if (!PyUnicode_CheckExact(key) ||
@@ -2291,23 +2844,23 @@ dict___contains__(PyDictObject *self, PyObject *key)
         if (hash == -1)
             return NULL;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix == DKIX_ERROR)
         return NULL;
-    return PyBool_FromLong(*value_addr != NULL);
+    return PyBool_FromLong(ix != DKIX_EMPTY && *value_addr != NULL);
 }
 
 static PyObject *
-dict_get(PyDictObject *mp, PyObject *args)
+dict_get(PyDictObject *mp, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)
 {
     PyObject *key;
     PyObject *failobj = Py_None;
     PyObject *val = NULL;
     Py_hash_t hash;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
-    if (!PyArg_UnpackTuple(args, "get", 1, 2, &key, &failobj))
+    if (!_PyArg_UnpackStack(args, nargs, "get", 1, 2, &key, &failobj))
         return NULL;
 
     if (!PyUnicode_CheckExact(key) ||
@@ -2316,10 +2869,11 @@ dict_get(PyDictObject *mp, PyObject *args)
         if (hash == -1)
             return NULL;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix == DKIX_ERROR)
         return NULL;
-    val = *value_addr;
+    if (ix != DKIX_EMPTY)
+        val = *value_addr;
     if (val == NULL)
         val = failobj;
     Py_INCREF(val);
@@ -2334,6 +2888,7 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     Py_hash_t hash;
     PyDictKeyEntry *ep;
     PyObject **value_addr;
+    Py_ssize_t hashpos, ix;
 
     if (!PyDict_Check(d)) {
         PyErr_BadInternalCall();
@@ -2345,37 +2900,68 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         if (hash == -1)
             return NULL;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    if (ep == NULL)
+    if (mp->ma_values != NULL && !PyUnicode_CheckExact(key)) {
+        if (insertion_resize(mp) < 0)
+            return NULL;
+    }
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, &hashpos);
+    if (ix == DKIX_ERROR)
         return NULL;
-    val = *value_addr;
-    if (val == NULL) {
+    if (ix >= 0 && *value_addr != NULL)
+        return *value_addr;
+
+    /* Same rule as in insertdict() for split tables */
+    if (_PyDict_HasSplitTable(mp) &&
+        ((ix >= 0 && mp->ma_used != ix) ||
+         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+        if (insertion_resize(mp) < 0)
+            return NULL;
+        find_empty_slot(mp, key, hash, &value_addr, &hashpos);
+        ix = DKIX_EMPTY;
+    }
+    val = defaultobj;
+    Py_INCREF(val);
+    MAINTAIN_TRACKING(mp, key, val);
+    if (ix == DKIX_EMPTY) {
         if (mp->ma_keys->dk_usable <= 0) {
             /* Need to resize. */
-            if (insertion_resize(mp) < 0)
+            if (insertion_resize(mp) < 0) {
+                Py_DECREF(val);
                 return NULL;
-            ep = find_empty_slot(mp, key, hash, &value_addr);
+            }
+            find_empty_slot(mp, key, hash, &value_addr, &hashpos);
         }
-        Py_INCREF(defaultobj);
         Py_INCREF(key);
-        MAINTAIN_TRACKING(mp, key, defaultobj);
+        ep = &DK_ENTRIES(mp->ma_keys)[mp->ma_keys->dk_nentries];
+        dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries, hash);
         ep->me_key = key;
         ep->me_hash = hash;
-        *value_addr = defaultobj;
-        val = defaultobj;
+        if (mp->ma_values)
+            mp->ma_values[mp->ma_keys->dk_nentries] = val;
+        else
+            ep->me_value = val;
         mp->ma_keys->dk_usable--;
-        mp->ma_used++;
+        mp->ma_keys->dk_nentries++;
     }
+    else {
+        /* pending slot of a split table */
+        assert(_PyDict_HasSplitTable(mp) && ix == mp->ma_used);
+        *value_addr = val;
+    }
+    mp->ma_used++;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return val;
 }
 
 static PyObject *
-dict_setdefault(PyDictObject *mp, PyObject *args)
+dict_setdefault(PyDictObject *mp, PyObject **args, Py_ssize_t nargs,
+                PyObject *kwargs)
 {
     PyObject *key, *val;
     PyObject *defaultobj = Py_None;
 
-    if (!PyArg_UnpackTuple(args, "setdefault", 1, 2, &key, &defaultobj))
+    if (!_PyArg_UnpackStack(args, nargs, "setdefault", 1, 2,
+                            &key, &defaultobj))
         return NULL;
 
     val = PyDict_SetDefault((PyObject *)mp, key, defaultobj);
@@ -2391,11 +2977,11 @@ dict_clear(PyDictObject *mp)
 }
 
 static PyObject *
-dict_pop(PyDictObject *mp, PyObject *args)
+dict_pop(PyDictObject *mp, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)
 {
     PyObject *key, *deflt = NULL;
 
-    if(!PyArg_UnpackTuple(args, "pop", 1, 2, &key, &deflt))
+    if (!_PyArg_UnpackStack(args, nargs, "pop", 1, 2, &key, &deflt))
         return NULL;
 
     return _PyDict_Pop(mp, key, deflt);
@@ -2404,8 +2990,8 @@ dict_pop(PyDictObject *mp, PyObject *args)
 static PyObject *
 dict_popitem(PyDictObject *mp)
 {
-    Py_hash_t i = 0;
-    PyDictKeyEntry *ep;
+    Py_ssize_t i, j;
+    PyDictKeyEntry *ep0, *ep;
     PyObject *res;
 
 
@@ -2435,37 +3021,30 @@ dict_popitem(PyDictObject *mp)
         }
     }
     ENSURE_ALLOWS_DELETIONS(mp);
-    /* Set ep to "the first" dict entry with a value.  We abuse the hash
-     * field of slot 0 to hold a search finger:
-     * If slot 0 has a value, use slot 0.
-     * Else slot 0 is being used to hold a search finger,
-     * and we use its hash value as the first index to look.
-     */
-    ep = &mp->ma_keys->dk_entries[0];
-    if (ep->me_value == NULL) {
-        Py_ssize_t mask = DK_MASK(mp->ma_keys);
-        i = ep->me_hash;
-        /* The hash field may be a real hash value, or it may be a
-         * legit search finger, or it may be a once-legit search
-         * finger that's out of bounds now because it wrapped around
-         * or the table shrunk -- simply make sure it's in bounds now.
-         */
-        if (i > mask || i < 1)
-            i = 1;              /* skip slot 0 */
-        while ((ep = &mp->ma_keys->dk_entries[i])->me_value == NULL) {
-            i++;
-            if (i > mask)
-                i = 1;
-        }
+
+    /* Pop the last item: no search finger is needed since the entries
+     * array is dense up to dk_nentries, which is trimmed below. */
+    ep0 = DK_ENTRIES(mp->ma_keys);
+    i = mp->ma_keys->dk_nentries - 1;
+    while (i >= 0 && ep0[i].me_value == NULL) {
+        i--;
     }
+    assert(i >= 0);
+
+    ep = &ep0[i];
+    j = lookdict_index(mp->ma_keys, ep->me_hash, i);
+    assert(j >= 0);
+    assert(dk_get_index(mp->ma_keys, j) == i);
+    dk_set_index(mp->ma_keys, j, DKIX_DUMMY, 0);
+
     PyTuple_SET_ITEM(res, 0, ep->me_key);
     PyTuple_SET_ITEM(res, 1, ep->me_value);
-    Py_INCREF(dummy);
-    ep->me_key = dummy;
+    ep->me_key = NULL;
     ep->me_value = NULL;
+    /* We can't dk_usable++ since there is DKIX_DUMMY in indices */
+    mp->ma_keys->dk_nentries = i;
     mp->ma_used--;
-    assert(mp->ma_keys->dk_entries[0].me_value == NULL);
-    mp->ma_keys->dk_entries[0].me_hash = i + 1;  /* next place to start */
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return res;
 }
 
@@ -2474,22 +3053,25 @@ dict_traverse(PyObject *op, visitproc visit, void *arg)
 {
     Py_ssize_t i, n;
     PyDictObject *mp = (PyDictObject *)op;
-    if (mp->ma_keys->dk_lookup == lookdict) {
-        for (i = 0; i < DK_SIZE(mp->ma_keys); i++) {
-            if (mp->ma_keys->dk_entries[i].me_value != NULL) {
-                Py_VISIT(mp->ma_keys->dk_entries[i].me_value);
-                Py_VISIT(mp->ma_keys->dk_entries[i].me_key);
+    PyDictKeysObject *keys = mp->ma_keys;
+    PyDictKeyEntry *entries = DK_ENTRIES(keys);
+
+    if (keys->dk_lookup == lookdict) {
+        for (i = 0, n = keys->dk_nentries; i < n; i++) {
+            if (entries[i].me_value != NULL) {
+                Py_VISIT(entries[i].me_value);
+                Py_VISIT(entries[i].me_key);
             }
         }
     } else {
         if (mp->ma_values != NULL) {
-            for (i = 0, n = DK_SIZE(mp->ma_keys); i < n; i++) {
+            for (i = 0, n = keys->dk_nentries; i < n; i++) {
                 Py_VISIT(mp->ma_values[i]);
             }
         }
         else {
-            for (i = 0, n = DK_SIZE(mp->ma_keys); i < n; i++) {
-                Py_VISIT(mp->ma_keys->dk_entries[i].me_value);
+            for (i = 0, n = keys->dk_nentries; i < n; i++) {
+                Py_VISIT(entries[i].me_value);
             }
         }
     }
@@ -2513,18 +3095,18 @@ _PyDict_SizeOf(PyDictObject *mp)
     size = DK_SIZE(mp->ma_keys);
     res = sizeof(PyDictObject);
     if (mp->ma_values)
-        res += size * sizeof(PyObject*);
+        res += USABLE_FRACTION(size) * sizeof(PyObject*);
     /* If the dictionary is split, the keys portion is accounted-for
        in the type object. */
     if (mp->ma_keys->dk_refcnt == 1)
-        res += sizeof(PyDictKeysObject) + (size-1) * sizeof(PyDictKeyEntry);
+        res += _PyDict_KeysSize(mp->ma_keys);
     return PyLong_FromSsize_t(res);
 }
 
 Py_ssize_t
 _PyDict_KeysSize(PyDictKeysObject *keys)
 {
-    return sizeof(PyDictKeysObject) + (DK_SIZE(keys)-1) * sizeof(PyDictKeyEntry);
+    return KEYS_OBJECT_SIZE(DK_SIZE(keys), DK_IXSIZE(keys));
 }
 
 PyDoc_STRVAR(getitem__doc__, "x.__getitem__(y) <==> x[y]");
@@ -2576,11 +3158,11 @@ static PyMethodDef mapp_methods[] = {
      getitem__doc__},
     {"__sizeof__",      (PyCFunction)_PyDict_SizeOf,       METH_NOARGS,
      sizeof__doc__},
-    {"get",         (PyCFunction)dict_get,          METH_VARARGS,
+    {"get",         (PyCFunction)dict_get,          METH_FASTCALL,
      get__doc__},
-    {"setdefault",  (PyCFunction)dict_setdefault,   METH_VARARGS,
+    {"setdefault",  (PyCFunction)dict_setdefault,   METH_FASTCALL,
      setdefault_doc__},
-    {"pop",         (PyCFunction)dict_pop,          METH_VARARGS,
+    {"pop",         (PyCFunction)dict_pop,          METH_FASTCALL,
      pop__doc__},
     {"popitem",         (PyCFunction)dict_popitem,      METH_NOARGS,
      popitem__doc__},
@@ -2606,7 +3188,7 @@ PyDict_Contains(PyObject *op, PyObject *key)
 {
     Py_hash_t hash;
     PyDictObject *mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
     if (!PyUnicode_CheckExact(key) ||
@@ -2615,8 +3197,10 @@ PyDict_Contains(PyObject *op, PyObject *key)
         if (hash == -1)
             return -1;
     }
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    return (ep == NULL) ? -1 : (*value_addr != NULL);
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix == DKIX_ERROR)
+        return -1;
+    return (ix != DKIX_EMPTY && *value_addr != NULL);
 }
 
 /* Internal version of PyDict_Contains used when the hash value is already known */
@@ -2624,11 +3208,13 @@ int
 _PyDict_Contains(PyObject *op, PyObject *key, Py_hash_t hash)
 {
     PyDictObject *mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
+    Py_ssize_t ix;
     PyObject **value_addr;
 
-    ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
-    return (ep == NULL) ? -1 : (*value_addr != NULL);
+    ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr, NULL);
+    if (ix == DKIX_ERROR)
+        return -1;
+    return (ix != DKIX_EMPTY && *value_addr != NULL);
 }
 
 /* Hack to implement "key in dict" */
@@ -2662,6 +3248,7 @@ dict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         _PyObject_GC_UNTRACK(d);
 
     d->ma_used = 0;
+    d->ma_version_tag = DICT_NEXT_VERSION();
     d->ma_keys = new_keys_object(PyDict_MINSIZE_COMBINED);
     if (d->ma_keys == NULL) {
         Py_DECREF(self);
@@ -2890,7 +3477,7 @@ static PyMethodDef dictiter_methods[] = {
 static PyObject *dictiter_iternextkey(dictiterobject *di)
 {
     PyObject *key;
-    Py_ssize_t i, mask, offset;
+    Py_ssize_t i, n, offset;
     PyDictKeysObject *k;
     PyDictObject *d = di->di_dict;
     PyObject **value_ptr;
@@ -2915,19 +3502,19 @@ static PyObject *dictiter_iternextkey(dictiterobject *di)
         offset = sizeof(PyObject *);
     }
     else {
-        value_ptr = &k->dk_entries[i].me_value;
+        value_ptr = &DK_ENTRIES(k)[i].me_value;
         offset = sizeof(PyDictKeyEntry);
     }
-    mask = DK_SIZE(k)-1;
-    while (i <= mask && *value_ptr == NULL) {
+    n = k->dk_nentries;
+    while (i < n && *value_ptr == NULL) {
         value_ptr = (PyObject **)(((char *)value_ptr) + offset);
         i++;
     }
     di->di_pos = i+1;
-    if (i > mask)
+    if (i >= n)
         goto fail;
     di->len--;
-    key = k->dk_entries[i].me_key;
+    key = DK_ENTRIES(k)[i].me_key;
     Py_INCREF(key);
     return key;
 
@@ -2973,7 +3560,7 @@ PyTypeObject PyDictIterKey_Type = {
 static PyObject *dictiter_iternextvalue(dictiterobject *di)
 {
     PyObject *value;
-    Py_ssize_t i, mask, offset;
+    Py_ssize_t i, n, offset;
     PyDictObject *d = di->di_dict;
     PyObject **value_ptr;
 
@@ -2989,21 +3576,21 @@ static PyObject *dictiter_iternextvalue(dictiterobject *di)
     }
 
     i = di->di_pos;
-    mask = DK_SIZE(d->ma_keys)-1;
-    if (i < 0 || i > mask)
+    n = d->ma_keys->dk_nentries;
+    if (i < 0 || i >= n)
         goto fail;
     if (d->ma_values) {
         value_ptr = &d->ma_values[i];
         offset = sizeof(PyObject *);
     }
     else {
-        value_ptr = &d->ma_keys->dk_entries[i].me_value;
+        value_ptr = &DK_ENTRIES(d->ma_keys)[i].me_value;
         offset = sizeof(PyDictKeyEntry);
     }
-    while (i <= mask && *value_ptr == NULL) {
+    while (i < n && *value_ptr == NULL) {
         value_ptr = (PyObject **)(((char *)value_ptr) + offset);
         i++;
-        if (i > mask)
+        if (i >= n)
             goto fail;
     }
     di->di_pos = i+1;
@@ -3054,7 +3641,7 @@ PyTypeObject PyDictIterValue_Type = {
 static PyObject *dictiter_iternextitem(dictiterobject *di)
 {
     PyObject *key, *value, *result = di->di_result;
-    Py_ssize_t i, mask, offset;
+    Py_ssize_t i, n, offset;
     PyDictObject *d = di->di_dict;
     PyObject **value_ptr;
 
@@ -3072,21 +3659,21 @@ static PyObject *dictiter_iternextitem(dictiterobject *di)
     i = di->di_pos;
     if (i < 0)
         goto fail;
-    mask = DK_SIZE(d->ma_keys)-1;
+    n = d->ma_keys->dk_nentries;
     if (d->ma_values) {
         value_ptr = &d->ma_values[i];
         offset = sizeof(PyObject *);
     }
     else {
-        value_ptr = &d->ma_keys->dk_entries[i].me_value;
+        value_ptr = &DK_ENTRIES(d->ma_keys)[i].me_value;
         offset = sizeof(PyDictKeyEntry);
     }
-    while (i <= mask && *value_ptr == NULL) {
+    while (i < n && *value_ptr == NULL) {
         value_ptr = (PyObject **)(((char *)value_ptr) + offset);
         i++;
     }
     di->di_pos = i+1;
-    if (i > mask)
+    if (i >= n)
         goto fail;
 
     if (result->ob_refcnt == 1) {
@@ -3099,7 +3686,7 @@ static PyObject *dictiter_iternextitem(dictiterobject *di)
             return NULL;
     }
     di->len--;
-    key = d->ma_keys->dk_entries[i].me_key;
+    key = DK_ENTRIES(d->ma_keys)[i].me_key;
     value = *value_ptr;
     Py_INCREF(key);
     Py_INCREF(value);
@@ -3794,14 +4381,13 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
             *dictptr = dict;
         }
         if (value == NULL) {
+            /* Deleting converts this dict to a combined table, but the
+               other instances can keep sharing the cached keys. */
             res = PyDict_DelItem(dict, key);
-            if (cached != ((PyDictObject *)dict)->ma_keys) {
-                CACHED_KEYS(tp) = NULL;
-                DK_DECREF(cached);
-            }
         } else {
+            int was_shared = (cached == ((PyDictObject *)dict)->ma_keys);
             res = PyDict_SetItem(dict, key, value);
-            if (cached != ((PyDictObject *)dict)->ma_keys) {
+            if (was_shared && cached != ((PyDictObject *)dict)->ma_keys) {
                 /* Either update tp->ht_cached_keys or delete it */
                 if (cached->dk_refcnt == 1) {
                     CACHED_KEYS(tp) = make_keys_shared(dict);
@@ -3831,54 +4417,37 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
 }
 
 void
-_PyDictKeys_DecRef(PyDictKeysObject *keys)
+_PyDictKeys_IncRef(PyDictKeysObject *keys)
 {
-    DK_DECREF(keys);
+    DK_INCREF(keys);
 }
 
-
-/* ARGSUSED */
-static PyObject *
-dummy_repr(PyObject *op)
+void
+_PyDictKeys_DecRef(PyDictKeysObject *keys)
 {
-    return PyUnicode_FromString("<dummy key>");
+    DK_DECREF(keys);
 }
 
-/* ARGUSED */
-static void
-dummy_dealloc(PyObject* ignore)
+/* Return the index in ma_values of the value stored under a string key of
+ * a split table, or -1 if the table is combined or the key is missing.
+ * Since shared keys are only ever appended to, the index stays valid for
+ * every dict sharing the same keys object.  Never sets an exception.
+ */
+Py_ssize_t
+_PyDict_GetSplitIndex(PyDictObject *mp, PyObject *key)
 {
-    /* This should never get called, but we also don't want to SEGV if
-     * we accidentally decref dummy-key out of existence.
-     */
-    Py_FatalError("deallocating <dummy key>");
-}
-
-static PyTypeObject PyDictDummy_Type = {
-    PyVarObject_HEAD_INIT(&PyType_Type, 0)
-    "<dummy key> type",
-    0,
-    0,
-    dummy_dealloc,      /*tp_dealloc*/ /*never called*/
-    0,                  /*tp_print*/
-    0,                  /*tp_getattr*/
-    0,                  /*tp_setattr*/
-    0,                  /*tp_reserved*/
-    dummy_repr,         /*tp_repr*/
-    0,                  /*tp_as_number*/
-    0,                  /*tp_as_sequence*/
-    0,                  /*tp_as_mapping*/
-    0,                  /*tp_hash */
-    0,                  /*tp_call */
-    0,                  /*tp_str */
-    0,                  /*tp_getattro */
-    0,                  /*tp_setattro */
-    0,                  /*tp_as_buffer */
-    Py_TPFLAGS_DEFAULT, /*tp_flags */
-};
+    Py_hash_t hash;
+    PyObject **value_addr;
+    Py_ssize_t ix;
 
-static PyObject _dummy_struct = {
-  _PyObject_EXTRA_INIT
-  2, &PyDictDummy_Type
-};
+    if (!_PyDict_HasSplitTable(mp) || !PyUnicode_CheckExact(key))
+        return -1;
+    hash = ((PyASCIIObject *)key)->hash;
+    if (hash == -1)
+        return -1;
+    ix = lookdict_split(mp, key, hash, &value_addr, NULL);
+    if (ix < 0 || *value_addr == NULL)
+        return -1;
+    return ix;
+}
 
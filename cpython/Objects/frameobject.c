@@ -371,53 +371,228 @@ static PyGetSetDef frame_getsetlist[] = {
     {0}
 };
 
-/* Stack frames are allocated and deallocated at a considerable rate.
-   In an attempt to improve the speed of function calls, we:
-
-   1. Hold a single "zombie" frame on each code object. This retains
-   the allocated and initialised frame object from an invocation of
-   the code object. The zombie is reanimated the next time we need a
-   frame object for that code object. Doing this saves the malloc/
-   realloc required when using a free_list frame that isn't the
-   correct size. It also saves some field initialisation.
-
-   In zombie mode, no field of PyFrameObject holds a reference, but
-   the following fields are still valid:
-
-     * ob_type, ob_size, f_code, f_valuestack;
-
-     * f_locals, f_trace,
-       f_exc_type, f_exc_value, f_exc_traceback are NULL;
-
-     * f_localsplus does not require re-allocation and
-       the local variables in f_localsplus are NULL.
-
-   2. We also maintain a separate free list of stack frames (just like
-   floats are allocated in a special way -- see floatobject.c).  When
-   a stack frame is on the free list, only the following members have
-   a meaning:
-    ob_type             == &Frametype
-    f_back              next item on free list, or NULL
-    f_stacksize         size of value stack
-    ob_size             size of localsplus
-   Note that the value and block stacks are preserved -- this can save
-   another malloc() call or two (and two free() calls as well!).
-   Also note that, unlike for integers, each frame object is a
-   malloc'ed object in its own right -- it is only the actual calls to
-   malloc() that we are trying to save here, not the administration.
-   After all, while a typical program may make millions of calls, a
-   call depth of more than 20 or 30 is probably already exceptional
-   unless the program contains run-away recursion.  I hope.
-
-   Later, PyFrame_MAXFREELIST was added to bound the # of frames saved on
-   free_list.  Else programs creating lots of cyclic trash involving
-   frames could provoke free_list into growing without bound.
-*/
+/* Stack frames are allocated and deallocated at a considerable rate, and
+   almost always in LIFO order.  To make this cheap, each thread has a frame
+   arena: a list of large chunks from which frames are bump-allocated.
+
+   Every frame in a chunk is preceded by a small block header that records
+   the chunk and the previous block.  Freeing the most recent block of the
+   current chunk moves the allocation pointer back, together with any blocks
+   right below it that were freed earlier.  A frame that outlives its
+   callers (it was kept alive by a traceback, sys._getframe() or a cycle)
+   is simply freed out of order: its block is marked dead and reclaimed once
+   the blocks above it are gone.  A chunk in which every block is dead is
+   released right away, so a long-lived frame never pins more than its own
+   chunk.
+
+   Generator and coroutine frames routinely outlive the call that created
+   them, so they are allocated on the heap as before.  So is any frame
+   whose block would not fit in a chunk of FRAME_CHUNK_SIZE bytes.
+
+   When a thread state is cleared its arena is detached: empty chunks are
+   freed, and chunks still holding live frames become orphans that are
+   freed when their last frame goes away, whichever thread that happens in.
+   All of this runs with the GIL held. */
+
+#define FRAME_CHUNK_SIZE (32 * 1024)
+
+typedef struct _frame_block {
+    struct _frame_chunk *chunk;
+    struct _frame_block *prev;      /* previous block in the chunk, or NULL */
+    int dead;                       /* the frame was freed */
+} frame_block;
+
+/* Blocks must keep PyGC_Head and the frame suitably aligned */
+#define FRAME_ROUND(n) _Py_SIZE_ROUND_UP(n, SIZEOF_VOID_P)
+#define BLOCK_HEADER_SIZE FRAME_ROUND(sizeof(frame_block))
+
+typedef struct _frame_chunk {
+    struct _frame_chunk *prev;      /* older chunk of the same arena */
+    struct _frame_chunk *next;      /* newer chunk of the same arena */
+    struct _frame_arena *arena;     /* NULL for an orphaned chunk */
+    frame_block *last;              /* most recently allocated block */
+    char *top;                      /* first free byte */
+    char *limit;                    /* end of the chunk */
+    Py_ssize_t nlive;               /* blocks that are not dead */
+} frame_chunk;
+
+#define CHUNK_HEADER_SIZE FRAME_ROUND(sizeof(frame_chunk))
+#define CHUNK_BASE(c) ((char *)(c) + CHUNK_HEADER_SIZE)
+
+struct _frame_arena {
+    frame_chunk *current;           /* chunk new frames come from */
+    frame_chunk *spare;             /* empty chunk kept to avoid thrashing */
+    Py_ssize_t nchunks;             /* chunks in use, not counting spare */
+};
+
+static frame_chunk *
+frame_chunk_new(struct _frame_arena *arena)
+{
+    frame_chunk *chunk;
+
+    if (arena->spare != NULL) {
+        chunk = arena->spare;
+        arena->spare = NULL;
+    }
+    else {
+        chunk = (frame_chunk *)PyMem_Malloc(FRAME_CHUNK_SIZE);
+        if (chunk == NULL)
+            return NULL;
+        chunk->limit = (char *)chunk + FRAME_CHUNK_SIZE;
+    }
+    chunk->prev = arena->current;
+    chunk->next = NULL;
+    chunk->arena = arena;
+    chunk->last = NULL;
+    chunk->top = CHUNK_BASE(chunk);
+    chunk->nlive = 0;
+    if (arena->current != NULL)
+        arena->current->next = chunk;
+    arena->current = chunk;
+    arena->nchunks++;
+    return chunk;
+}
 
-static PyFrameObject *free_list = NULL;
-static int numfree = 0;         /* number of frames currently in free_list */
-/* max value for numfree */
-#define PyFrame_MAXFREELIST 200
+/* Unlink an empty chunk from its arena and free it (or keep it as the
+   spare if it was the arena's current chunk). */
+static void
+frame_chunk_release(frame_chunk *chunk)
+{
+    struct _frame_arena *arena = chunk->arena;
+
+    assert(chunk->nlive == 0);
+    if (arena == NULL) {
+        PyMem_Free(chunk);
+        return;
+    }
+    if (chunk->prev != NULL)
+        chunk->prev->next = chunk->next;
+    if (chunk->next != NULL)
+        chunk->next->prev = chunk->prev;
+    arena->nchunks--;
+    if (arena->current == chunk) {
+        arena->current = chunk->prev;
+        if (arena->spare == NULL) {
+            arena->spare = chunk;
+            return;
+        }
+    }
+    PyMem_Free(chunk);
+}
+
+/* Pop the dead blocks at the top of the current chunk, moving on to the
+   older chunks as they become empty. */
+static void
+frame_arena_trim(struct _frame_arena *arena)
+{
+    frame_chunk *chunk;
+
+    while ((chunk = arena->current) != NULL) {
+        while (chunk->last != NULL && chunk->last->dead) {
+            chunk->top = (char *)chunk->last;
+            chunk->last = chunk->last->prev;
+        }
+        if (chunk->last != NULL || chunk->prev == NULL)
+            break;
+        frame_chunk_release(chunk);
+    }
+}
+
+static PyFrameObject *
+frame_arena_alloc(PyThreadState *tstate, Py_ssize_t extras)
+{
+    struct _frame_arena *arena = tstate->frame_arena;
+    frame_chunk *chunk;
+    frame_block *block;
+    PyGC_Head *g;
+    PyFrameObject *f;
+    size_t size;
+
+    /* Same as _PyObject_VAR_SIZE(), but folds into a constant */
+    size = BLOCK_HEADER_SIZE + FRAME_ROUND(sizeof(PyGC_Head) +
+        sizeof(PyFrameObject) + extras * sizeof(PyObject *));
+    if (size > FRAME_CHUNK_SIZE - CHUNK_HEADER_SIZE)
+        return NULL;
+    if (arena == NULL) {
+        arena = PyMem_New(struct _frame_arena, 1);
+        if (arena == NULL)
+            return NULL;
+        arena->current = arena->spare = NULL;
+        arena->nchunks = 0;
+        tstate->frame_arena = arena;
+    }
+    chunk = arena->current;
+    if (chunk == NULL || (size_t)(chunk->limit - chunk->top) < size) {
+        chunk = frame_chunk_new(arena);
+        if (chunk == NULL)
+            return NULL;
+    }
+
+    block = (frame_block *)chunk->top;
+    block->chunk = chunk;
+    block->prev = chunk->last;
+    block->dead = 0;
+    chunk->last = block;
+    chunk->top += size;
+    chunk->nlive++;
+
+    g = (PyGC_Head *)((char *)block + BLOCK_HEADER_SIZE);
+    g->gc.gc_refs = (size_t)_PyGC_REFS_UNTRACKED << _PyGC_REFS_SHIFT;
+    f = (PyFrameObject *)(g + 1);
+    (void)PyObject_INIT_VAR(f, &PyFrame_Type, extras);
+    f->f_inarena = 1;
+    return f;
+}
+
+static void
+frame_arena_free(PyFrameObject *f)
+{
+    frame_block *block;
+    frame_chunk *chunk;
+
+    block = (frame_block *)((char *)_Py_AS_GC(f) - BLOCK_HEADER_SIZE);
+    chunk = block->chunk;
+    assert(!block->dead && chunk->nlive > 0);
+    chunk->nlive--;
+    if (block == chunk->last) {
+        chunk->top = (char *)block;
+        chunk->last = block->prev;
+        if (chunk->last != NULL && !chunk->last->dead)
+            return;
+    }
+    else
+        block->dead = 1;
+
+    if (chunk->arena == NULL) {
+        if (chunk->nlive == 0)
+            PyMem_Free(chunk);
+    }
+    else if (chunk == chunk->arena->current)
+        frame_arena_trim(chunk->arena);
+    else if (chunk->nlive == 0)
+        frame_chunk_release(chunk);
+}
+
+void
+_PyFrame_DetachArena(PyThreadState *tstate)
+{
+    struct _frame_arena *arena = tstate->frame_arena;
+    frame_chunk *chunk, *prev;
+
+    if (arena == NULL)
+        return;
+    tstate->frame_arena = NULL;
+    for (chunk = arena->current; chunk != NULL; chunk = prev) {
+        prev = chunk->prev;
+        chunk->arena = NULL;
+        chunk->prev = chunk->next = NULL;
+        if (chunk->nlive == 0)
+            PyMem_Free(chunk);
+    }
+    if (arena->spare != NULL)
+        PyMem_Free(arena->spare);
+    PyMem_Free(arena);
+}
 
 static void
 frame_dealloc(PyFrameObject *f)
@@ -448,13 +623,8 @@ frame_dealloc(PyFrameObject *f)
     Py_CLEAR(f->f_exc_traceback);
 
     co = f->f_code;
-    if (co->co_zombieframe == NULL)
-        co->co_zombieframe = f;
-    else if (numfree < PyFrame_MAXFREELIST) {
-        ++numfree;
-        f->f_back = free_list;
-        free_list = f;
-    }
+    if (f->f_inarena)
+        frame_arena_free(f);
     else
         PyObject_GC_Del(f);
 
@@ -622,7 +792,7 @@ PyFrame_New(PyThreadState *tstate, PyCodeObject *code, PyObject *globals,
     PyFrameObject *back = tstate->frame;
     PyFrameObject *f;
     PyObject *builtins;
-    Py_ssize_t i;
+    Py_ssize_t i, extras, ncells, nfrees;
 
 #ifdef Py_DEBUG
     if (code == NULL || globals == NULL || !PyDict_Check(globals) ||
@@ -659,52 +829,31 @@ PyFrame_New(PyThreadState *tstate, PyCodeObject *code, PyObject *globals,
         assert(builtins != NULL);
         Py_INCREF(builtins);
     }
-    if (code->co_zombieframe != NULL) {
-        f = code->co_zombieframe;
-        code->co_zombieframe = NULL;
-        _Py_NewReference((PyObject *)f);
-        assert(f->f_code == code);
+    ncells = PyTuple_GET_SIZE(code->co_cellvars);
+    nfrees = PyTuple_GET_SIZE(code->co_freevars);
+    extras = code->co_stacksize + code->co_nlocals + ncells + nfrees;
+    f = NULL;
+    if (!(code->co_flags & (CO_GENERATOR | CO_COROUTINE))) {
+        /* NULL means the frame doesn't fit; use the heap */
+        f = frame_arena_alloc(tstate, extras);
     }
-    else {
-        Py_ssize_t extras, ncells, nfrees;
-        ncells = PyTuple_GET_SIZE(code->co_cellvars);
-        nfrees = PyTuple_GET_SIZE(code->co_freevars);
-        extras = code->co_stacksize + code->co_nlocals + ncells +
-            nfrees;
-        if (free_list == NULL) {
-            f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type,
-            extras);
-            if (f == NULL) {
-                Py_DECREF(builtins);
-                return NULL;
-            }
-        }
-        else {
-            assert(numfree > 0);
-            --numfree;
-            f = free_list;
-            free_list = free_list->f_back;
-            if (Py_SIZE(f) < extras) {
-                PyFrameObject *new_f = PyObject_GC_Resize(PyFrameObject, f, extras);
-                if (new_f == NULL) {
-                    PyObject_GC_Del(f);
-                    Py_DECREF(builtins);
-                    return NULL;
-                }
-                f = new_f;
-            }
-            _Py_NewReference((PyObject *)f);
+    if (f == NULL) {
+        f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type, extras);
+        if (f == NULL) {
+            Py_DECREF(builtins);
+            return NULL;
         }
-
-        f->f_code = code;
-        extras = code->co_nlocals + ncells + nfrees;
-        f->f_valuestack = f->f_localsplus + extras;
-        for (i=0; i<extras; i++)
-            f->f_localsplus[i] = NULL;
-        f->f_locals = NULL;
-        f->f_trace = NULL;
-        f->f_exc_type = f->f_exc_value = f->f_exc_traceback = NULL;
+        f->f_inarena = 0;
     }
+
+    f->f_code = code;
+    extras = code->co_nlocals + ncells + nfrees;
+    f->f_valuestack = f->f_localsplus + extras;
+    for (i=0; i<extras; i++)
+        f->f_localsplus[i] = NULL;
+    f->f_locals = NULL;
+    f->f_trace = NULL;
+    f->f_exc_type = f->f_exc_value = f->f_exc_traceback = NULL;
     f->f_stacktop = f->f_valuestack;
     f->f_builtins = builtins;
     Py_XINCREF(back);
@@ -977,20 +1126,18 @@ PyFrame_LocalsToFast(PyFrameObject *f, int clear)
     PyErr_Restore(error_type, error_value, error_traceback);
 }
 
-/* Clear out the free list */
+/* Release the spare chunk of the current thread's frame arena */
 int
 PyFrame_ClearFreeList(void)
 {
-    int freelist_size = numfree;
+    PyThreadState *tstate = PyThreadState_GET();
 
-    while (free_list != NULL) {
-        PyFrameObject *f = free_list;
-        free_list = free_list->f_back;
-        PyObject_GC_Del(f);
-        --numfree;
-    }
-    assert(numfree == 0);
-    return freelist_size;
+    if (tstate == NULL || tstate->frame_arena == NULL ||
+        tstate->frame_arena->spare == NULL)
+        return 0;
+    PyMem_Free(tstate->frame_arena->spare);
+    tstate->frame_arena->spare = NULL;
+    return 1;
 }
 
 void
@@ -1003,8 +1150,11 @@ PyFrame_Fini(void)
 void
 _PyFrame_DebugMallocStats(FILE *out)
 {
+    PyThreadState *tstate = PyThreadState_GET();
+    struct _frame_arena *arena = tstate ? tstate->frame_arena : NULL;
+
     _PyDebugAllocatorStats(out,
-                           "free PyFrameObject",
-                           numfree, sizeof(PyFrameObject));
+                           "frame arena chunk",
+                           arena ? arena->nchunks : 0, FRAME_CHUNK_SIZE);
 }
 
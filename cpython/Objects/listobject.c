@@ -91,6 +91,40 @@ show_alloc(void)
 }
 #endif
 
+/* Debug statistic to count GC tracking of lists.
+   Lists whose items are all atomic are untracked when the bytecode or
+   list() builds them, and tracked again when a container is stored in them
+   (see _PyList_MaybeUntrack()).
+*/
+#ifdef SHOW_TRACK_COUNT
+static Py_ssize_t count_untracked = 0;
+static Py_ssize_t count_retracked = 0;
+
+static void
+show_track(void)
+{
+    fprintf(stderr, "Lists untracked when built: %" PY_FORMAT_SIZE_T "d\n",
+        count_untracked);
+    fprintf(stderr, "Lists tracked again: %" PY_FORMAT_SIZE_T "d\n\n",
+        count_retracked);
+}
+#endif
+
+/* Track an untracked list before an item that may take part in a reference
+   cycle is stored in it. */
+#ifdef SHOW_TRACK_COUNT
+#define MAINTAIN_TRACKING(op, item) \
+    do { \
+        if (!_PyObject_GC_IS_TRACKED(op) && \
+            _PyObject_GC_MAY_BE_TRACKED(item)) { \
+            count_retracked++; \
+            _PyObject_GC_TRACK(op); \
+        } \
+    } while(0)
+#else
+#define MAINTAIN_TRACKING(op, item) _PyList_MAINTAIN_TRACKING(op, item)
+#endif
+
 /* Empty list reuse scheme to save calls to malloc and free */
 #ifndef PyList_MAXFREELIST
 #define PyList_MAXFREELIST 80
@@ -115,6 +149,9 @@ void
 PyList_Fini(void)
 {
     PyList_ClearFreeList();
+#ifdef SHOW_TRACK_COUNT
+    show_track();
+#endif
 }
 
 /* Print summary info about the state of the optimized allocator */
@@ -179,6 +216,32 @@ PyList_New(Py_ssize_t size)
     return (PyObject *) op;
 }
 
+/* Untrack a list whose items are all atomic.  The list mutators track it
+   again when they store an item that may take part in a cycle, so this
+   must only be used on lists that are then modified by them (or by code
+   using _PyList_MAINTAIN_TRACKING()), which excludes lists being filled
+   with PyList_SET_ITEM. */
+void
+_PyList_MaybeUntrack(PyObject *op)
+{
+    PyListObject *l;
+    Py_ssize_t i, n;
+
+    if (!PyList_CheckExact(op) || !_PyObject_GC_IS_TRACKED(op))
+        return;
+    l = (PyListObject *) op;
+    n = Py_SIZE(l);
+    for (i = 0; i < n; i++) {
+        PyObject *elt = l->ob_item[i];
+        if (!elt || _PyObject_GC_MAY_BE_TRACKED(elt))
+            return;
+    }
+#ifdef SHOW_TRACK_COUNT
+    count_untracked++;
+#endif
+    _PyObject_GC_UNTRACK(op);
+}
+
 Py_ssize_t
 PyList_Size(PyObject *op)
 {
@@ -232,6 +295,8 @@ PyList_SetItem(PyObject *op, Py_ssize_t i,
     p = ((PyListObject *)op) -> ob_item + i;
     olditem = *p;
     *p = newitem;
+    if (newitem != NULL)
+        MAINTAIN_TRACKING(op, newitem);
     Py_XDECREF(olditem);
     return 0;
 }
@@ -266,6 +331,7 @@ ins1(PyListObject *self, Py_ssize_t where, PyObject *v)
         items[i+1] = items[i];
     Py_INCREF(v);
     items[where] = v;
+    MAINTAIN_TRACKING(self, v);
     return 0;
 }
 
@@ -296,6 +362,7 @@ app1(PyListObject *self, PyObject *v)
 
     Py_INCREF(v);
     PyList_SET_ITEM(self, n, v);
+    MAINTAIN_TRACKING(self, v);
     return 0;
 }
 
@@ -454,6 +521,9 @@ list_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh)
         Py_INCREF(v);
         dest[i] = v;
     }
+    /* the items of an untracked list are atomic */
+    if (!_PyObject_GC_IS_TRACKED(a))
+        _PyObject_GC_UNTRACK(np);
     return (PyObject *)np;
 }
 
@@ -502,6 +572,8 @@ list_concat(PyListObject *a, PyObject *bb)
         Py_INCREF(v);
         dest[i] = v;
     }
+    if (!_PyObject_GC_IS_TRACKED(a) && !_PyObject_GC_IS_TRACKED(b))
+        _PyObject_GC_UNTRACK(np);
     return (PyObject *)np;
 #undef b
 }
@@ -525,6 +597,8 @@ list_repeat(PyListObject *a, Py_ssize_t n)
     if (np == NULL)
         return NULL;
 
+    if (!_PyObject_GC_IS_TRACKED(a))
+        _PyObject_GC_UNTRACK(np);
     items = np->ob_item;
     if (Py_SIZE(a) == 1) {
         elem = a->ob_item[0];
@@ -666,6 +740,8 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
         PyObject *w = vitem[k];
         Py_XINCREF(w);
         item[ilow] = w;
+        if (w != NULL)
+            MAINTAIN_TRACKING(a, w);
     }
     for (k = norig - 1; k >= 0; --k)
         Py_XDECREF(recycle[k]);
@@ -741,6 +817,7 @@ list_ass_item(PyListObject *a, Py_ssize_t i, PyObject *v)
     Py_INCREF(v);
     old_value = a->ob_item[i];
     a->ob_item[i] = v;
+    MAINTAIN_TRACKING(a, v);
     Py_DECREF(old_value);
     return 0;
 }
@@ -820,6 +897,7 @@ listextend(PyListObject *self, PyObject *b)
             PyObject *o = src[i];
             Py_INCREF(o);
             dest[i] = o;
+            MAINTAIN_TRACKING(self, o);
         }
         Py_DECREF(b);
         Py_RETURN_NONE;
@@ -866,6 +944,7 @@ listextend(PyListObject *self, PyObject *b)
             /* steals ref */
             PyList_SET_ITEM(self, Py_SIZE(self), item);
             ++Py_SIZE(self);
+            MAINTAIN_TRACKING(self, item);
         }
         else {
             int status = app1(self, item);
@@ -2316,6 +2395,7 @@ list_init(PyListObject *self, PyObject *args, PyObject *kw)
             return -1;
         Py_DECREF(rv);
     }
+    _PyList_MaybeUntrack((PyObject *)self);
     return 0;
 }
 
@@ -2597,6 +2677,7 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
                 ins = seqitems[i];
                 Py_INCREF(ins);
                 selfitems[cur] = ins;
+                MAINTAIN_TRACKING(self, ins);
             }
 
             for (i = 0; i < slicelength; i++) {
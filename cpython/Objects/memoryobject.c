@@ -2134,6 +2134,22 @@ memory_tolist(PyMemoryViewObject *mv, PyObject *noargs)
     }
 }
 
+/* Return a read-only view of the same buffer.  A new view is returned
+   even if the memoryview is read-only, so that releasing one does not
+   release the other. */
+static PyObject *
+memory_toreadonly(PyMemoryViewObject *self, PyObject *noargs)
+{
+    PyMemoryViewObject *mv;
+
+    CHECK_RELEASED(self);
+
+    mv = (PyMemoryViewObject *)mbuf_add_view(self->mbuf, &self->view);
+    if (mv != NULL)
+        mv->view.readonly = 1;
+    return (PyObject *)mv;
+}
+
 static PyObject *
 memory_tobytes(PyMemoryViewObject *self, PyObject *dummy)
 {
@@ -3078,6 +3094,10 @@ PyDoc_STRVAR(memory_tolist_doc,
 "tolist($self, /)\n--\n\
 \n\
 Return the data in the buffer as a list of elements.");
+PyDoc_STRVAR(memory_toreadonly_doc,
+"toreadonly($self, /)\n--\n\
+\n\
+Return a readonly version of the memoryview.");
 PyDoc_STRVAR(memory_cast_doc,
 "cast($self, /, format, *, shape)\n--\n\
 \n\
@@ -3088,6 +3108,7 @@ static PyMethodDef memory_methods[] = {
     {"tobytes",     (PyCFunction)memory_tobytes, METH_NOARGS, memory_tobytes_doc},
     {"hex",         (PyCFunction)memory_hex, METH_NOARGS, memory_hex_doc},
     {"tolist",      (PyCFunction)memory_tolist, METH_NOARGS, memory_tolist_doc},
+    {"toreadonly",  (PyCFunction)memory_toreadonly, METH_NOARGS, memory_toreadonly_doc},
     {"cast",        (PyCFunction)memory_cast, METH_VARARGS|METH_KEYWORDS, memory_cast_doc},
     {"__enter__",   memory_enter, METH_NOARGS, NULL},
     {"__exit__",    memory_exit, METH_VARARGS, NULL},
@@ -97,6 +97,12 @@ PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
     if (flags == (METH_VARARGS | METH_KEYWORDS)) {
         res = (*(PyCFunctionWithKeywords)meth)(self, args, kwds);
     }
+    else if (flags == (METH_FASTCALL | METH_KEYWORDS)) {
+        if (kwds != NULL && PyDict_Size(kwds) == 0)
+            kwds = NULL;
+        res = (*(_PyCFunctionFast)meth)(self, &PyTuple_GET_ITEM(args, 0),
+                                        PyTuple_GET_SIZE(args), kwds);
+    }
     else {
         if (kwds != NULL && PyDict_Size(kwds) != 0) {
             PyErr_Format(PyExc_TypeError, "%.200s() takes no keyword arguments",
@@ -134,6 +140,11 @@ PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
             res = (*meth)(self, arg);
             break;
 
+        case METH_FASTCALL:
+            res = (*(_PyCFunctionFast)meth)(self, &PyTuple_GET_ITEM(args, 0),
+                                            PyTuple_GET_SIZE(args), NULL);
+            break;
+
         default:
             PyErr_SetString(PyExc_SystemError,
                             "Bad call flags in PyCFunction_Call. "
@@ -145,6 +156,74 @@ PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
     return _Py_CheckFunctionResult(func, res, NULL);
 }
 
+/* Call a built-in function with positional arguments only, taken from a
+   C array.  Only METH_VARARGS functions need a tuple to be built. */
+PyObject *
+_PyCFunction_FastCall(PyObject *func, PyObject **args, Py_ssize_t nargs)
+{
+    PyCFunctionObject* f = (PyCFunctionObject*)func;
+    PyCFunction meth = PyCFunction_GET_FUNCTION(func);
+    PyObject *self = PyCFunction_GET_SELF(func);
+    PyObject *argtuple, *res;
+    Py_ssize_t i;
+    int flags;
+
+    assert(!PyErr_Occurred());
+
+    flags = PyCFunction_GET_FLAGS(func) & ~(METH_CLASS | METH_STATIC | METH_COEXIST);
+
+    switch (flags) {
+    case METH_NOARGS:
+        if (nargs != 0) {
+            PyErr_Format(PyExc_TypeError,
+                "%.200s() takes no arguments (%zd given)",
+                f->m_ml->ml_name, nargs);
+            return NULL;
+        }
+        res = (*meth)(self, NULL);
+        break;
+
+    case METH_O:
+        if (nargs != 1) {
+            PyErr_Format(PyExc_TypeError,
+                "%.200s() takes exactly one argument (%zd given)",
+                f->m_ml->ml_name, nargs);
+            return NULL;
+        }
+        res = (*meth)(self, args[0]);
+        break;
+
+    case METH_FASTCALL:
+    case METH_FASTCALL | METH_KEYWORDS:
+        res = (*(_PyCFunctionFast)meth)(self, args, nargs, NULL);
+        break;
+
+    case METH_VARARGS:
+    case METH_VARARGS | METH_KEYWORDS:
+        argtuple = PyTuple_New(nargs);
+        if (argtuple == NULL)
+            return NULL;
+        for (i = 0; i < nargs; i++) {
+            Py_INCREF(args[i]);
+            PyTuple_SET_ITEM(argtuple, i, args[i]);
+        }
+        if (flags & METH_KEYWORDS)
+            res = (*(PyCFunctionWithKeywords)meth)(self, argtuple, NULL);
+        else
+            res = (*meth)(self, argtuple);
+        Py_DECREF(argtuple);
+        break;
+
+    default:
+        PyErr_SetString(PyExc_SystemError,
+                        "Bad call flags in _PyCFunction_FastCall. "
+                        "METH_OLDARGS is no longer supported!");
+        return NULL;
+    }
+
+    return _Py_CheckFunctionResult(func, res, NULL);
+}
+
 /* Methods (the standard built-in methods, that is) */
 
 static void
@@ -106,10 +106,45 @@ _PyObject_ArenaVirtualFree(void *ctx, void *ptr, size_t size)
 }
 
 #elif defined(ARENAS_USE_MMAP)
+#ifdef MADV_HUGEPAGE
+#define HUGE_PAGE_SIZE          (2 << 20)       /* 2MB */
+
+/* Set from PYTHONMALLOCHUGEPAGES by _PyObject_ConfigureMalloc() */
+static int arena_hugepages = 0;
+
+/* Map size bytes aligned on a huge page boundary, so that the kernel can
+   back the whole range with transparent huge pages. */
+static void *
+arena_mmap_huge(size_t size)
+{
+    char *raw, *ptr;
+    size_t head, tail;
+
+    raw = mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ|PROT_WRITE,
+               MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+        return NULL;
+    ptr = (char *)_Py_ALIGN_UP(raw, HUGE_PAGE_SIZE);
+    head = ptr - raw;
+    tail = HUGE_PAGE_SIZE - head;
+    if (head)
+        munmap(raw, head);
+    if (tail)
+        munmap(ptr + size, tail);
+    /* Only a hint: ignore failures (e.g. THP disabled in the kernel) */
+    (void)madvise(ptr, size, MADV_HUGEPAGE);
+    return ptr;
+}
+#endif
+
 static void *
 _PyObject_ArenaMmap(void *ctx, size_t size)
 {
     void *ptr;
+#ifdef MADV_HUGEPAGE
+    if (arena_hugepages && size % HUGE_PAGE_SIZE == 0)
+        return arena_mmap_huge(size);
+#endif
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
     if (ptr == MAP_FAILED)
@@ -538,7 +573,10 @@ static int running_on_valgrind = -1;
  * The alignment value is also used for grouping small requests in size
  * classes spaced ALIGNMENT bytes apart.
  *
- * You shouldn't change this unless you know what you are doing.
+ * You shouldn't change this unless you know what you are doing.  To get
+ * 16-byte aligned blocks, set PYTHONMALLOCALIGNMENT=16 instead: requests
+ * are then rounded up to the size classes that are multiples of 16 (see
+ * _PyObject_ConfigureMalloc()).
  */
 #define ALIGNMENT               8               /* must be 2^N */
 #define ALIGNMENT_SHIFT         3
@@ -560,6 +598,9 @@ static int running_on_valgrind = -1;
  *
  * Although not required, for better performance and space efficiency,
  * it is recommended that SMALL_REQUEST_THRESHOLD is set to a power of 2.
+ *
+ * PYTHONMALLOCTHRESHOLD can lower the threshold used at runtime, but
+ * SMALL_REQUEST_THRESHOLD remains the upper bound.
  */
 #define SMALL_REQUEST_THRESHOLD 512
 #define NB_SMALL_SIZE_CLASSES   (SMALL_REQUEST_THRESHOLD / ALIGNMENT)
@@ -598,11 +639,16 @@ static int running_on_valgrind = -1;
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * PYTHONMALLOCARENASIZE overrides the arena size at startup; it is kept in
+ * arena_size.  Large arenas cut down the number of mappings for programs
+ * with big heaps, and arenas that are a multiple of 2MB can be backed by
+ * transparent huge pages with PYTHONMALLOCHUGEPAGES.
  */
 #define ARENA_SIZE              (256 << 10)     /* 256KB */
 
 #ifdef WITH_MEMORY_LIMITS
-#define MAX_ARENAS              (SMALL_MEMORY_LIMIT / ARENA_SIZE)
+#define MAX_ARENAS              (SMALL_MEMORY_LIMIT / arena_size)
 #endif
 
 /*
@@ -699,6 +745,16 @@ struct arena_object {
     /* Singly-linked list of available pools. */
     struct pool_header* freepools;
 
+    /* Available pools whose memory was handed back to the system by
+     * _PyObject_ReleaseMemory().  They are not on the freepools list,
+     * since their headers are gone; like never-allocated pools they are
+     * counted in nfreepools and initialized from scratch when reused.
+     * `released` has room for ntotalpools entries, and is allocated the
+     * first time a pool of the arena is released.
+     */
+    struct pool_header** released;
+    uint nreleased;
+
     /* Whenever this arena_object is not associated with an allocated
      * arena, the nextarena member is used to link all unassociated
      * arena_objects in the singly-linked `unused_arena_objects` list.
@@ -900,6 +956,14 @@ Note that an arena_object associated with an arena all of whose pools are
 currently in use isn't on either list.
 */
 
+/* Settings that can be changed from the environment at startup; see
+ * _PyObject_ConfigureMalloc().
+ */
+static size_t arena_size = ARENA_SIZE;
+static uint small_request_threshold = SMALL_REQUEST_THRESHOLD;
+/* OR'ed into (nbytes - 1) before computing the size class */
+static uint alignment_mask = ALIGNMENT - 1;
+
 /* Array of objects used to track chunks of memory (arenas). */
 static struct arena_object* arenas = NULL;
 /* Number of slots currently allocated in the `arenas` vector. */
@@ -938,6 +1002,84 @@ _Py_GetAllocatedBlocks(void)
 }
 
 
+/* Parse the unsigned integer environment variable `name`.  Return 0 if it
+ * is unset or empty; abort with `errmsg` if it isn't an integer in
+ * [minval; maxval].
+ */
+static size_t
+pymalloc_getenv(const char *name, size_t minval, size_t maxval,
+                const char *errmsg)
+{
+    char *env, *endptr;
+    unsigned long value;
+
+    env = Py_GETENV(name);
+    if (env == NULL || *env == '\0')
+        return 0;
+    errno = 0;
+    value = strtoul(env, &endptr, 10);
+    if (*endptr != '\0' || errno == ERANGE
+        || value < minval || value > maxval)
+        Py_FatalError(errmsg);
+    return (size_t)value;
+}
+
+/* Read the pymalloc settings from the environment, once.  Py_Main() calls
+ * this as soon as it knows whether -E or -I was given, before anything is
+ * allocated from an arena; otherwise it happens when the first arena is
+ * allocated.  Py_ADDRESS_IN_RANGE depends on arena_size, so it must not
+ * change once an arena exists.  The threshold and the alignment only decide
+ * how new requests are served.
+ */
+void
+_PyObject_ConfigureMalloc(void)
+{
+    static int configured = 0;
+    size_t value;
+#ifdef MADV_HUGEPAGE
+    char *env;
+#endif
+
+    if (configured)
+        return;
+    configured = 1;
+    value = pymalloc_getenv("PYTHONMALLOCARENASIZE", 64, 256 * 1024,
+        "PYTHONMALLOCARENASIZE must be a number of KiB in range "
+        "[64; 262144], multiple of the pool size");
+    if (value != 0) {
+        if ((value << 10) % POOL_SIZE != 0)
+            Py_FatalError("PYTHONMALLOCARENASIZE must be a number of KiB "
+                          "in range [64; 262144], multiple of the pool size");
+        arena_size = value << 10;
+    }
+
+    value = pymalloc_getenv("PYTHONMALLOCTHRESHOLD", 1,
+        SMALL_REQUEST_THRESHOLD,
+        "PYTHONMALLOCTHRESHOLD must be an integer in range [1; 512]");
+    if (value != 0)
+        small_request_threshold = (uint)value;
+
+    value = pymalloc_getenv("PYTHONMALLOCALIGNMENT", ALIGNMENT, 16,
+        "PYTHONMALLOCALIGNMENT must be 8 or 16");
+    if (value == 16) {
+        /* Blocks start POOL_OVERHEAD bytes into a page-aligned pool and
+           are size bytes apart, size being a multiple of 16 here */
+        assert(POOL_OVERHEAD % 16 == 0);
+        alignment_mask = 15;
+    }
+    else if (value != 0 && value != ALIGNMENT)
+        Py_FatalError("PYTHONMALLOCALIGNMENT must be 8 or 16");
+
+#ifdef MADV_HUGEPAGE
+    env = Py_GETENV("PYTHONMALLOCHUGEPAGES");
+    if (env != NULL && *env != '\0') {
+        arena_hugepages = 1;
+        /* Arenas must be made of whole huge pages */
+        arena_size = _Py_SIZE_ROUND_UP(arena_size, HUGE_PAGE_SIZE);
+    }
+#endif
+}
+
 /* Allocate a new arena.  If we run out of memory, return NULL.  Else
  * allocate a new arena, and return the address of an arena_object
  * describing the new arena.  It's expected that the caller will set
@@ -970,6 +1112,8 @@ new_arena(void)
             return NULL;                /* overflow */
 #endif
         nbytes = numarenas * sizeof(*arenas);
+        if (maxarenas == 0)
+            _PyObject_ConfigureMalloc();
         arenaobj = (struct arena_object *)PyMem_RawRealloc(arenas, nbytes);
         if (arenaobj == NULL)
             return NULL;
@@ -1001,7 +1145,7 @@ new_arena(void)
     arenaobj = unused_arena_objects;
     unused_arena_objects = arenaobj->nextarena;
     assert(arenaobj->address == 0);
-    address = _PyObject_Arena.alloc(_PyObject_Arena.ctx, ARENA_SIZE);
+    address = _PyObject_Arena.alloc(_PyObject_Arena.ctx, arena_size);
     if (address == NULL) {
         /* The allocation failed: return NULL after putting the
          * arenaobj back.
@@ -1017,11 +1161,13 @@ new_arena(void)
     if (narenas_currently_allocated > narenas_highwater)
         narenas_highwater = narenas_currently_allocated;
     arenaobj->freepools = NULL;
+    arenaobj->released = NULL;
+    arenaobj->nreleased = 0;
     /* pool_address <- first pool-aligned address in the arena
        nfreepools <- number of whole pools that fit after alignment */
     arenaobj->pool_address = (block*)arenaobj->address;
-    arenaobj->nfreepools = ARENA_SIZE / POOL_SIZE;
-    assert(POOL_SIZE * arenaobj->nfreepools == ARENA_SIZE);
+    arenaobj->nfreepools = (uint)(arena_size / POOL_SIZE);
+    assert(POOL_SIZE * arenaobj->nfreepools == arena_size);
     excess = (uint)(arenaobj->address & POOL_SIZE_MASK);
     if (excess != 0) {
         --arenaobj->nfreepools;
@@ -1116,7 +1262,7 @@ variable.
 */
 #define Py_ADDRESS_IN_RANGE(P, POOL)                    \
     ((arenaindex_temp = (POOL)->arenaindex) < maxarenas &&              \
-     (uptr)(P) - arenas[arenaindex_temp].address < (uptr)ARENA_SIZE && \
+     (uptr)(P) - arenas[arenaindex_temp].address < (uptr)arena_size && \
      arenas[arenaindex_temp].address != 0)
 
 
@@ -1151,6 +1297,387 @@ int Py_ADDRESS_IN_RANGE(void *P, poolp pool) Py_NO_INLINE;
 #undef Py_NO_INLINE
 #endif
 
+/* Give the block p back to its pool, which must be owned by pymalloc.
+ * Called with the lock held.
+ */
+static void
+pool_free_block(poolp pool, block *p)
+{
+    block *lastfree;
+    poolp next, prev;
+    uint size;
+
+    /* Link p to the start of the pool's freeblock list.  Since
+     * the pool had at least the p block outstanding, the pool
+     * wasn't empty (so it's already in a usedpools[] list, or
+     * was full and is in no list -- it's not in the freeblocks
+     * list in any case).
+     */
+    assert(pool->ref.count > 0);            /* else it was empty */
+    *(block **)p = lastfree = pool->freeblock;
+    pool->freeblock = (block *)p;
+    if (lastfree) {
+        struct arena_object* ao;
+        uint nf;  /* ao->nfreepools */
+
+        /* freeblock wasn't NULL, so the pool wasn't full,
+         * and the pool is in a usedpools[] list.
+         */
+        if (--pool->ref.count != 0) {
+            /* pool isn't empty:  leave it in usedpools */
+            return;
+        }
+        /* Pool is now empty:  unlink from usedpools, and
+         * link to the front of freepools.  This ensures that
+         * previously freed pools will be allocated later
+         * (being not referenced, they are perhaps paged out).
+         */
+        next = pool->nextpool;
+        prev = pool->prevpool;
+        next->prevpool = prev;
+        prev->nextpool = next;
+
+        /* Link the pool to freepools.  This is a singly-linked
+         * list, and pool->prevpool isn't used there.
+         */
+        ao = &arenas[pool->arenaindex];
+        pool->nextpool = ao->freepools;
+        ao->freepools = pool;
+        nf = ++ao->nfreepools;
+
+        /* All the rest is arena management.  We just freed
+         * a pool, and there are 4 cases for arena mgmt:
+         * 1. If all the pools are free, return the arena to
+         *    the system free().
+         * 2. If this is the only free pool in the arena,
+         *    add the arena back to the `usable_arenas` list.
+         * 3. If the "next" arena has a smaller count of free
+         *    pools, we have to "slide this arena right" to
+         *    restore that usable_arenas is sorted in order of
+         *    nfreepools.
+         * 4. Else there's nothing more to do.
+         */
+        if (nf == ao->ntotalpools) {
+            /* Case 1.  First unlink ao from usable_arenas.
+             */
+            assert(ao->prevarena == NULL ||
+                   ao->prevarena->address != 0);
+            assert(ao ->nextarena == NULL ||
+                   ao->nextarena->address != 0);
+
+            /* Fix the pointer in the prevarena, or the
+             * usable_arenas pointer.
+             */
+            if (ao->prevarena == NULL) {
+                usable_arenas = ao->nextarena;
+                assert(usable_arenas == NULL ||
+                       usable_arenas->address != 0);
+            }
+            else {
+                assert(ao->prevarena->nextarena == ao);
+                ao->prevarena->nextarena =
+                    ao->nextarena;
+            }
+            /* Fix the pointer in the nextarena. */
+            if (ao->nextarena != NULL) {
+                assert(ao->nextarena->prevarena == ao);
+                ao->nextarena->prevarena =
+                    ao->prevarena;
+            }
+            /* Record that this arena_object slot is
+             * available to be reused.
+             */
+            ao->nextarena = unused_arena_objects;
+            unused_arena_objects = ao;
+
+            /* Free the entire arena. */
+            _PyObject_Arena.free(_PyObject_Arena.ctx,
+                                 (void *)ao->address, arena_size);
+            ao->address = 0;                        /* mark unassociated */
+            PyMem_RawFree(ao->released);
+            ao->released = NULL;
+            ao->nreleased = 0;
+            --narenas_currently_allocated;
+
+            return;
+        }
+        if (nf == 1) {
+            /* Case 2.  Put ao at the head of
+             * usable_arenas.  Note that because
+             * ao->nfreepools was 0 before, ao isn't
+             * currently on the usable_arenas list.
+             */
+            ao->nextarena = usable_arenas;
+            ao->prevarena = NULL;
+            if (usable_arenas)
+                usable_arenas->prevarena = ao;
+            usable_arenas = ao;
+            assert(usable_arenas->address != 0);
+
+            return;
+        }
+        /* If this arena is now out of order, we need to keep
+         * the list sorted.  The list is kept sorted so that
+         * the "most full" arenas are used first, which allows
+         * the nearly empty arenas to be completely freed.  In
+         * a few un-scientific tests, it seems like this
+         * approach allowed a lot more memory to be freed.
+         */
+        if (ao->nextarena == NULL ||
+                     nf <= ao->nextarena->nfreepools) {
+            /* Case 4.  Nothing to do. */
+            return;
+        }
+        /* Case 3:  We have to move the arena towards the end
+         * of the list, because it has more free pools than
+         * the arena to its right.
+         * First unlink ao from usable_arenas.
+         */
+        if (ao->prevarena != NULL) {
+            /* ao isn't at the head of the list */
+            assert(ao->prevarena->nextarena == ao);
+            ao->prevarena->nextarena = ao->nextarena;
+        }
+        else {
+            /* ao is at the head of the list */
+            assert(usable_arenas == ao);
+            usable_arenas = ao->nextarena;
+        }
+        ao->nextarena->prevarena = ao->prevarena;
+
+        /* Locate the new insertion point by iterating over
+         * the list, using our nextarena pointer.
+         */
+        while (ao->nextarena != NULL &&
+                        nf > ao->nextarena->nfreepools) {
+            ao->prevarena = ao->nextarena;
+            ao->nextarena = ao->nextarena->nextarena;
+        }
+
+        /* Insert ao at this point. */
+        assert(ao->nextarena == NULL ||
+            ao->prevarena == ao->nextarena->prevarena);
+        assert(ao->prevarena->nextarena == ao->nextarena);
+
+        ao->prevarena->nextarena = ao;
+        if (ao->nextarena != NULL)
+            ao->nextarena->prevarena = ao;
+
+        /* Verify that the swaps worked. */
+        assert(ao->nextarena == NULL ||
+                  nf <= ao->nextarena->nfreepools);
+        assert(ao->prevarena == NULL ||
+                  nf > ao->prevarena->nfreepools);
+        assert(ao->nextarena == NULL ||
+            ao->nextarena->prevarena == ao);
+        assert((usable_arenas == ao &&
+            ao->prevarena == NULL) ||
+            ao->prevarena->nextarena == ao);
+
+        return;
+    }
+    /* Pool was full, so doesn't currently live in any list:
+     * link it to the front of the appropriate usedpools[] list.
+     * This mimics LRU pool usage for new allocations and
+     * targets optimal filling when several pools contain
+     * blocks of the same size class.
+     */
+    --pool->ref.count;
+    assert(pool->ref.count > 0);            /* else the pool is empty */
+    size = pool->szidx;
+    next = usedpools[size + size];
+    prev = next->prevpool;
+    /* insert pool before next:   prev <-> pool <-> next */
+    pool->nextpool = next;
+    pool->prevpool = prev;
+    next->prevpool = pool;
+    prev->nextpool = pool;
+}
+
+/*==========================================================================*/
+
+/* Per-thread caches of free blocks.
+ *
+ * Each thread state gets a "magazine" of free blocks per size class, which
+ * is filled from the pools and given back to them in batches.  Most
+ * allocations and deallocations then only touch memory private to the
+ * thread and the block itself, instead of the shared usedpools[] lists and
+ * pool headers.  A magazine holds about MAGAZINE_BYTES; when it grows past
+ * that, half of its blocks go back to their pools.
+ *
+ * The cache of a thread is created by its first free() and emptied when
+ * its thread state is cleared.  Blocks sitting in a cache are allocated as
+ * far as the pools are concerned.
+ *
+ * The caches are only compiled in when PYMALLOC_THREAD_CACHE is defined
+ * (see Misc/SpecialBuilds.txt): as long as the GIL serializes allocations,
+ * they cost more than they save.  pgen has no thread states, and links its
+ * own build of this file with PGEN defined.
+ */
+
+#if defined(PGEN) || !defined(WITH_THREAD)
+#undef PYMALLOC_THREAD_CACHE
+#endif
+
+#ifdef PYMALLOC_THREAD_CACHE
+
+#define MAGAZINE_BYTES          1024
+#define MAGAZINE_MIN_BLOCKS     4
+
+struct magazine {
+    block *head;        /* free blocks, linked through their first word */
+    uint count;         /* number of blocks in the list */
+    uint capacity;      /* give half of the blocks back above this */
+};
+
+struct _obmalloc_cache {
+    struct magazine mags[NB_SMALL_SIZE_CLASSES];
+};
+
+/* Statistics for _PyObject_DebugMallocStats() */
+static size_t ntimes_magazine_refilled = 0;
+static size_t ntimes_magazine_flushed = 0;
+
+static struct _obmalloc_cache *
+cache_new(void)
+{
+    struct _obmalloc_cache *cache;
+    uint i;
+
+    cache = (struct _obmalloc_cache *)PyMem_RawMalloc(sizeof(*cache));
+    if (cache == NULL)
+        return NULL;
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; i++) {
+        struct magazine *mag = &cache->mags[i];
+        mag->head = NULL;
+        mag->count = 0;
+        mag->capacity = MAGAZINE_BYTES / INDEX2SIZE(i);
+        if (mag->capacity < MAGAZINE_MIN_BLOCKS)
+            mag->capacity = MAGAZINE_MIN_BLOCKS;
+    }
+    return cache;
+}
+
+/* Move up to n blocks of size class `size` from the used pools to `mag`.
+ * Only pools already in use are drawn from: when there are none, the
+ * caller falls back to the general path, which sets up a new pool.
+ * Called with the lock held.
+ */
+static void
+magazine_refill(struct magazine *mag, uint size, uint n)
+{
+    block *bp;
+    poolp pool;
+    poolp next;
+
+    ++ntimes_magazine_refilled;
+    for (; n > 0; n--) {
+        pool = usedpools[size + size];
+        if (pool == pool->nextpool)
+            break;
+        /* Same as the most frequent path of _PyObject_Alloc() */
+        ++pool->ref.count;
+        bp = pool->freeblock;
+        assert(bp != NULL);
+        if ((pool->freeblock = *(block **)bp) == NULL) {
+            if (pool->nextoffset <= pool->maxnextoffset) {
+                /* There is room for another block. */
+                pool->freeblock = (block*)pool +
+                                  pool->nextoffset;
+                pool->nextoffset += INDEX2SIZE(size);
+                *(block **)(pool->freeblock) = NULL;
+            }
+            else {
+                /* Pool is full, unlink from used pools. */
+                next = pool->nextpool;
+                pool = pool->prevpool;
+                next->prevpool = pool;
+                pool->nextpool = next;
+            }
+        }
+        *(block **)bp = mag->head;
+        mag->head = bp;
+        ++mag->count;
+    }
+}
+
+/* Give the n first blocks of `mag` back to their pools.  Called with the
+ * lock held.
+ */
+static void
+magazine_flush(struct magazine *mag, uint n)
+{
+    block *bp;
+
+    ++ntimes_magazine_flushed;
+    assert(n <= mag->count);
+    for (; n > 0; n--) {
+        bp = mag->head;
+        mag->head = *(block **)bp;
+        --mag->count;
+        pool_free_block(POOL_ADDR(bp), bp);
+    }
+}
+
+/* Give all the blocks of `cache` back to their pools.  Called with the
+ * lock held.
+ */
+static void
+cache_flush(struct _obmalloc_cache *cache, void *unused)
+{
+    uint i;
+
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; i++) {
+        if (cache->mags[i].count > 0)
+            magazine_flush(&cache->mags[i], cache->mags[i].count);
+    }
+}
+
+/* Empty and free the block cache of `tstate`.  Called when the thread
+ * state is cleared or deleted: the GIL is held unless the cache is
+ * already gone.
+ */
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+    struct _obmalloc_cache *cache = tstate->obmalloc_cache;
+
+    if (cache == NULL)
+        return;
+    tstate->obmalloc_cache = NULL;
+    LOCK();
+    cache_flush(cache, NULL);
+    UNLOCK();
+    PyMem_RawFree(cache);
+}
+
+/* Call func(cache) on the block cache of every thread state */
+static void
+foreach_thread_cache(void (*func)(struct _obmalloc_cache *, void *),
+                     void *arg)
+{
+    PyInterpreterState *interp;
+    PyThreadState *tstate;
+
+    for (interp = PyInterpreterState_Head(); interp != NULL;
+         interp = PyInterpreterState_Next(interp)) {
+        for (tstate = PyInterpreterState_ThreadHead(interp); tstate != NULL;
+             tstate = PyThreadState_Next(tstate)) {
+            if (tstate->obmalloc_cache != NULL)
+                func(tstate->obmalloc_cache, arg);
+        }
+    }
+}
+
+#else   /* !PYMALLOC_THREAD_CACHE */
+
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+}
+
+#endif  /* PYMALLOC_THREAD_CACHE */
+
 /*==========================================================================*/
 
 /* malloc.  Note that nbytes==0 tries to return a non-NULL pointer, distinct
@@ -1173,6 +1700,10 @@ _PyObject_Alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
     poolp pool;
     poolp next;
     uint size;
+#ifdef PYMALLOC_THREAD_CACHE
+    PyThreadState *tstate;
+    struct magazine *mag;
+#endif
 
     _Py_AllocatedBlocks++;
 
@@ -1189,12 +1720,32 @@ _PyObject_Alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
     if (nelem == 0 || elsize == 0)
         goto redirect;
 
-    if ((nbytes - 1) < SMALL_REQUEST_THRESHOLD) {
-        LOCK();
+    if ((nbytes - 1) < small_request_threshold) {
+        size = (uint)((nbytes - 1) | alignment_mask) >> ALIGNMENT_SHIFT;
+#ifdef PYMALLOC_THREAD_CACHE
         /*
-         * Most frequent paths first
+         * Most frequent paths first: the thread's cache
          */
-        size = (uint)(nbytes - 1) >> ALIGNMENT_SHIFT;
+        tstate = (PyThreadState*)_Py_atomic_load_relaxed(
+            &_PyThreadState_Current);
+        if (tstate != NULL && tstate->obmalloc_cache != NULL) {
+            mag = &tstate->obmalloc_cache->mags[size];
+            if (mag->count == 0) {
+                LOCK();
+                magazine_refill(mag, size, mag->capacity / 2);
+                UNLOCK();
+            }
+            if ((bp = mag->head) != NULL) {
+                mag->head = *(block **)bp;
+                --mag->count;
+                if (use_calloc)
+                    memset(bp, 0, nbytes);
+                return (void *)bp;
+            }
+        }
+#endif
+
+        LOCK();
         pool = usedpools[size + size];
         if (pool != pool->nextpool) {
             /*
@@ -1290,9 +1841,10 @@ _PyObject_Alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
                  * time.
                  */
                 assert(usable_arenas->freepools != NULL ||
+                       usable_arenas->nreleased > 0 ||
                        usable_arenas->pool_address <=
                        (block*)usable_arenas->address +
-                           ARENA_SIZE - POOL_SIZE);
+                           arena_size - POOL_SIZE);
             }
         init_pool:
             /* Frontlink to used pools. */
@@ -1333,16 +1885,23 @@ _PyObject_Alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
             return (void *)bp;
         }
 
-        /* Carve off a new pool. */
+        /* Reuse a released pool, or carve off a new one.  Either way
+         * its memory is fresh from the system.
+         */
         assert(usable_arenas->nfreepools > 0);
         assert(usable_arenas->freepools == NULL);
-        pool = (poolp)usable_arenas->pool_address;
-        assert((block*)pool <= (block*)usable_arenas->address +
-                               ARENA_SIZE - POOL_SIZE);
+        if (usable_arenas->nreleased > 0) {
+            pool = usable_arenas->released[--usable_arenas->nreleased];
+        }
+        else {
+            pool = (poolp)usable_arenas->pool_address;
+            assert((block*)pool <= (block*)usable_arenas->address +
+                                   arena_size - POOL_SIZE);
+            usable_arenas->pool_address += POOL_SIZE;
+        }
         pool->arenaindex = (uint)(usable_arenas - arenas);
         assert(&arenas[pool->arenaindex] == usable_arenas);
         pool->szidx = DUMMY_SIZE_IDX;
-        usable_arenas->pool_address += POOL_SIZE;
         --usable_arenas->nfreepools;
 
         if (usable_arenas->nfreepools == 0) {
@@ -1399,9 +1958,10 @@ static void
 _PyObject_Free(void *ctx, void *p)
 {
     poolp pool;
-    block *lastfree;
-    poolp next, prev;
-    uint size;
+#ifdef PYMALLOC_THREAD_CACHE
+    PyThreadState *tstate;
+    struct magazine *mag;
+#endif
 #ifndef Py_USING_MEMORY_DEBUGGER
     uint arenaindex_temp;
 #endif
@@ -1419,194 +1979,27 @@ _PyObject_Free(void *ctx, void *p)
     pool = POOL_ADDR(p);
     if (Py_ADDRESS_IN_RANGE(p, pool)) {
         /* We allocated this address. */
-        LOCK();
-        /* Link p to the start of the pool's freeblock list.  Since
-         * the pool had at least the p block outstanding, the pool
-         * wasn't empty (so it's already in a usedpools[] list, or
-         * was full and is in no list -- it's not in the freeblocks
-         * list in any case).
-         */
-        assert(pool->ref.count > 0);            /* else it was empty */
-        *(block **)p = lastfree = pool->freeblock;
-        pool->freeblock = (block *)p;
-        if (lastfree) {
-            struct arena_object* ao;
-            uint nf;  /* ao->nfreepools */
-
-            /* freeblock wasn't NULL, so the pool wasn't full,
-             * and the pool is in a usedpools[] list.
-             */
-            if (--pool->ref.count != 0) {
-                /* pool isn't empty:  leave it in usedpools */
-                UNLOCK();
-                return;
-            }
-            /* Pool is now empty:  unlink from usedpools, and
-             * link to the front of freepools.  This ensures that
-             * previously freed pools will be allocated later
-             * (being not referenced, they are perhaps paged out).
-             */
-            next = pool->nextpool;
-            prev = pool->prevpool;
-            next->prevpool = prev;
-            prev->nextpool = next;
-
-            /* Link the pool to freepools.  This is a singly-linked
-             * list, and pool->prevpool isn't used there.
-             */
-            ao = &arenas[pool->arenaindex];
-            pool->nextpool = ao->freepools;
-            ao->freepools = pool;
-            nf = ++ao->nfreepools;
-
-            /* All the rest is arena management.  We just freed
-             * a pool, and there are 4 cases for arena mgmt:
-             * 1. If all the pools are free, return the arena to
-             *    the system free().
-             * 2. If this is the only free pool in the arena,
-             *    add the arena back to the `usable_arenas` list.
-             * 3. If the "next" arena has a smaller count of free
-             *    pools, we have to "slide this arena right" to
-             *    restore that usable_arenas is sorted in order of
-             *    nfreepools.
-             * 4. Else there's nothing more to do.
-             */
-            if (nf == ao->ntotalpools) {
-                /* Case 1.  First unlink ao from usable_arenas.
-                 */
-                assert(ao->prevarena == NULL ||
-                       ao->prevarena->address != 0);
-                assert(ao ->nextarena == NULL ||
-                       ao->nextarena->address != 0);
-
-                /* Fix the pointer in the prevarena, or the
-                 * usable_arenas pointer.
-                 */
-                if (ao->prevarena == NULL) {
-                    usable_arenas = ao->nextarena;
-                    assert(usable_arenas == NULL ||
-                           usable_arenas->address != 0);
-                }
-                else {
-                    assert(ao->prevarena->nextarena == ao);
-                    ao->prevarena->nextarena =
-                        ao->nextarena;
-                }
-                /* Fix the pointer in the nextarena. */
-                if (ao->nextarena != NULL) {
-                    assert(ao->nextarena->prevarena == ao);
-                    ao->nextarena->prevarena =
-                        ao->prevarena;
+#ifdef PYMALLOC_THREAD_CACHE
+        tstate = (PyThreadState*)_Py_atomic_load_relaxed(
+            &_PyThreadState_Current);
+        if (tstate != NULL) {
+            if (tstate->obmalloc_cache == NULL)
+                tstate->obmalloc_cache = cache_new();
+            if (tstate->obmalloc_cache != NULL) {
+                mag = &tstate->obmalloc_cache->mags[pool->szidx];
+                *(block **)p = mag->head;
+                mag->head = (block *)p;
+                if (++mag->count > mag->capacity) {
+                    LOCK();
+                    magazine_flush(mag, mag->count / 2);
+                    UNLOCK();
                 }
-                /* Record that this arena_object slot is
-                 * available to be reused.
-                 */
-                ao->nextarena = unused_arena_objects;
-                unused_arena_objects = ao;
-
-                /* Free the entire arena. */
-                _PyObject_Arena.free(_PyObject_Arena.ctx,
-                                     (void *)ao->address, ARENA_SIZE);
-                ao->address = 0;                        /* mark unassociated */
-                --narenas_currently_allocated;
-
-                UNLOCK();
                 return;
             }
-            if (nf == 1) {
-                /* Case 2.  Put ao at the head of
-                 * usable_arenas.  Note that because
-                 * ao->nfreepools was 0 before, ao isn't
-                 * currently on the usable_arenas list.
-                 */
-                ao->nextarena = usable_arenas;
-                ao->prevarena = NULL;
-                if (usable_arenas)
-                    usable_arenas->prevarena = ao;
-                usable_arenas = ao;
-                assert(usable_arenas->address != 0);
-
-                UNLOCK();
-                return;
-            }
-            /* If this arena is now out of order, we need to keep
-             * the list sorted.  The list is kept sorted so that
-             * the "most full" arenas are used first, which allows
-             * the nearly empty arenas to be completely freed.  In
-             * a few un-scientific tests, it seems like this
-             * approach allowed a lot more memory to be freed.
-             */
-            if (ao->nextarena == NULL ||
-                         nf <= ao->nextarena->nfreepools) {
-                /* Case 4.  Nothing to do. */
-                UNLOCK();
-                return;
-            }
-            /* Case 3:  We have to move the arena towards the end
-             * of the list, because it has more free pools than
-             * the arena to its right.
-             * First unlink ao from usable_arenas.
-             */
-            if (ao->prevarena != NULL) {
-                /* ao isn't at the head of the list */
-                assert(ao->prevarena->nextarena == ao);
-                ao->prevarena->nextarena = ao->nextarena;
-            }
-            else {
-                /* ao is at the head of the list */
-                assert(usable_arenas == ao);
-                usable_arenas = ao->nextarena;
-            }
-            ao->nextarena->prevarena = ao->prevarena;
-
-            /* Locate the new insertion point by iterating over
-             * the list, using our nextarena pointer.
-             */
-            while (ao->nextarena != NULL &&
-                            nf > ao->nextarena->nfreepools) {
-                ao->prevarena = ao->nextarena;
-                ao->nextarena = ao->nextarena->nextarena;
-            }
-
-            /* Insert ao at this point. */
-            assert(ao->nextarena == NULL ||
-                ao->prevarena == ao->nextarena->prevarena);
-            assert(ao->prevarena->nextarena == ao->nextarena);
-
-            ao->prevarena->nextarena = ao;
-            if (ao->nextarena != NULL)
-                ao->nextarena->prevarena = ao;
-
-            /* Verify that the swaps worked. */
-            assert(ao->nextarena == NULL ||
-                      nf <= ao->nextarena->nfreepools);
-            assert(ao->prevarena == NULL ||
-                      nf > ao->prevarena->nfreepools);
-            assert(ao->nextarena == NULL ||
-                ao->nextarena->prevarena == ao);
-            assert((usable_arenas == ao &&
-                ao->prevarena == NULL) ||
-                ao->prevarena->nextarena == ao);
-
-            UNLOCK();
-            return;
         }
-        /* Pool was full, so doesn't currently live in any list:
-         * link it to the front of the appropriate usedpools[] list.
-         * This mimics LRU pool usage for new allocations and
-         * targets optimal filling when several pools contain
-         * blocks of the same size class.
-         */
-        --pool->ref.count;
-        assert(pool->ref.count > 0);            /* else the pool is empty */
-        size = pool->szidx;
-        next = usedpools[size + size];
-        prev = next->prevpool;
-        /* insert pool before next:   prev <-> pool <-> next */
-        pool->nextpool = next;
-        pool->prevpool = prev;
-        next->prevpool = pool;
-        prev->nextpool = pool;
+#endif
+        LOCK();
+        pool_free_block(pool, (block *)p);
         UNLOCK();
         return;
     }
@@ -1695,6 +2088,199 @@ _PyObject_Realloc(void *ctx, void *p, size_t nbytes)
     return bp ? bp : p;
 }
 
+/* Tell the system that the nbytes of memory at p won't be needed for a
+ * while.  p and nbytes must be multiples of the system page size.  Return
+ * 1 on success: the contents of the memory, pool headers included, are then
+ * lost.
+ */
+static int
+release_pages(void *p, size_t nbytes)
+{
+#if defined(MS_WINDOWS) && !defined(MS_UWP)
+    return VirtualAlloc(p, nbytes, MEM_RESET, PAGE_READWRITE) != NULL;
+#elif defined(ARENAS_USE_MMAP) && defined(MADV_DONTNEED)
+    return madvise(p, nbytes, MADV_DONTNEED) == 0;
+#else
+    return 0;
+#endif
+}
+
+/* The unit in which memory is handed back to the system: the page size,
+ * which may be larger than a pool (64 KiB on some arm64 and ppc64 kernels),
+ * or a huge page for arenas backed by them, which releasing part of would
+ * split.
+ */
+static size_t
+release_unit(void)
+{
+    size_t unit = POOL_SIZE;
+#if defined(ARENAS_USE_MMAP) && defined(_SC_PAGESIZE)
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if (page_size > 0 && (size_t)page_size > unit)
+        unit = (size_t)page_size;
+#endif
+#ifdef MADV_HUGEPAGE
+    if (arena_hugepages && arena_size % HUGE_PAGE_SIZE == 0)
+        unit = HUGE_PAGE_SIZE;
+#endif
+    return unit;
+}
+
+/* States of the pools of an arena in release_arena_pages() */
+#define POOL_IN_USE     0
+#define POOL_FREE       1       /* on the freepools list */
+#define POOL_RELEASED   2       /* released before, or never carved off */
+#define POOL_RELEASING  3       /* free, in a unit holding no pool in use */
+
+/* Hand back to the system the units of `unit` bytes of arena `ao` that hold
+ * free pools and no pool in use, and move those free pools from the
+ * freepools list to the released ones.  Adjacent units are released with
+ * a single call.  `state` has room for ao->ntotalpools entries.  Return the
+ * number of bytes in the pools released; set *failed if the system refused.
+ */
+static size_t
+release_arena_pages(struct arena_object *ao, size_t unit, char *state,
+                    int *failed)
+{
+    uptr base = _Py_SIZE_ROUND_UP(ao->address, POOL_SIZE);
+    uptr first = _Py_SIZE_ROUND_UP(base, unit);
+    uint per_unit = (uint)(unit / POOL_SIZE);
+    uint nunits, ncarved, i, j, k, start;
+    int releasable;
+    poolp pool, *link;
+    size_t nbytes = 0;
+
+    if (first - base >= (uptr)ao->ntotalpools * POOL_SIZE)
+        return 0;
+    nunits = (uint)((ao->ntotalpools - (first - base) / POOL_SIZE)
+                    / per_unit);
+    ncarved = (uint)(((uptr)ao->pool_address - base) / POOL_SIZE);
+    memset(state, POOL_IN_USE, ncarved);
+    memset(state + ncarved, POOL_RELEASED, ao->ntotalpools - ncarved);
+    for (i = 0; i < ao->nreleased; i++)
+        state[((uptr)ao->released[i] - base) / POOL_SIZE] = POOL_RELEASED;
+    for (pool = ao->freepools; pool != NULL; pool = pool->nextpool)
+        state[((uptr)pool - base) / POOL_SIZE] = POOL_FREE;
+
+    /* Mark the free pools of the units holding no pool in use */
+    start = (uint)((first - base) / POOL_SIZE);
+    for (i = 0; i < nunits; i++) {
+        k = start + i * per_unit;
+        releasable = 1;
+        for (j = k; j < k + per_unit; j++) {
+            if (state[j] == POOL_IN_USE) {
+                releasable = 0;
+                break;
+            }
+        }
+        if (!releasable)
+            continue;
+        for (j = k; j < k + per_unit; j++) {
+            if (state[j] == POOL_FREE)
+                state[j] = POOL_RELEASING;
+        }
+    }
+
+    /* Unlink them while their headers are still there */
+    link = &ao->freepools;
+    while ((pool = *link) != NULL) {
+        if (state[((uptr)pool - base) / POOL_SIZE] == POOL_RELEASING)
+            *link = pool->nextpool;
+        else
+            link = &pool->nextpool;
+    }
+
+    /* Release each run of units holding pools to release */
+    i = 0;
+    while (i < nunits) {
+        uint end;
+
+        k = start + i * per_unit;
+        if (memchr(state + k, POOL_RELEASING, per_unit) == NULL) {
+            i++;
+            continue;
+        }
+        end = i + 1;
+        while (end < nunits &&
+               memchr(state + start + end * per_unit, POOL_RELEASING,
+                      per_unit) != NULL)
+            end++;
+        if (!*failed && release_pages((void *)(base + (uptr)k * POOL_SIZE),
+                                      (size_t)(end - i) * unit)) {
+            for (j = k; j < start + end * per_unit; j++) {
+                if (state[j] != POOL_RELEASING)
+                    continue;
+                assert(ao->nreleased < ao->ntotalpools);
+                ao->released[ao->nreleased++] =
+                    (poolp)(base + (uptr)j * POOL_SIZE);
+                nbytes += POOL_SIZE;
+            }
+        }
+        else {
+            /* Put the pools back, their memory is untouched */
+            *failed = 1;
+            for (j = k; j < start + end * per_unit; j++) {
+                if (state[j] != POOL_RELEASING)
+                    continue;
+                pool = (poolp)(base + (uptr)j * POOL_SIZE);
+                pool->nextpool = ao->freepools;
+                ao->freepools = pool;
+            }
+        }
+        i = end;
+    }
+    return nbytes;
+}
+
+/* Hand the memory of all free pools back to the system.  Arenas are only
+ * freed once all their pools are free, so a few long-lived objects can keep
+ * several mostly empty arenas alive; this releases their unused pools while
+ * keeping the arenas mapped.  Memory is released by whole pages (see
+ * release_unit()), so a free pool sharing a page with a pool in use stays.
+ * Return the number of bytes released.
+ */
+size_t
+_PyObject_ReleaseMemory(void)
+{
+    size_t nbytes = 0;
+    size_t unit = release_unit();
+    char *state = NULL;
+    uint nstate = 0;
+    int failed = 0;
+    uint i;
+
+    LOCK();
+#ifdef PYMALLOC_THREAD_CACHE
+    /* Blocks cached by threads keep their pools in use */
+    foreach_thread_cache(cache_flush, NULL);
+#endif
+    for (i = 0; i < maxarenas && !failed; ++i) {
+        struct arena_object *ao = &arenas[i];
+
+        if (ao->address == 0 || ao->freepools == NULL)
+            continue;
+        if (ao->released == NULL) {
+            ao->released = (poolp *)PyMem_RawMalloc(
+                ao->ntotalpools * sizeof(poolp));
+            if (ao->released == NULL)
+                break;
+        }
+        if (ao->ntotalpools > nstate) {
+            char *newstate = (char *)PyMem_RawRealloc(state,
+                                                      ao->ntotalpools);
+            if (newstate == NULL)
+                break;
+            state = newstate;
+            nstate = ao->ntotalpools;
+        }
+        nbytes += release_arena_pages(ao, unit, state, &failed);
+    }
+    UNLOCK();
+    PyMem_RawFree(state);
+    return nbytes;
+}
+
 #else   /* ! WITH_PYMALLOC */
 
 /*==========================================================================*/
@@ -1707,6 +2293,22 @@ _Py_GetAllocatedBlocks(void)
     return 0;
 }
 
+size_t
+_PyObject_ReleaseMemory(void)
+{
+    return 0;
+}
+
+void
+_PyObject_ConfigureMalloc(void)
+{
+}
+
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+}
+
 #endif /* WITH_PYMALLOC */
 
 #ifdef PYMALLOC_DEBUG
@@ -2160,6 +2762,38 @@ _PyDebugAllocatorStats(FILE *out,
 
 #ifdef WITH_PYMALLOC
 
+/* Return 1 if `pool` is one of the released pools of arena `ao`. */
+static int
+pool_is_released(poolp pool, struct arena_object *ao)
+{
+    uint i;
+
+    for (i = 0; i < ao->nreleased; ++i) {
+        if (ao->released[i] == pool)
+            return 1;
+    }
+    return 0;
+}
+
+#ifdef PYMALLOC_THREAD_CACHE
+/* Add the number of bytes in `cache` to *(size_t *)nbytes */
+static void
+cache_size(struct _obmalloc_cache *cache, void *nbytes)
+{
+    uint i;
+
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; i++)
+        *(size_t *)nbytes += (size_t)cache->mags[i].count * INDEX2SIZE(i);
+}
+
+/* Increment *(uint *)count */
+static void
+cache_count(struct _obmalloc_cache *cache, void *count)
+{
+    ++*(uint *)count;
+}
+#endif
+
 /* Print summary info to "out" about the state of pymalloc's structures.
  * In Py_DEBUG mode, also perform some expensive internal consistency
  * checks.
@@ -2179,6 +2813,13 @@ _PyObject_DebugMallocStats(FILE *out)
     size_t available_bytes = 0;
     /* # of free pools + pools not yet carved out of current arena */
     uint numfreepools = 0;
+    /* # of free pools whose memory was released to the system */
+    uint numreleasedpools = 0;
+#ifdef PYMALLOC_THREAD_CACHE
+    /* # of per-thread caches and # of bytes in their blocks */
+    uint numcaches = 0;
+    size_t cached_bytes = 0;
+#endif
     /* # of bytes for arena alignment padding */
     size_t arena_alignment = 0;
     /* # of bytes in used and full pools used for pool_headers */
@@ -2190,12 +2831,13 @@ _PyObject_DebugMallocStats(FILE *out)
     size_t quantization = 0;
     /* # of arenas actually allocated. */
     size_t narenas = 0;
-    /* running total -- should equal narenas * ARENA_SIZE */
+    /* running total -- should equal narenas * arena_size */
     size_t total;
     char buf[128];
 
-    fprintf(out, "Small block threshold = %d, in %u size classes.\n",
-            SMALL_REQUEST_THRESHOLD, numclasses);
+    fprintf(out, "Small block threshold = %u, in %u size classes, "
+            "%u-byte alignment.\n",
+            small_request_threshold, numclasses, alignment_mask + 1);
 
     for (i = 0; i < numclasses; ++i)
         numpools[i] = numblocks[i] = numfreeblocks[i] = 0;
@@ -2231,6 +2873,10 @@ _PyObject_DebugMallocStats(FILE *out)
             const uint sz = p->szidx;
             uint freeblocks;
 
+            if (pool_is_released(p, &arenas[i])) {
+                ++numreleasedpools;
+                continue;
+            }
             if (p->ref.count == 0) {
                 /* currently unused */
                 assert(pool_is_in_list(p, arenas[i].freepools));
@@ -2282,18 +2928,32 @@ _PyObject_DebugMallocStats(FILE *out)
     (void)printone(out, "# arenas allocated current", narenas);
 
     PyOS_snprintf(buf, sizeof(buf),
-        "%" PY_FORMAT_SIZE_T "u arenas * %d bytes/arena",
-        narenas, ARENA_SIZE);
-    (void)printone(out, buf, narenas * ARENA_SIZE);
+        "%" PY_FORMAT_SIZE_T "u arenas * %" PY_FORMAT_SIZE_T "u bytes/arena",
+        narenas, arena_size);
+    (void)printone(out, buf, narenas * arena_size);
+#ifdef PYMALLOC_THREAD_CACHE
+    (void)printone(out, "# thread cache refills", ntimes_magazine_refilled);
+    (void)printone(out, "# thread cache flushes", ntimes_magazine_flushed);
+#endif
 
     fputc('\n', out);
 
     total = printone(out, "# bytes in allocated blocks", allocated_bytes);
+#ifdef PYMALLOC_THREAD_CACHE
+    foreach_thread_cache(cache_count, &numcaches);
+    foreach_thread_cache(cache_size, &cached_bytes);
+    PyOS_snprintf(buf, sizeof(buf),
+        "(in %u thread caches)", numcaches);
+    (void)printone(out, buf, cached_bytes);
+#endif
     total += printone(out, "# bytes in available blocks", available_bytes);
 
     PyOS_snprintf(buf, sizeof(buf),
         "%u unused pools * %d bytes", numfreepools, POOL_SIZE);
     total += printone(out, buf, (size_t)numfreepools * POOL_SIZE);
+    PyOS_snprintf(buf, sizeof(buf),
+        "(%u of them released)", numreleasedpools);
+    (void)printone(out, buf, (size_t)numreleasedpools * POOL_SIZE);
 
     total += printone(out, "# bytes lost to pool headers", pool_header_bytes);
     total += printone(out, "# bytes lost to quantization", quantization);
@@ -2313,7 +2973,7 @@ Py_ADDRESS_IN_RANGE(void *P, poolp pool)
     uint arenaindex_temp = pool->arenaindex;
 
     return arenaindex_temp < maxarenas &&
-           (uptr)P - arenas[arenaindex_temp].address < (uptr)ARENA_SIZE &&
+           (uptr)P - arenas[arenaindex_temp].address < (uptr)arena_size &&
            arenas[arenaindex_temp].address != 0;
 }
 #endif
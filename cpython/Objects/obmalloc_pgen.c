@@ -0,0 +1,2 @@
+#define PGEN
+#include "obmalloc.c"
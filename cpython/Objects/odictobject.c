@@ -39,18 +39,14 @@ we've considered:
    __getitem__(), get(), etc. accordingly.
 
 The approach with the least performance impact (time and space) is #2,
-mirroring the key order of dict's dk_enties with an array of node pointers.
-While lookdict() and friends (dk_lookup) don't give us the index into the
-array, we make use of pointer arithmetic to get that index.  An alternative
-would be to refactor lookdict() to provide the index, explicitly exposing
-the implementation detail.  We could even just use a custom lookup function
-for OrderedDict that facilitates our need.  However, both approaches are
-significantly more complicated than just using pointer arithmetic.
-
-The catch with mirroring the hash table ordering is that we have to keep
-the ordering in sync through any dict resizes.  However, that order only
-matters during node lookup.  We can simply defer any potential resizing
-until we need to do a lookup.
+mirroring the key order of dict's dk_entries with an array of node pointers.
+lookdict() and friends (dk_lookup) return the index of the key's entry,
+which we use to index that array.
+
+The catch with mirroring the entries is that we have to keep the indices
+in sync through any dict resizes.  However, those indices only matter
+during node lookup.  We can simply defer any potential resizing until we
+need to do a lookup.
 
 Linked-List Nodes
 -----------------
@@ -483,9 +479,11 @@ struct _odictobject {
     PyDictObject od_dict;        /* the underlying dict */
     _ODictNode *od_first;        /* first node in the linked list, if any */
     _ODictNode *od_last;         /* last node in the linked list, if any */
-    /* od_size and od_fast_nodes are managed by _odict_resize() */
+    /* od_size, od_fast_nodes and od_resize_sentinel are managed by
+       _odict_resize() */
     Py_ssize_t od_size;          /* hash table that mirrors the dict table */
     _ODictNode **od_fast_nodes;  /* managed by _odict_resize() */
+    void *od_resize_sentinel;    /* keys object od_fast_nodes mirrors */
     size_t od_state;             /* incremented whenever the LL changes */
     PyObject *od_inst_dict;      /* OrderedDict().__dict__ */
     PyObject *od_weakreflist;    /* holds weakrefs to the odict */
@@ -528,19 +526,22 @@ _odict_free_fast_nodes(PyODictObject *od) {
     }
 }
 
-/* Return the index into the hash table, regardless of a valid node. */
+/* Return the index into the entries, regardless of a valid node. */
 static Py_ssize_t
 _odict_get_index_hash(PyODictObject *od, PyObject *key, Py_hash_t hash)
 {
     PyObject **value_addr = NULL;
-    PyDictKeyEntry *ep;
     PyDictKeysObject *keys = ((PyDictObject *)od)->ma_keys;
+    Py_ssize_t ix;
 
-    ep = (keys->dk_lookup)((PyDictObject *)od, key, hash, &value_addr);
-    if (ep == NULL)
+    ix = (keys->dk_lookup)((PyDictObject *)od, key, hash, &value_addr, NULL);
+    if (ix == DKIX_EMPTY) {
+        /* the index the key's entry would get, which has no node */
+        return keys->dk_nentries;
+    }
+    if (ix < 0)
         return -1;
-    /* We use pointer arithmetic to get the entry's index into the table. */
-    return ep - keys->dk_entries;
+    return ix;
 }
 
 /* Replace od->od_fast_nodes with a new table matching the size of dict's. */
@@ -574,6 +575,7 @@ _odict_resize(PyODictObject *od) {
     _odict_free_fast_nodes(od);
     od->od_fast_nodes = fast_nodes;
     od->od_size = size;
+    od->od_resize_sentinel = ((PyDictObject *)od)->ma_keys;
     return 0;
 }
 
@@ -590,8 +592,9 @@ _odict_get_index(PyODictObject *od, PyObject *key)
         return -1;
     keys = ((PyDictObject *)od)->ma_keys;
 
-    /* Ensure od_fast_nodes and dk_entries are in sync. */
-    if (keys->dk_size != od->od_size) {
+    /* Ensure od_fast_nodes and dk_entries are in sync.  Resizing the
+       dict always allocates a new keys object. */
+    if (od->od_resize_sentinel != keys || keys->dk_size != od->od_size) {
         int resize_res = _odict_resize(od);
         if (resize_res < 0)
             return -1;
@@ -172,6 +172,17 @@ set_insert_clean(PySetObject *so, PyObject *key, Py_hash_t hash)
 /* ======== End logic for probing the hash table ========================== */
 /* ======================================================================== */
 
+/* Sets and frozensets are untracked when created, like dicts, and become
+   tracked when an object that may take part in a reference cycle is added
+   to them. */
+#define MAINTAIN_TRACKING(so, key) \
+    do { \
+        if (!_PyObject_GC_IS_TRACKED(so) && \
+            _PyObject_GC_MAY_BE_TRACKED(key)) { \
+            _PyObject_GC_TRACK(so); \
+        } \
+    } while(0)
+
 
 /*
 Internal routine to insert a new key into the table.
@@ -192,11 +203,13 @@ set_insert_key(PySetObject *so, PyObject *key, Py_hash_t hash)
         entry->hash = hash;
         so->fill++;
         so->used++;
+        MAINTAIN_TRACKING(so, key);
     } else if (entry->key == dummy) {
         /* DUMMY */
         entry->key = key;
         entry->hash = hash;
         so->used++;
+        MAINTAIN_TRACKING(so, key);
     } else {
         /* ACTIVE */
         Py_DECREF(key);
@@ -580,6 +593,7 @@ set_merge(PySetObject *so, PyObject *otherset)
                 Py_INCREF(key);
                 so_entry->key = key;
                 so_entry->hash = other_entry->hash;
+                MAINTAIN_TRACKING(so, key);
             }
         }
         so->fill = other->fill;
@@ -594,6 +608,7 @@ set_merge(PySetObject *so, PyObject *otherset)
             if (key != NULL && key != dummy) {
                 Py_INCREF(key);
                 set_insert_clean(so, key, other_entry->hash);
+                MAINTAIN_TRACKING(so, key);
             }
         }
         return 0;
@@ -979,6 +994,10 @@ make_new_set(PyTypeObject *type, PyObject *iterable)
     if (so == NULL)
         return NULL;
 
+    /* The object has been implicitly tracked by tp_alloc */
+    if (type == &PySet_Type || type == &PyFrozenSet_Type)
+        _PyObject_GC_UNTRACK(so);
+
     so->fill = 0;
     so->used = 0;
     so->mask = PySet_MINSIZE - 1;
@@ -1109,6 +1128,14 @@ set_swap_bodies(PySetObject *a, PySetObject *b)
         a->hash = -1;
         b->hash = -1;
     }
+
+    /* the contents of a tracked set may now be in the other one */
+    if (_PyObject_GC_IS_TRACKED(a) && !_PyObject_GC_IS_TRACKED(b)) {
+        _PyObject_GC_TRACK(b);
+    }
+    else if (_PyObject_GC_IS_TRACKED(b) && !_PyObject_GC_IS_TRACKED(a)) {
+        _PyObject_GC_TRACK(a);
+    }
 }
 
 static PyObject *
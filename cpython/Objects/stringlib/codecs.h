@@ -2,6 +2,8 @@
 
 #if STRINGLIB_IS_UNICODE
 
+#include "sse2.h"
+
 /* Mask to quickly check whether a C 'long' contains a
    non-ASCII, UTF8-encoded char. */
 #if (SIZEOF_LONG == 8)
@@ -15,6 +17,64 @@
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
+#ifdef STRINGLIB_SSE2
+/* Store the 16 bytes of v as 16 characters at p */
+Py_LOCAL_INLINE(void)
+STRINGLIB(widen_ascii16)(STRINGLIB_CHAR *p, __m128i v)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+    _mm_storeu_si128((__m128i *) p, v);
+#else
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+# if STRINGLIB_SIZEOF_CHAR == 2
+    _mm_storeu_si128((__m128i *) p, lo);
+    _mm_storeu_si128((__m128i *) (p + 8), hi);
+# else
+    _mm_storeu_si128((__m128i *) p, _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i *) (p + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i *) (p + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i *) (p + 12), _mm_unpackhi_epi16(hi, zero));
+# endif
+#endif
+}
+
+/* Store the 16 characters at p as 16 bytes at out, and return how many of
+   them are ASCII before the first non-ASCII one.  Only those bytes are
+   meaningful. */
+Py_LOCAL_INLINE(int)
+STRINGLIB(narrow_ascii16)(const STRINGLIB_CHAR *p, char *out)
+{
+    unsigned int mask;
+#if STRINGLIB_SIZEOF_CHAR == 1
+    __m128i v = _mm_loadu_si128((const __m128i *) p);
+    mask = _mm_movemask_epi8(v);
+#else
+    const __m128i high = _mm_set1_epi16((short)0xFF80);
+# if STRINGLIB_SIZEOF_CHAR == 2
+    __m128i a = _mm_loadu_si128((const __m128i *) p);
+    __m128i b = _mm_loadu_si128((const __m128i *) (p + 8));
+# else
+    /* characters above 0x7FFF saturate to 0x7FFF, which isn't ASCII */
+    __m128i a = _mm_packs_epi32(_mm_loadu_si128((const __m128i *) p),
+                                _mm_loadu_si128((const __m128i *) (p + 4)));
+    __m128i b = _mm_packs_epi32(_mm_loadu_si128((const __m128i *) (p + 8)),
+                                _mm_loadu_si128((const __m128i *) (p + 12)));
+# endif
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_packus_epi16(a, b);
+    /* one byte per character: 0xFF for ASCII, 0 otherwise */
+    __m128i ascii = _mm_packs_epi16(
+        _mm_cmpeq_epi16(_mm_and_si128(a, high), zero),
+        _mm_cmpeq_epi16(_mm_and_si128(b, high), zero));
+    mask = _mm_movemask_epi8(ascii) ^ 0xFFFF;
+#endif
+    _mm_storeu_si128((__m128i *) out, v);
+    return mask ? STRINGLIB_CTZ(mask) : 16;
+}
+#endif
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                        STRINGLIB_CHAR *dest,
@@ -22,7 +82,9 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
 {
     Py_UCS4 ch;
     const char *s = *inptr;
+#ifndef STRINGLIB_SSE2
     const char *aligned_end = (const char *) _Py_ALIGN_DOWN(end, SIZEOF_LONG);
+#endif
     STRINGLIB_CHAR *p = dest + *outpos;
 
     while (s < end) {
@@ -35,7 +97,34 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                as many characters as a C 'long' can contain.
                First, check if we can do an aligned read, as most CPUs have
                a penalty for unaligned reads.
+               With SSE2, copy 16 bytes at a time instead, unaligned, up to
+               the first non-ASCII byte.  The output has room for one
+               character per remaining input byte.
             */
+#ifdef STRINGLIB_SSE2
+            {
+                /* Help register allocation */
+                const char *_s = s;
+                STRINGLIB_CHAR *_p = p;
+                while (end - _s >= 16) {
+                    __m128i v = _mm_loadu_si128((const __m128i *) _s);
+                    unsigned int mask = _mm_movemask_epi8(v);
+                    STRINGLIB(widen_ascii16)(_p, v);
+                    if (mask) {
+                        _s += STRINGLIB_CTZ(mask);
+                        _p += STRINGLIB_CTZ(mask);
+                        break;
+                    }
+                    _s += 16;
+                    _p += 16;
+                }
+                s = _s;
+                p = _p;
+                if (s == end)
+                    break;
+                ch = (unsigned char)*s;
+            }
+#else
             if (_Py_IS_ALIGNED(s, SIZEOF_LONG)) {
                 /* Help register allocation */
                 const char *_s = s;
@@ -84,6 +173,7 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                     break;
                 ch = (unsigned char)*s;
             }
+#endif
             if (ch < 0x80) {
                 s++;
                 *p++ = ch;
@@ -313,7 +403,17 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
         if (ch < 0x80) {
             /* Encode ASCII */
             *p++ = (char) ch;
-
+#ifdef STRINGLIB_SSE2
+            /* and the run of ASCII characters following it, 16 at a time;
+               p has room for at least 2 bytes per remaining character */
+            while (size - i >= 16) {
+                int n = STRINGLIB(narrow_ascii16)(data + i, p);
+                i += n;
+                p += n;
+                if (n < 16)
+                    break;
+            }
+#endif
         }
         else
 #if STRINGLIB_SIZEOF_CHAR > 1
@@ -420,7 +520,9 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
         /* This was stack allocated. */
         nneeded = p - stackbuf;
         assert(nneeded <= nallocated);
-        result = PyBytes_FromStringAndSize(stackbuf, nneeded);
+        result = PyBytes_FromStringAndSize(NULL, nneeded);
+        if (result != NULL)
+            Py_MEMCPY(PyBytes_AS_STRING(result), stackbuf, nneeded);
     }
     else {
         /* Cut back to size actually needed. */
@@ -32,6 +32,134 @@
 #define STRINGLIB_BLOOM(mask, ch)     \
     ((mask &  (1UL << ((ch) & (STRINGLIB_BLOOM_WIDTH -1)))))
 
+/* SSE2 kernels for counting single characters and for short needles.  They
+   compare 16 bytes of the string at once.  Searching a single character is
+   left to memchr(). */
+#include "sse2.h"
+
+#ifdef STRINGLIB_SSE2
+/* longest needle searched with STRINGLIB(search_sse2)() */
+#define STRINGLIB_SSE2_MAX_NEEDLE 32
+
+#undef STRINGLIB_SSE2_LANES
+#undef STRINGLIB_SSE2_SPLAT
+#undef STRINGLIB_SSE2_CMPEQ
+#undef STRINGLIB_SSE2_LANE_BITS
+/* characters per 16 bytes */
+#define STRINGLIB_SSE2_LANES (16 / STRINGLIB_SIZEOF_CHAR)
+#if STRINGLIB_SIZEOF_CHAR == 1
+#define STRINGLIB_SSE2_SPLAT(ch) _mm_set1_epi8((char)(ch))
+#define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi8
+/* movemask bits kept for each character */
+#define STRINGLIB_SSE2_LANE_BITS 0xFFFFU
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#define STRINGLIB_SSE2_SPLAT(ch) _mm_set1_epi16((short)(ch))
+#define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi16
+#define STRINGLIB_SSE2_LANE_BITS 0x5555U
+#else
+#define STRINGLIB_SSE2_SPLAT(ch) _mm_set1_epi32((int)(ch))
+#define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi32
+#define STRINGLIB_SSE2_LANE_BITS 0x1111U
+#endif
+
+/* movemask of the characters of s[0:STRINGLIB_SSE2_LANES] equal to v */
+#define STRINGLIB_SSE2_MATCH(s, v) \
+    ((unsigned int)_mm_movemask_epi8(STRINGLIB_SSE2_CMPEQ( \
+        _mm_loadu_si128((const __m128i *)(s)), (v))))
+
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(count_char_sse2)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                           STRINGLIB_CHAR ch, Py_ssize_t maxcount)
+{
+    const __m128i v = STRINGLIB_SSE2_SPLAT(ch);
+    const __m128i zero = _mm_setzero_si128();
+    Py_ssize_t i = 0, count = 0;
+
+    while (i + STRINGLIB_SSE2_LANES <= n) {
+        /* The matching bytes are counted in 16 byte counters, which are
+           summed before they can overflow after 255 blocks. */
+        __m128i acc = zero, sums;
+        Py_ssize_t blocks = (n - i) / STRINGLIB_SSE2_LANES;
+        if (blocks > 255)
+            blocks = 255;
+        for (; blocks > 0; blocks--, i += STRINGLIB_SSE2_LANES)
+            acc = _mm_sub_epi8(acc, STRINGLIB_SSE2_CMPEQ(
+                _mm_loadu_si128((const __m128i *)(s + i)), v));
+        sums = _mm_sad_epu8(acc, zero);
+        count += (_mm_cvtsi128_si32(sums) +
+                  _mm_cvtsi128_si32(_mm_srli_si128(sums, 8))) /
+                 STRINGLIB_SIZEOF_CHAR;
+        if (count >= maxcount)
+            return maxcount;
+    }
+    for (; i < n; i++)
+        if (s[i] == ch) {
+            count++;
+            if (count == maxcount)
+                return maxcount;
+        }
+    return count;
+}
+
+/* Search or count p[0:m] in s[0:n], with 2 <= m <= n.  The candidates are
+   the positions where both the first and the last character of p match,
+   16 bytes at a time; the rest of p is compared only for them. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(search_sse2)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                       const STRINGLIB_CHAR* p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode)
+{
+    const __m128i first = STRINGLIB_SSE2_SPLAT(p[0]);
+    const __m128i last = STRINGLIB_SSE2_SPLAT(p[m - 1]);
+    const size_t middle = (m - 2) * sizeof(STRINGLIB_CHAR);
+    Py_ssize_t i = 0, j, count = 0, candidates = 0;
+    /* first position where a match may start: matches don't overlap */
+    Py_ssize_t start = 0;
+    Py_ssize_t w = n - m;
+
+    assert(m >= 2 && w >= 0 && mode != FAST_RSEARCH);
+    while (i + STRINGLIB_SSE2_LANES - 1 <= w) {
+        unsigned int mask = STRINGLIB_SSE2_MATCH(s + i, first) &
+                            STRINGLIB_SSE2_MATCH(s + i + m - 1, last) &
+                            STRINGLIB_SSE2_LANE_BITS;
+        while (mask) {
+            j = i + STRINGLIB_CTZ(mask) / STRINGLIB_SIZEOF_CHAR;
+            mask &= mask - 1;
+            candidates++;
+            if (j >= start &&
+                (middle == 0 || memcmp(s + j + 1, p + 1, middle) == 0)) {
+                if (mode != FAST_COUNT)
+                    return j;
+                count++;
+                if (count == maxcount)
+                    return maxcount;
+                start = j + m;
+            }
+        }
+        i += STRINGLIB_SSE2_LANES;
+        if (i < start)
+            i = start;
+        /* the scalar loop is faster when most positions are candidates */
+        if (candidates > i / 4 + 64)
+            break;
+    }
+    for (; i <= w; i++) {
+        if (s[i] == p[0] && s[i + m - 1] == p[m - 1] &&
+            (middle == 0 || memcmp(s + i + 1, p + 1, middle) == 0)) {
+            if (mode != FAST_COUNT)
+                return i;
+            count++;
+            if (count == maxcount)
+                return maxcount;
+            i = i + m - 1;
+        }
+    }
+    if (mode != FAST_COUNT)
+        return -1;
+    return count;
+}
+#endif /* STRINGLIB_SSE2 */
+
 
 Py_LOCAL_INLINE(Py_ssize_t)
 STRINGLIB(fastsearch_memchr_1char)(const STRINGLIB_CHAR* s, Py_ssize_t n,
@@ -98,6 +226,10 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     if (m <= 1) {
         if (m <= 0)
             return -1;
+#ifdef STRINGLIB_SSE2
+        if (mode == FAST_COUNT)
+            return STRINGLIB(count_char_sse2)(s, n, p[0], maxcount);
+#endif
         /* use special case for 1-character strings */
         if (n > 10 && (mode == FAST_SEARCH
 #ifdef HAVE_MEMRCHR
@@ -137,6 +269,12 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
         return -1;
     }
 
+#ifdef STRINGLIB_SSE2
+    if (mode != FAST_RSEARCH && m <= STRINGLIB_SSE2_MAX_NEEDLE &&
+        w >= STRINGLIB_SSE2_LANES)
+        return STRINGLIB(search_sse2)(s, n, p, m, maxcount, mode);
+#endif
+
     mlast = m - 1;
     skip = mlast - 1;
     mask = 0;
@@ -2,6 +2,8 @@
 
 #if STRINGLIB_IS_UNICODE
 
+#include "sse2.h"
+
 /* Mask to quickly check whether a C 'long' contains a
    non-ASCII, UTF8-encoded char. */
 #if (SIZEOF_LONG == 8)
@@ -21,6 +23,16 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
     const unsigned char *aligned_end =
             (const unsigned char *) _Py_ALIGN_DOWN(end, SIZEOF_LONG);
 
+#ifdef STRINGLIB_SSE2
+    /* 32 bytes at a time: movemask collects the high bit of each byte */
+    while (end - p >= 32) {
+        __m128i bits = _mm_or_si128(_mm_loadu_si128((const __m128i *) p),
+                                    _mm_loadu_si128((const __m128i *) (p + 16)));
+        if (_mm_movemask_epi8(bits))
+            return 255;
+        p += 32;
+    }
+#endif
     while (p < end) {
         if (_Py_IS_ALIGNED(p, SIZEOF_LONG)) {
             /* Help register allocation */
@@ -74,6 +86,50 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 
     max_char = MAX_CHAR_ASCII;
     mask = MASK_ASCII;
+#ifdef STRINGLIB_SSE2
+    {
+        /* characters per 16 bytes */
+        const Py_ssize_t lanes = 16 / STRINGLIB_SIZEOF_CHAR;
+        const STRINGLIB_CHAR *vector_end =
+            begin + _Py_SIZE_ROUND_DOWN(n, 2 * lanes);
+        const __m128i zero = _mm_setzero_si128();
+#if STRINGLIB_SIZEOF_CHAR == 2
+        __m128i vmask = _mm_set1_epi16((short)mask);
+#else
+        __m128i vmask = _mm_set1_epi32((int)mask);
+#endif
+        while (p < vector_end) {
+            __m128i bits = _mm_or_si128(
+                _mm_loadu_si128((const __m128i *) p),
+                _mm_loadu_si128((const __m128i *) (p + lanes)));
+            bits = _mm_cmpeq_epi8(_mm_and_si128(bits, vmask), zero);
+            if (_mm_movemask_epi8(bits) != 0xFFFF) {
+                if (mask == mask_limit) {
+                    /* Limit reached */
+                    return max_char_limit;
+                }
+                if (mask == MASK_ASCII) {
+                    max_char = MAX_CHAR_UCS1;
+                    mask = MASK_UCS1;
+                }
+                else {
+                    /* mask can't be MASK_UCS2 because of mask_limit above */
+                    assert(mask == MASK_UCS1);
+                    max_char = MAX_CHAR_UCS2;
+                    mask = MASK_UCS2;
+                }
+#if STRINGLIB_SIZEOF_CHAR == 2
+                vmask = _mm_set1_epi16((short)mask);
+#else
+                vmask = _mm_set1_epi32((int)mask);
+#endif
+                /* We check the new mask on the same chars in the next iteration */
+                continue;
+            }
+            p += 2 * lanes;
+        }
+    }
+#endif
     while (p < unrolled_end) {
         STRINGLIB_CHAR bits = p[0] | p[1] | p[2] | p[3];
         if (bits & mask) {
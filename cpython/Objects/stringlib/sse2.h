@@ -0,0 +1,34 @@
+/* stringlib: SSE2 detection and helpers */
+
+#ifndef STRINGLIB_SSE2_H
+#define STRINGLIB_SSE2_H
+
+/* The SSE2 code paths are used wherever SSE2 is part of the target
+   instruction set, like the group probing of dictobject.c. */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STRINGLIB_SSE2
+#endif
+
+#ifdef STRINGLIB_SSE2
+/* index of the lowest set bit of a movemask */
+#if defined(__GNUC__)
+#define STRINGLIB_CTZ(x) __builtin_ctz(x)
+#else
+Py_LOCAL_INLINE(int)
+stringlib_ctz(unsigned int x)
+{
+    int n = 0;
+    assert(x != 0);
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+#define STRINGLIB_CTZ(x) stringlib_ctz(x)
+#endif
+#endif /* STRINGLIB_SSE2 */
+
+#endif /* !STRINGLIB_SSE2_H */
@@ -25,9 +25,9 @@ Py_ssize_t tuple_zero_allocs;
 #endif
 
 /* Debug statistic to count GC tracking of tuples.
-   Please note that tuples are only untracked when considered by the GC, and
-   many of them will be dead before. Therefore, a tracking rate close to 100%
-   does not necessarily prove that the heuristic is inefficient.
+   Please note that most tuples are only untracked when considered by the GC,
+   and many of them will be dead before. Therefore, a tracking rate close to
+   100% does not necessarily prove that the heuristic is inefficient.
 */
 #ifdef SHOW_TRACK_COUNT
 static Py_ssize_t count_untracked = 0;
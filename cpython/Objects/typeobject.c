@@ -3025,9 +3025,6 @@ type_setattro(PyTypeObject *type, PyObject *name, PyObject *value)
     return update_slot(type, name);
 }
 
-extern void
-_PyDictKeys_DecRef(PyDictKeysObject *keys);
-
 static void
 type_dealloc(PyTypeObject *type)
 {
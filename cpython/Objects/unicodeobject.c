@@ -42,6 +42,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "Python.h"
 #include "ucnhash.h"
 #include "bytes_methods.h"
+#include "accu.h"
 
 #ifdef MS_WINDOWS
 #include <windows.h>
@@ -4617,6 +4618,27 @@ static Py_ssize_t
 ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
+#ifdef STRINGLIB_SSE2
+    /* STRINGLIB_SSE2 is defined by stringlib/codecs.h: copy 16 bytes at a
+       time, with unaligned loads and stores */
+    Py_UCS1 *q = dest;
+
+    while (end - p >= 16) {
+        __m128i value = _mm_loadu_si128((const __m128i *) p);
+        unsigned int mask = _mm_movemask_epi8(value);
+        _mm_storeu_si128((__m128i *) q, value);
+        if (mask)
+            return p - start + STRINGLIB_CTZ(mask);
+        p += 16;
+        q += 16;
+    }
+    while (p < end) {
+        if ((unsigned char)*p & 0x80)
+            break;
+        *q++ = *p++;
+    }
+    return p - start;
+#else
     const char *aligned_end = (const char *) _Py_ALIGN_DOWN(end, SIZEOF_LONG);
 
     /*
@@ -4675,6 +4697,7 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     }
     memcpy(dest, start, p - start);
     return p - start;
+#endif
 }
 
 PyObject *
@@ -15379,8 +15402,225 @@ PyUnicode_AsUnicodeCopy(PyObject *unicode)
     return copy;
 }
 
+/* The string.Builder type: an accumulator of str objects which joins them
+   only when the result is requested, instead of the quadratic behaviour of
+   repeated concatenation. */
+
+typedef struct {
+    PyObject_HEAD
+    _PyAccu acc;         /* acc.small is NULL once a build() failed */
+    Py_ssize_t length;   /* total number of characters */
+} builderobject;
+
+static PyObject *
+builder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    builderobject *self;
+
+    if (!_PyArg_NoKeywords("Builder()", kwds))
+        return NULL;
+    if (!PyArg_UnpackTuple(args, "Builder", 0, 0))
+        return NULL;
+    self = (builderobject *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+    if (_PyAccu_Init(&self->acc) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    self->length = 0;
+    return (PyObject *)self;
+}
+
+static void
+builder_dealloc(builderobject *self)
+{
+    _PyAccu_Destroy(&self->acc);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+/* A failed build() loses the contents of the builder, which can't be used
+   afterwards. */
+static int
+builder_check(builderobject *self)
+{
+    if (self->acc.small == NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Builder contents were lost by a failed build()");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+builder_append_str(builderobject *self, PyObject *str)
+{
+    if (builder_check(self) < 0)
+        return -1;
+    if (!PyUnicode_Check(str)) {
+        PyErr_Format(PyExc_TypeError,
+                     "can only append str (not \"%.200s\") to Builder",
+                     Py_TYPE(str)->tp_name);
+        return -1;
+    }
+    if (PyUnicode_READY(str) == -1)
+        return -1;
+    if (PyUnicode_GET_LENGTH(str) == 0)
+        return 0;
+    if (self->length > PY_SSIZE_T_MAX - PyUnicode_GET_LENGTH(str)) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "strings are too large to concat");
+        return -1;
+    }
+    if (_PyAccu_Accumulate(&self->acc, str) < 0)
+        return -1;
+    self->length += PyUnicode_GET_LENGTH(str);
+    return 0;
+}
+
+PyDoc_STRVAR(builder_append_doc,
+"append(s) -> None\n\
+\n\
+Append the string s to the builder.");
+
+static PyObject *
+builder_append(builderobject *self, PyObject *str)
+{
+    if (builder_append_str(self, str) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+builder_inplace_add(builderobject *self, PyObject *str)
+{
+    if (builder_append_str(self, str) < 0)
+        return NULL;
+    Py_INCREF(self);
+    return (PyObject *)self;
+}
+
+PyDoc_STRVAR(builder_build_doc,
+"build() -> str\n\
+\n\
+Return the concatenation of the strings appended so far.  The builder\n\
+keeps its contents and more strings can be appended.");
+
+static PyObject *
+builder_build(builderobject *self)
+{
+    PyObject *result;
+
+    if (builder_check(self) < 0)
+        return NULL;
+    result = _PyAccu_Finish(&self->acc);
+    if (result == NULL) {
+        /* the accumulator was destroyed */
+        _PyAccu_Destroy(&self->acc);
+        self->length = 0;
+        return NULL;
+    }
+    /* start again from the joined string, so that it isn't joined again
+       by the next build() */
+    if (_PyAccu_Init(&self->acc) < 0 ||
+        (self->length > 0 && _PyAccu_Accumulate(&self->acc, result) < 0)) {
+        Py_DECREF(result);
+        _PyAccu_Destroy(&self->acc);
+        self->length = 0;
+        return NULL;
+    }
+    return result;
+}
+
+static Py_ssize_t
+builder_length(builderobject *self)
+{
+    return self->length;
+}
+
+static PyMethodDef builder_methods[] = {
+    {"append", (PyCFunction)builder_append, METH_O, builder_append_doc},
+    {"build", (PyCFunction)builder_build, METH_NOARGS, builder_build_doc},
+    {NULL, NULL}
+};
+
+static PyNumberMethods builder_as_number = {
+    0,                                  /* nb_add */
+    0,                                  /* nb_subtract */
+    0,                                  /* nb_multiply */
+    0,                                  /* nb_remainder */
+    0,                                  /* nb_divmod */
+    0,                                  /* nb_power */
+    0,                                  /* nb_negative */
+    0,                                  /* nb_positive */
+    0,                                  /* nb_absolute */
+    0,                                  /* nb_bool */
+    0,                                  /* nb_invert */
+    0,                                  /* nb_lshift */
+    0,                                  /* nb_rshift */
+    0,                                  /* nb_and */
+    0,                                  /* nb_xor */
+    0,                                  /* nb_or */
+    0,                                  /* nb_int */
+    0,                                  /* nb_reserved */
+    0,                                  /* nb_float */
+    (binaryfunc)builder_inplace_add,    /* nb_inplace_add */
+};
+
+static PySequenceMethods builder_as_sequence = {
+    (lenfunc)builder_length,            /* sq_length */
+};
+
+PyDoc_STRVAR(builder_doc,
+"Builder() -> new string builder\n\
+\n\
+Accumulate strings with append() or +=, and join them with build()\n\
+or str(), in linear time.");
+
+static PyTypeObject PyStringBuilder_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "string.Builder",                   /* tp_name */
+    sizeof(builderobject),              /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)builder_dealloc,        /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    &builder_as_number,                 /* tp_as_number */
+    &builder_as_sequence,               /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    PyObject_HashNotImplemented,        /* tp_hash */
+    0,                                  /* tp_call */
+    (reprfunc)builder_build,            /* tp_str */
+    PyObject_GenericGetAttr,            /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /* tp_flags */
+    builder_doc,                        /* tp_doc */
+    0,                                  /* tp_traverse */
+    0,                                  /* tp_clear */
+    0,                                  /* tp_richcompare */
+    0,                                  /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    builder_methods,                    /* tp_methods */
+    0,                                  /* tp_members */
+    0,                                  /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    0,                                  /* tp_dictoffset */
+    0,                                  /* tp_init */
+    0,                                  /* tp_alloc */
+    builder_new,                        /* tp_new */
+};
+
 /* A _string module, to export formatter_parser and formatter_field_name_split
-   to the string.Formatter class implemented in Python. */
+   to the string.Formatter class implemented in Python, and the
+   string.Builder type. */
 
 static PyMethodDef _string_methods[] = {
     {"formatter_field_name_split", (PyCFunction) formatter_field_name_split,
@@ -15405,7 +15645,20 @@ static struct PyModuleDef _string_module = {
 PyMODINIT_FUNC
 PyInit__string(void)
 {
-    return PyModule_Create(&_string_module);
+    PyObject *m;
+
+    if (PyType_Ready(&PyStringBuilder_Type) < 0)
+        return NULL;
+    m = PyModule_Create(&_string_module);
+    if (m == NULL)
+        return NULL;
+    Py_INCREF(&PyStringBuilder_Type);
+    if (PyModule_AddObject(m, "Builder",
+                           (PyObject *)&PyStringBuilder_Type) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
 }
 
 
@@ -966,12 +966,13 @@ builtin_exec_impl(PyModuleDef *module, PyObject *source, PyObject *globals,
 
 /* AC: cannot convert yet, as needs PEP 457 group support in inspect */
 static PyObject *
-builtin_getattr(PyObject *self, PyObject *args)
+builtin_getattr(PyObject *self, PyObject **args, Py_ssize_t nargs,
+                PyObject *kwargs)
 {
     PyObject *v, *result, *dflt = NULL;
     PyObject *name;
 
-    if (!PyArg_UnpackTuple(args, "getattr", 2, 3, &v, &name, &dflt))
+    if (!_PyArg_UnpackStack(args, nargs, "getattr", 2, 3, &v, &name, &dflt))
         return NULL;
 
     if (!PyUnicode_Check(name)) {
@@ -1459,28 +1460,30 @@ builtin_locals_impl(PyModuleDef *module)
 
 
 static PyObject *
-min_max(PyObject *args, PyObject *kwds, int op)
+min_max(PyObject **args, Py_ssize_t nargs, PyObject *kwds, int op)
 {
     PyObject *v, *it, *item, *val, *maxitem, *maxval, *keyfunc=NULL;
     PyObject *emptytuple, *defaultval = NULL;
     static char *kwlist[] = {"key", "default", NULL};
     const char *name = op == Py_LT ? "min" : "max";
-    const int positional = PyTuple_Size(args) > 1;
+    const int positional = nargs > 1;
+    Py_ssize_t i = 0;
     int ret;
 
-    if (positional)
-        v = args;
-    else if (!PyArg_UnpackTuple(args, name, 1, 1, &v))
+    if (!positional &&
+        !_PyArg_UnpackStack(args, nargs, name, 1, 1, &v))
         return NULL;
 
-    emptytuple = PyTuple_New(0);
-    if (emptytuple == NULL)
-        return NULL;
-    ret = PyArg_ParseTupleAndKeywords(emptytuple, kwds, "|$OO", kwlist,
-                                      &keyfunc, &defaultval);
-    Py_DECREF(emptytuple);
-    if (!ret)
-        return NULL;
+    if (kwds != NULL) {
+        emptytuple = PyTuple_New(0);
+        if (emptytuple == NULL)
+            return NULL;
+        ret = PyArg_ParseTupleAndKeywords(emptytuple, kwds, "|$OO", kwlist,
+                                          &keyfunc, &defaultval);
+        Py_DECREF(emptytuple);
+        if (!ret)
+            return NULL;
+    }
 
     if (positional && defaultval != NULL) {
         PyErr_Format(PyExc_TypeError,
@@ -1489,14 +1492,28 @@ min_max(PyObject *args, PyObject *kwds, int op)
         return NULL;
     }
 
-    it = PyObject_GetIter(v);
-    if (it == NULL) {
-        return NULL;
+    /* With several positional arguments, walk the caller's argument
+       array directly instead of building a tuple to iterate over. */
+    if (positional)
+        it = NULL;
+    else {
+        it = PyObject_GetIter(v);
+        if (it == NULL)
+            return NULL;
     }
 
     maxitem = NULL; /* the result */
     maxval = NULL;  /* the value associated with the result */
-    while (( item = PyIter_Next(it) )) {
+    for (;;) {
+        if (it == NULL) {
+            if (i >= nargs)
+                break;
+            item = args[i++];
+            Py_INCREF(item);
+        }
+        else if ((item = PyIter_Next(it)) == NULL)
+            break;
+
         /* get the value from the key function */
         if (keyfunc != NULL) {
             val = PyObject_CallFunctionObjArgs(keyfunc, item, NULL);
@@ -1545,7 +1562,7 @@ min_max(PyObject *args, PyObject *kwds, int op)
     }
     else
         Py_DECREF(maxval);
-    Py_DECREF(it);
+    Py_XDECREF(it);
     return maxitem;
 
 Fail_it_item_and_val:
@@ -1555,15 +1572,16 @@ Fail_it_item:
 Fail_it:
     Py_XDECREF(maxval);
     Py_XDECREF(maxitem);
-    Py_DECREF(it);
+    Py_XDECREF(it);
     return NULL;
 }
 
 /* AC: cannot convert yet, waiting for *args support */
 static PyObject *
-builtin_min(PyObject *self, PyObject *args, PyObject *kwds)
+builtin_min(PyObject *self, PyObject **args, Py_ssize_t nargs,
+            PyObject *kwds)
 {
-    return min_max(args, kwds, Py_LT);
+    return min_max(args, nargs, kwds, Py_LT);
 }
 
 PyDoc_STRVAR(min_doc,
@@ -1578,9 +1596,10 @@ With two or more arguments, return the smallest argument.");
 
 /* AC: cannot convert yet, waiting for *args support */
 static PyObject *
-builtin_max(PyObject *self, PyObject *args, PyObject *kwds)
+builtin_max(PyObject *self, PyObject **args, Py_ssize_t nargs,
+            PyObject *kwds)
 {
-    return min_max(args, kwds, Py_GT);
+    return min_max(args, nargs, kwds, Py_GT);
 }
 
 PyDoc_STRVAR(max_doc,
@@ -2582,7 +2601,7 @@ static PyMethodDef builtin_methods[] = {
     BUILTIN_EVAL_METHODDEF
     BUILTIN_EXEC_METHODDEF
     BUILTIN_FORMAT_METHODDEF
-    {"getattr",         builtin_getattr,    METH_VARARGS, getattr_doc},
+    {"getattr",         (PyCFunction)builtin_getattr, METH_FASTCALL, getattr_doc},
     BUILTIN_GLOBALS_METHODDEF
     BUILTIN_HASATTR_METHODDEF
     BUILTIN_HASH_METHODDEF
@@ -2594,8 +2613,8 @@ static PyMethodDef builtin_methods[] = {
     {"iter",            builtin_iter,       METH_VARARGS, iter_doc},
     BUILTIN_LEN_METHODDEF
     BUILTIN_LOCALS_METHODDEF
-    {"max",             (PyCFunction)builtin_max,        METH_VARARGS | METH_KEYWORDS, max_doc},
-    {"min",             (PyCFunction)builtin_min,        METH_VARARGS | METH_KEYWORDS, min_doc},
+    {"max",             (PyCFunction)builtin_max,        METH_FASTCALL | METH_KEYWORDS, max_doc},
+    {"min",             (PyCFunction)builtin_min,        METH_FASTCALL | METH_KEYWORDS, min_doc},
     {"next",            (PyCFunction)builtin_next,       METH_VARARGS, next_doc},
     BUILTIN_OCT_METHODDEF
     BUILTIN_ORD_METHODDEF
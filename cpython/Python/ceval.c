@@ -14,6 +14,7 @@
 #include "code.h"
 #include "dictobject.h"
 #include "frameobject.h"
+#include "longintrepr.h"
 #include "opcode.h"
 #include "setobject.h"
 #include "structmember.h"
@@ -138,6 +139,7 @@ static void call_exc_trace(Py_tracefunc, PyObject *,
 static int maybe_call_line_trace(Py_tracefunc, PyObject *,
                                  PyThreadState *, PyFrameObject *, int *, int *, int *);
 
+static void attrcache_fill(_PyAttrCacheEntry *, PyObject *, PyObject *);
 static PyObject * cmp_outcome(int, PyObject *, PyObject *);
 static PyObject * import_from(PyObject *, PyObject *);
 static int import_all_from(PyObject *, PyObject *);
@@ -147,6 +149,26 @@ static PyObject * unicode_concatenate(PyObject *, PyObject *,
                                       PyFrameObject *, unsigned char *);
 static PyObject * special_lookup(PyObject *, _Py_Identifier *);
 
+/* Arithmetic fast paths: exact ints of at most one digit and exact floats
+   are handled inline, without going through the number protocol.  Neither
+   type overrides the in-place slots, so INPLACE_* can use them too. */
+#define SMALL_INT_PAIR(v, w) \
+    (PyLong_CheckExact(v) && PyLong_CheckExact(w) && \
+     Py_ABS(Py_SIZE(v)) <= 1 && Py_ABS(Py_SIZE(w)) <= 1)
+#define SMALL_INT_VALUE(v) \
+    (Py_SIZE(v) < 0 ? -(sdigit)((PyLongObject *)(v))->ob_digit[0] : \
+     (Py_SIZE(v) == 0 ? (sdigit)0 : (sdigit)((PyLongObject *)(v))->ob_digit[0]))
+#define FLOAT_PAIR(v, w) (PyFloat_CheckExact(v) && PyFloat_CheckExact(w))
+#define COMPARE_VALUES(res, a, b, op) \
+    switch (op) { \
+    case Py_LT: res = (a) < (b); break; \
+    case Py_LE: res = (a) <= (b); break; \
+    case Py_EQ: res = (a) == (b); break; \
+    case Py_NE: res = (a) != (b); break; \
+    case Py_GT: res = (a) > (b); break; \
+    case Py_GE: res = (a) >= (b); break; \
+    }
+
 #define NAME_ERROR_MSG \
     "name '%.200s' is not defined"
 #define UNBOUNDLOCAL_ERROR_MSG \
@@ -936,6 +958,33 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     }
 #endif
 
+/* Used by the superinstructions: the peephole optimizer leaves the second
+   instruction of a fused pair in place, so its handler can be entered
+   directly, with a direct jump instead of an indirect one.  Code objects
+   can be built by hand, so the next opcode is still checked, and anything
+   else than op goes through the normal dispatch. */
+#ifdef LLTRACE
+#define FUSED_DISPATCH(op) \
+    { \
+        if (!lltrace && !_Py_TracingPossible && *next_instr == op) { \
+            f->f_lasti = INSTR_OFFSET(); \
+            next_instr++; \
+            goto TARGET_##op; \
+        } \
+        goto fast_next_opcode; \
+    }
+#else
+#define FUSED_DISPATCH(op) \
+    { \
+        if (!_Py_TracingPossible && *next_instr == op) { \
+            f->f_lasti = INSTR_OFFSET(); \
+            next_instr++; \
+            goto TARGET_##op; \
+        } \
+        goto fast_next_opcode; \
+    }
+#endif
+
 #else
 #define TARGET(op) \
     case op:
@@ -945,6 +994,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     case op:
 #define DISPATCH() continue
 #define FAST_DISPATCH() goto fast_next_opcode
+#define FUSED_DISPATCH(op) goto fast_next_opcode
 #endif
 
 
@@ -1388,6 +1438,41 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             FAST_DISPATCH();
         }
 
+        /* Superinstructions (see fuse_instructions() in peephole.c) */
+
+        TARGET(LOAD_FAST__LOAD_FAST) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            FUSED_DISPATCH(LOAD_FAST);
+        }
+
+        TARGET(LOAD_FAST__LOAD_ATTR) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            FUSED_DISPATCH(LOAD_ATTR);
+        }
+
+        TARGET(LOAD_CONST__RETURN_VALUE) {
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            FUSED_DISPATCH(RETURN_VALUE);
+        }
+
         PREDICTED_WITH_ARG(STORE_FAST);
         TARGET(STORE_FAST) {
             PyObject *value = POP();
@@ -1501,7 +1586,18 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(BINARY_MULTIPLY) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *res = PyNumber_Multiply(left, right);
+            PyObject *res;
+#ifdef HAVE_LONG_LONG
+            if (SMALL_INT_PAIR(left, right))
+                res = PyLong_FromLongLong((PY_LONG_LONG)(
+                    (stwodigits)SMALL_INT_VALUE(left) * SMALL_INT_VALUE(right)));
+            else
+#endif
+            if (FLOAT_PAIR(left, right))
+                res = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) *
+                                         PyFloat_AS_DOUBLE(right));
+            else
+                res = PyNumber_Multiply(left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(res);
@@ -1564,7 +1660,17 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            if (PyUnicode_CheckExact(left) &&
+            if (SMALL_INT_PAIR(left, right)) {
+                sum = PyLong_FromLong(SMALL_INT_VALUE(left) +
+                                      SMALL_INT_VALUE(right));
+                Py_DECREF(left);
+            }
+            else if (FLOAT_PAIR(left, right)) {
+                sum = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) +
+                                         PyFloat_AS_DOUBLE(right));
+                Py_DECREF(left);
+            }
+            else if (PyUnicode_CheckExact(left) &&
                      PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to v */
@@ -1583,7 +1689,15 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(BINARY_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_Subtract(left, right);
+            PyObject *diff;
+            if (SMALL_INT_PAIR(left, right))
+                diff = PyLong_FromLong(SMALL_INT_VALUE(left) -
+                                       SMALL_INT_VALUE(right));
+            else if (FLOAT_PAIR(left, right))
+                diff = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) -
+                                          PyFloat_AS_DOUBLE(right));
+            else
+                diff = PyNumber_Subtract(left, right);
             Py_DECREF(right);
             Py_DECREF(left);
             SET_TOP(diff);
@@ -1764,7 +1878,17 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
+            if (SMALL_INT_PAIR(left, right)) {
+                sum = PyLong_FromLong(SMALL_INT_VALUE(left) +
+                                      SMALL_INT_VALUE(right));
+                Py_DECREF(left);
+            }
+            else if (FLOAT_PAIR(left, right)) {
+                sum = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) +
+                                         PyFloat_AS_DOUBLE(right));
+                Py_DECREF(left);
+            }
+            else if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to v */
             }
@@ -1782,7 +1906,15 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(INPLACE_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_InPlaceSubtract(left, right);
+            PyObject *diff;
+            if (SMALL_INT_PAIR(left, right))
+                diff = PyLong_FromLong(SMALL_INT_VALUE(left) -
+                                       SMALL_INT_VALUE(right));
+            else if (FLOAT_PAIR(left, right))
+                diff = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) -
+                                          PyFloat_AS_DOUBLE(right));
+            else
+                diff = PyNumber_InPlaceSubtract(left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(diff);
@@ -2370,14 +2502,38 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *v;
             if (PyDict_CheckExact(f->f_globals)
                 && PyDict_CheckExact(f->f_builtins)) {
-                v = _PyDict_LoadGlobal((PyDictObject *)f->f_globals,
-                                       (PyDictObject *)f->f_builtins,
-                                       name);
-                if (v == NULL) {
-                    if (!_PyErr_OCCURRED())
-                        format_exc_check_arg(PyExc_NameError,
-                                             NAME_ERROR_MSG, name);
+                PyDictObject *globals = (PyDictObject *)f->f_globals;
+                PyDictObject *builtins = (PyDictObject *)f->f_builtins;
+                _PyGlobalCacheEntry *entry;
+                if (co->co_globalcache == NULL &&
+                    _PyCode_InitGlobalCache(co) < 0)
                     goto error;
+                entry = &co->co_globalcache->entries[oparg];
+                if (entry->globals_ver == globals->ma_version_tag &&
+                    entry->builtins_ver == builtins->ma_version_tag) {
+                    /* Neither dict changed since the entry was filled */
+                    co->co_globalcache->hits++;
+                    v = entry->value;
+                }
+                else {
+                    PY_UINT64_T globals_ver = globals->ma_version_tag;
+                    PY_UINT64_T builtins_ver = builtins->ma_version_tag;
+                    co->co_globalcache->misses++;
+                    v = _PyDict_LoadGlobal(globals, builtins, name);
+                    if (v == NULL) {
+                        if (!_PyErr_OCCURRED())
+                            format_exc_check_arg(PyExc_NameError,
+                                                 NAME_ERROR_MSG, name);
+                        goto error;
+                    }
+                    /* Key comparisons may have run arbitrary code: only
+                       fill the entry if neither dict was modified */
+                    if (globals->ma_version_tag == globals_ver &&
+                        builtins->ma_version_tag == builtins_ver) {
+                        entry->globals_ver = globals_ver;
+                        entry->builtins_ver = builtins_ver;
+                        entry->value = v;
+                    }
                 }
                 Py_INCREF(v);
             }
@@ -2491,6 +2647,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
                 PyObject *item = POP();
                 PyTuple_SET_ITEM(tup, oparg, item);
             }
+            _PyTuple_MaybeUntrack(tup);
             PUSH(tup);
             DISPATCH();
         }
@@ -2503,6 +2660,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
                 PyObject *item = POP();
                 PyList_SET_ITEM(list, oparg, item);
             }
+            _PyList_MaybeUntrack(list);
             PUSH(list);
             DISPATCH();
         }
@@ -2533,9 +2691,11 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
                 Py_DECREF(sum);
                 if (return_value == NULL)
                     goto error;
+                _PyTuple_MaybeUntrack(return_value);
             }
             else {
                 return_value = sum;
+                _PyList_MaybeUntrack(return_value);
             }
 
             while (oparg--)
@@ -2704,7 +2864,38 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(LOAD_ATTR) {
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
-            PyObject *res = PyObject_GetAttr(owner, name);
+            PyTypeObject *type = Py_TYPE(owner);
+            _PyAttrCacheEntry *entry = NULL;
+            PyObject *res;
+            if (type->tp_getattro == PyObject_GenericGetAttr &&
+                type->tp_dictoffset > 0) {
+                unsigned short site;
+                if (co->co_attrcache == NULL &&
+                    _PyCode_InitAttrCache(co) < 0)
+                    goto error;
+                site = co->co_attrcache->site_index[INSTR_OFFSET() - 3];
+                if (site != _PyAttrCache_NOSITE)
+                    entry = &co->co_attrcache->entries[site];
+            }
+            if (entry != NULL && entry->type == type &&
+                entry->tp_version == type->tp_version_tag &&
+                PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+                PyDictObject *dict = *(PyDictObject **)
+                    ((char *)owner + type->tp_dictoffset);
+                if (dict != NULL && dict->ma_keys == entry->keys) {
+                    assert(_PyDict_HasSplitTable(dict));
+                    res = dict->ma_values[entry->index];
+                    if (res != NULL) {
+                        Py_INCREF(res);
+                        Py_DECREF(owner);
+                        SET_TOP(res);
+                        DISPATCH();
+                    }
+                }
+            }
+            res = PyObject_GetAttr(owner, name);
+            if (res != NULL && entry != NULL)
+                attrcache_fill(entry, owner, name);
             Py_DECREF(owner);
             SET_TOP(res);
             if (res == NULL)
@@ -2726,6 +2917,21 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(COMPARE_OP__POP_JUMP_IF_FALSE) {
+            PyObject *right = POP();
+            PyObject *left = TOP();
+            PyObject *res = cmp_outcome(oparg, left, right);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            SET_TOP(res);
+            if (res == NULL)
+                goto error;
+            /* the comparison may have run arbitrary code */
+            if (_Py_atomic_load_relaxed(&eval_breaker))
+                DISPATCH();
+            FUSED_DISPATCH(POP_JUMP_IF_FALSE);
+        }
+
         TARGET(IMPORT_NAME) {
             _Py_IDENTIFIER(__import__);
             PyObject *name = GETITEM(names, oparg);
@@ -4645,6 +4851,14 @@ call_function(PyObject ***pp_stack, int oparg
                 x = NULL;
             }
         }
+        else if (flags & METH_FASTCALL) {
+            /* The arguments are passed straight from the stack, and
+               popped below */
+            PyObject **args = (*pp_stack) - na;
+            READ_TIMESTAMP(*pintr0);
+            C_TRACE(x, _PyCFunction_FastCall(func, args, na));
+            READ_TIMESTAMP(*pintr1);
+        }
         else {
             PyObject *callargs;
             callargs = load_args(pp_stack, na);
@@ -4687,7 +4901,8 @@ call_function(PyObject ***pp_stack, int oparg
 
     /* Clear the stack of the function object.  Also removes
        the arguments in case they weren't consumed already
-       (fast_function() and err_args() leave them on the stack).
+       (fast_function(), METH_FASTCALL functions and err_args() leave
+       them on the stack).
      */
     while ((*pp_stack) > pfunc) {
         w = EXT_POP(*pp_stack);
@@ -5017,6 +5232,35 @@ _PyEval_SliceIndex(PyObject *v, Py_ssize_t *pi)
     return 1;
 }
 
+/* Remember in a LOAD_ATTR cache entry where the attribute name of owner
+   was found, if it is a plain value stored in a split-table instance dict
+   and no attribute of the same name exists on the type. */
+static void
+attrcache_fill(_PyAttrCacheEntry *entry, PyObject *owner, PyObject *name)
+{
+    PyTypeObject *type = Py_TYPE(owner);
+    PyDictObject *dict;
+    Py_ssize_t index;
+
+    /* Check the version tag first: _PyType_Lookup() assigns one */
+    if (_PyType_Lookup(type, name) != NULL ||
+        !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+        return;
+    dict = *(PyDictObject **)((char *)owner + type->tp_dictoffset);
+    if (dict == NULL || !PyDict_CheckExact(dict))
+        return;
+    index = _PyDict_GetSplitIndex(dict, name);
+    if (index < 0)
+        return;
+    _PyDictKeys_IncRef(dict->ma_keys);
+    if (entry->keys != NULL)
+        _PyDictKeys_DecRef(entry->keys);
+    entry->type = type;
+    entry->tp_version = type->tp_version_tag;
+    entry->keys = dict->ma_keys;
+    entry->index = index;
+}
+
 #define CANNOT_CATCH_MSG "catching classes that do not inherit from "\
                          "BaseException is not allowed"
 
@@ -5065,6 +5309,17 @@ cmp_outcome(int op, PyObject *v, PyObject *w)
         res = PyErr_GivenExceptionMatches(v, w);
         break;
     default:
+        /* PyCmp_LT .. PyCmp_GE are the same as Py_LT .. Py_GE */
+        if (SMALL_INT_PAIR(v, w)) {
+            sdigit a = SMALL_INT_VALUE(v), b = SMALL_INT_VALUE(w);
+            COMPARE_VALUES(res, a, b, op);
+            break;
+        }
+        if (FLOAT_PAIR(v, w)) {
+            double a = PyFloat_AS_DOUBLE(v), b = PyFloat_AS_DOUBLE(w);
+            COMPARE_VALUES(res, a, b, op);
+            break;
+        }
         return PyObject_RichCompare(v, w, op);
     }
     v = res ? Py_True : Py_False;
@@ -57,6 +57,19 @@ static unsigned long gil_interval = DEFAULT_INTERVAL;
      run and end up being the first to re-acquire it, making the "timeslices"
      much longer than expected.
      (Note: this mechanism is enabled with FORCE_SWITCHING above)
+
+   - In FIFO mode (sys._setgilmode("fifo")), GIL-awaiting threads line up
+     in a queue (gil_waiters) and the GIL goes to the head of the queue
+     when it is dropped, instead of to whichever thread the OS wakes up
+     first. The queue is ordered by the priority hint of the thread states
+     (tstate->gil_priority), then by arrival order. A thread which arrives
+     with a higher priority than the GIL holder sets gil_drop_request right
+     away instead of waiting `interval` microseconds, so that e.g. an I/O
+     thread woken by an event doesn't wait behind CPU-bound threads.
+     Threads of equal priority still switch every `interval`.
+
+   - The time each thread waits for the GIL is recorded in its thread state
+     (gil_wait_hist, gil_wait_total, gil_wait_max), see sys._getgilstats().
 */
 
 #include "condvar.h"
@@ -88,6 +101,9 @@ static unsigned long gil_interval = DEFAULT_INTERVAL;
 #define COND_SIGNAL(cond) \
     if (PyCOND_SIGNAL(&(cond))) { \
         Py_FatalError("PyCOND_SIGNAL(" #cond ") failed"); };
+#define COND_BROADCAST(cond) \
+    if (PyCOND_BROADCAST(&(cond))) { \
+        Py_FatalError("PyCOND_BROADCAST(" #cond ") failed"); };
 #define COND_WAIT(cond, mut) \
     if (PyCOND_WAIT(&(cond), &(mut))) { \
         Py_FatalError("PyCOND_WAIT(" #cond ") failed"); };
@@ -126,6 +142,23 @@ static COND_T switch_cond;
 static MUTEX_T switch_mutex;
 #endif
 
+/* FIFO mode, see the notes above. The following variables are protected
+   by gil_mutex. */
+static int gil_fifo = 0;
+
+/* A thread waiting for the GIL in FIFO mode; lives on the stack of
+   take_gil(). */
+struct gil_waiter {
+    int priority;
+    struct gil_waiter *next;
+};
+
+/* Queue of the threads waiting for the GIL in FIFO mode, highest priority
+   first */
+static struct gil_waiter *gil_waiters = NULL;
+/* Priority of the thread holding the GIL */
+static int gil_holder_priority = 0;
+
 
 static int gil_created(void)
 {
@@ -143,6 +176,7 @@ static void create_gil(void)
     COND_INIT(switch_cond);
 #endif
     _Py_atomic_store_relaxed(&gil_last_holder, NULL);
+    gil_waiters = NULL;
     _Py_ANNOTATE_RWLOCK_CREATE(&gil_locked);
     _Py_atomic_store_explicit(&gil_locked, 0, _Py_memory_order_release);
 }
@@ -184,7 +218,14 @@ static void drop_gil(PyThreadState *tstate)
     MUTEX_LOCK(gil_mutex);
     _Py_ANNOTATE_RWLOCK_RELEASED(&gil_locked, /*is_write=*/1);
     _Py_atomic_store_relaxed(&gil_locked, 0);
-    COND_SIGNAL(gil_cond);
+    if (gil_waiters != NULL) {
+        /* Only the head of the queue may take the GIL, but we don't know
+           which thread it is. */
+        COND_BROADCAST(gil_cond);
+    }
+    else {
+        COND_SIGNAL(gil_cond);
+    }
     MUTEX_UNLOCK(gil_mutex);
 
 #ifdef FORCE_SWITCHING
@@ -204,9 +245,41 @@ static void drop_gil(PyThreadState *tstate)
 #endif
 }
 
+/* Insert `w` in the queue of GIL-awaiting threads, after the threads of
+   the same or higher priority. */
+static void gil_enqueue(struct gil_waiter *w)
+{
+    struct gil_waiter **p = &gil_waiters;
+
+    while (*p != NULL && (*p)->priority >= w->priority)
+        p = &(*p)->next;
+    w->next = *p;
+    *p = w;
+}
+
+/* Account for a wait of `wait` nanoseconds in the statistics of tstate */
+static void gil_record_wait(PyThreadState *tstate, _PyTime_t wait)
+{
+    _PyTime_t us = wait / 1000;
+    int i = 0;
+
+    /* bucket i > 0 counts waits in [2**(i-1); 2**i) microseconds */
+    while (us > 0 && i < _PyGIL_WAIT_BUCKETS - 1) {
+        us >>= 1;
+        i++;
+    }
+    tstate->gil_wait_hist[i]++;
+    tstate->gil_wait_total += wait;
+    if (wait > tstate->gil_wait_max)
+        tstate->gil_wait_max = wait;
+}
+
 static void take_gil(PyThreadState *tstate)
 {
     int err;
+    _PyTime_t wait_start = 0;
+    struct gil_waiter waiter;
+    int queued = 0;
 #ifdef MS_UWP
     int last_error;
 #endif
@@ -219,10 +292,24 @@ static void take_gil(PyThreadState *tstate)
 #endif
     MUTEX_LOCK(gil_mutex);
 
-    if (!_Py_atomic_load_relaxed(&gil_locked))
+    if (!_Py_atomic_load_relaxed(&gil_locked) &&
+        (!gil_fifo || gil_waiters == NULL))
         goto _ready;
 
-    while (_Py_atomic_load_relaxed(&gil_locked)) {
+    wait_start = _PyTime_GetMonotonicClockRaw();
+    if (gil_fifo) {
+        waiter.priority = tstate->gil_priority;
+        gil_enqueue(&waiter);
+        queued = 1;
+        if (_Py_atomic_load_relaxed(&gil_locked) &&
+            waiter.priority > gil_holder_priority) {
+            /* Preempt a lower priority holder */
+            SET_GIL_DROP_REQUEST();
+        }
+    }
+
+    while (_Py_atomic_load_relaxed(&gil_locked) ||
+           (queued && gil_waiters != &waiter)) {
         int timed_out = 0;
         unsigned long saved_switchnum;
 
@@ -236,6 +323,10 @@ static void take_gil(PyThreadState *tstate)
             SET_GIL_DROP_REQUEST();
         }
     }
+    if (queued) {
+        /* We are the head of the queue */
+        gil_waiters = waiter.next;
+    }
 _ready:
 #ifdef FORCE_SWITCHING
     /* This mutex must be taken before modifying gil_last_holder (see drop_gil()). */
@@ -249,6 +340,9 @@ _ready:
         _Py_atomic_store_relaxed(&gil_last_holder, tstate);
         ++gil_switch_number;
     }
+    gil_holder_priority = tstate->gil_priority;
+    gil_record_wait(tstate, wait_start ?
+                            _PyTime_GetMonotonicClockRaw() - wait_start : 0);
 
 #ifdef FORCE_SWITCHING
     COND_SIGNAL(switch_cond);
@@ -277,3 +371,19 @@ unsigned long _PyEval_GetSwitchInterval()
 {
     return gil_interval;
 }
+
+void _PyEval_SetGILFifo(int fifo)
+{
+    if (gil_created()) {
+        MUTEX_LOCK(gil_mutex);
+        gil_fifo = fifo;
+        MUTEX_UNLOCK(gil_mutex);
+    }
+    else
+        gil_fifo = fifo;
+}
+
+int _PyEval_GetGILFifo(void)
+{
+    return gil_fifo;
+}
@@ -1024,6 +1024,16 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
         case DELETE_FAST:
             return 0;
 
+        /* Superinstructions added by the peephole optimizer: the second
+           instruction of the pair is still present and accounts for its
+           own effect. */
+        case LOAD_FAST__LOAD_FAST:
+        case LOAD_FAST__LOAD_ATTR:
+        case LOAD_CONST__RETURN_VALUE:
+            return 1;
+        case COMPARE_OP__POP_JUMP_IF_FALSE:
+            return -1;
+
         case RAISE_VARARGS:
             return -oparg;
 #define NARGS(o) (((o) % 256) + 2*(((o) / 256) % 256))
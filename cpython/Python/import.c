@@ -15,6 +15,11 @@
 #ifdef HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
+#ifdef MS_WINDOWS
+#include <windows.h>
+#elif defined(HAVE_MMAP)
+#include <sys/mman.h>
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1554,8 +1559,15 @@ PyImport_ImportModuleLevelObject(PyObject *name, PyObject *given_globals,
            __spec__._initializing is true.
            NOTE: because of this, initializing must be set *before*
            stuffing the new module in sys.modules.
+           The spec of a module is read from its dict, as getting any
+           attribute of a lazily loaded module executes it.
          */
-        spec = _PyObject_GetAttrId(mod, &PyId___spec__);
+        if (PyModule_Check(mod)) {
+            spec = _PyDict_GetItemId(PyModule_GetDict(mod), &PyId___spec__);
+            Py_XINCREF(spec);
+        }
+        else
+            spec = _PyObject_GetAttrId(mod, &PyId___spec__);
         if (spec != NULL) {
             value = _PyObject_GetAttrId(spec, &PyId__initializing);
             Py_DECREF(spec);
@@ -2042,6 +2054,139 @@ _imp_exec_dynamic_impl(PyModuleDef *module, PyObject *mod)
 
 #endif /* HAVE_DYNAMIC_LOADING */
 
+/* A read-only mapping of a whole file, exporting its contents as a buffer.
+   importlib reads the import indexes written by compileall through it, so
+   that the processes using an index share its pages. */
+
+typedef struct {
+    PyObject_HEAD
+    char *data;
+    Py_ssize_t size;
+} mappedfileobject;
+
+static void
+mappedfile_dealloc(mappedfileobject *self)
+{
+#ifdef MS_WINDOWS
+    UnmapViewOfFile(self->data);
+#elif defined(HAVE_MMAP)
+    munmap(self->data, self->size);
+#endif
+    PyObject_Del(self);
+}
+
+static int
+mappedfile_getbuffer(mappedfileobject *self, Py_buffer *view, int flags)
+{
+    return PyBuffer_FillInfo(view, (PyObject *)self, self->data, self->size,
+                             1, flags);
+}
+
+static PyBufferProcs mappedfile_as_buffer = {
+    (getbufferproc)mappedfile_getbuffer,
+    NULL,
+};
+
+static PyTypeObject MappedFile_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_imp.mappedfile",                  /* tp_name */
+    sizeof(mappedfileobject),           /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)mappedfile_dealloc,     /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    &mappedfile_as_buffer,              /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */
+};
+
+/*[clinic input]
+_imp._map_file
+
+    fd: int
+    /
+
+Map the whole file open as fd into memory, read-only.
+
+Return an object exporting the contents of the file as a buffer; the
+file can be closed afterwards.  Raise NotImplementedError if the
+platform can't map files.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__map_file_impl(PyModuleDef *module, int fd)
+/*[clinic end generated code: output=4d923cf0f9872fd6 input=6479e91afd7c14f9]*/
+{
+#if defined(MS_WINDOWS) || defined(HAVE_MMAP)
+    struct _Py_stat_struct st;
+    mappedfileobject *self;
+    char *data;
+#ifdef MS_WINDOWS
+    HANDLE fh, map;
+#endif
+
+    if (_Py_fstat(fd, &st) < 0)
+        return NULL;
+    if (st.st_size == 0 || st.st_size > PY_SSIZE_T_MAX) {
+        PyErr_SetString(PyExc_ValueError, "can't map a file of this size");
+        return NULL;
+    }
+#ifdef MS_WINDOWS
+    _Py_BEGIN_SUPPRESS_IPH
+    fh = (HANDLE)_get_osfhandle(fd);
+    _Py_END_SUPPRESS_IPH
+    if (fh == INVALID_HANDLE_VALUE) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    map = CreateFileMapping(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (map == NULL) {
+        PyErr_SetFromWindowsErr(0);
+        return NULL;
+    }
+    /* the view keeps the mapping alive */
+    data = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(map);
+    if (data == NULL) {
+        PyErr_SetFromWindowsErr(0);
+        return NULL;
+    }
+#else
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+#endif
+    self = PyObject_New(mappedfileobject, &MappedFile_Type);
+    if (self == NULL) {
+#ifdef MS_WINDOWS
+        UnmapViewOfFile(data);
+#else
+        munmap(data, (size_t)st.st_size);
+#endif
+        return NULL;
+    }
+    self->data = data;
+    self->size = (Py_ssize_t)st.st_size;
+    return (PyObject *)self;
+#else
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "files can't be mapped on this platform");
+    return NULL;
+#endif
+}
+
 /*[clinic input]
 dump buffer
 [clinic start generated code]*/
@@ -2065,6 +2210,7 @@ static PyMethodDef imp_methods[] = {
     _IMP_CREATE_DYNAMIC_METHODDEF
     _IMP_EXEC_DYNAMIC_METHODDEF
     _IMP__FIX_CO_FILENAME_METHODDEF
+    _IMP__MAP_FILE_METHODDEF
     {NULL, NULL}  /* sentinel */
 };
 
@@ -2086,6 +2232,8 @@ PyInit_imp(void)
 {
     PyObject *m, *d;
 
+    if (PyType_Ready(&MappedFile_Type) < 0)
+        return NULL;
     m = PyModule_Create(&impmodule);
     if (m == NULL)
         goto failure;
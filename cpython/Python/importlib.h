@@ -43,7 +43,7 @@ const unsigned char _Py_M__importlib[] = {
     90,46,0,100,1,0,100,1,0,102,0,0,100,80,0,100,
     87,0,100,88,0,132,4,0,90,47,0,100,89,0,100,90,
     0,132,0,0,90,48,0,100,91,0,100,92,0,132,0,0,
-    90,49,0,100,93,0,100,94,0,132,0,0,90,50,0,100,
+    90,49,0,100,93,0,100,94,0,132,0,0,90,50,0,158,
     1,0,83,41,95,97,83,1,0,0,67,111,114,101,32,105,
     109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,
     32,105,109,112,111,114,116,46,10,10,84,104,105,115,32,109,
@@ -69,11 +69,11 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,0,0,0,3,0,0,0,7,0,0,0,67,
     0,0,0,115,92,0,0,0,120,66,0,100,1,0,100,2,
     0,100,3,0,100,4,0,103,4,0,68,93,46,0,125,2,
-    0,116,0,0,124,1,0,124,2,0,131,2,0,114,19,0,
-    116,1,0,124,0,0,124,2,0,116,2,0,124,1,0,124,
-    2,0,131,2,0,131,3,0,1,113,19,0,87,124,0,0,
-    106,3,0,106,4,0,124,1,0,106,3,0,131,1,0,1,
-    100,5,0,83,41,6,122,47,83,105,109,112,108,101,32,115,
+    0,116,0,0,155,1,0,124,2,0,131,2,0,114,19,0,
+    116,1,0,155,0,0,124,2,0,116,2,0,155,1,0,124,
+    2,0,131,2,0,131,3,0,1,113,19,0,87,156,0,0,
+    106,3,0,106,4,0,156,1,0,106,3,0,131,1,0,1,
+    158,5,0,83,41,6,122,47,83,105,109,112,108,101,32,115,
     117,98,115,116,105,116,117,116,101,32,102,111,114,32,102,117,
     110,99,116,111,111,108,115,46,117,112,100,97,116,101,95,119,
     114,97,112,112,101,114,46,218,10,95,95,109,111,100,117,108,
@@ -99,23 +99,23 @@ const unsigned char _Py_M__importlib[] = {
     58,0,0,0,101,0,0,90,1,0,100,0,0,90,2,0,
     100,1,0,90,3,0,100,2,0,100,3,0,132,0,0,90,
     4,0,100,4,0,100,5,0,132,0,0,90,5,0,100,6,
-    0,100,7,0,132,0,0,90,6,0,100,8,0,83,41,9,
+    0,100,7,0,132,0,0,90,6,0,158,8,0,83,41,9,
     218,13,95,77,97,110,97,103,101,82,101,108,111,97,100,122,
     63,77,97,110,97,103,101,115,32,116,104,101,32,112,111,115,
     115,105,98,108,101,32,99,108,101,97,110,45,117,112,32,111,
     102,32,115,121,115,46,109,111,100,117,108,101,115,32,102,111,
     114,32,108,111,97,100,95,109,111,100,117,108,101,40,41,46,
     99,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,
-    0,67,0,0,0,115,13,0,0,0,124,1,0,124,0,0,
-    95,0,0,100,0,0,83,41,1,78,41,1,218,5,95,110,
+    0,67,0,0,0,115,13,0,0,0,155,1,0,124,0,0,
+    95,0,0,158,0,0,83,41,1,78,41,1,218,5,95,110,
     97,109,101,41,2,218,4,115,101,108,102,114,15,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,
     8,95,95,105,110,105,116,95,95,43,0,0,0,115,2,0,
     0,0,0,1,122,22,95,77,97,110,97,103,101,82,101,108,
     111,97,100,46,95,95,105,110,105,116,95,95,99,1,0,0,
     0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,25,0,0,0,124,0,0,106,0,0,116,1,0,106,
-    2,0,107,6,0,124,0,0,95,3,0,100,0,0,83,41,
+    0,115,25,0,0,0,156,0,0,106,0,0,116,1,0,106,
+    2,0,107,6,0,124,0,0,95,3,0,158,0,0,83,41,
     1,78,41,4,114,18,0,0,0,114,14,0,0,0,218,7,
     109,111,100,117,108,101,115,218,10,95,105,115,95,114,101,108,
     111,97,100,41,1,114,19,0,0,0,114,10,0,0,0,114,
@@ -125,14 +125,14 @@ const unsigned char _Py_M__importlib[] = {
     95,101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,
     0,2,0,0,0,11,0,0,0,71,0,0,0,115,77,0,
     0,0,116,0,0,100,1,0,100,2,0,132,0,0,124,1,
-    0,68,131,1,0,131,1,0,114,73,0,124,0,0,106,1,
-    0,12,114,73,0,121,17,0,116,2,0,106,3,0,124,0,
-    0,106,4,0,61,87,110,18,0,4,116,5,0,107,10,0,
-    114,72,0,1,1,1,89,110,1,0,88,100,0,0,83,41,
+    0,68,131,1,0,131,1,0,114,73,0,156,0,0,106,1,
+    0,12,114,73,0,121,17,0,116,2,0,106,3,0,156,0,
+    0,106,4,0,61,87,110,18,0,4,116,5,0,157,10,0,
+    114,72,0,1,1,1,89,110,1,0,88,158,0,0,83,41,
     3,78,99,1,0,0,0,0,0,0,0,2,0,0,0,3,
     0,0,0,115,0,0,0,115,27,0,0,0,124,0,0,93,
     17,0,125,1,0,124,1,0,100,0,0,107,9,0,86,1,
-    113,3,0,100,0,0,83,41,1,78,114,10,0,0,0,41,
+    113,3,0,158,0,0,83,41,1,78,114,10,0,0,0,41,
     2,218,2,46,48,218,3,97,114,103,114,10,0,0,0,114,
     10,0,0,0,114,11,0,0,0,250,9,60,103,101,110,101,
     120,112,114,62,50,0,0,0,115,2,0,0,0,6,0,122,
@@ -153,7 +153,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,115,8,0,0,0,12,2,6,2,12,3,12,3,
     114,17,0,0,0,99,0,0,0,0,0,0,0,0,0,0,
     0,0,1,0,0,0,64,0,0,0,115,16,0,0,0,101,
-    0,0,90,1,0,100,0,0,90,2,0,100,1,0,83,41,
+    0,0,90,1,0,100,0,0,90,2,0,158,1,0,83,41,
     2,218,14,95,68,101,97,100,108,111,99,107,69,114,114,111,
     114,78,41,3,114,1,0,0,0,114,0,0,0,0,114,2,
     0,0,0,114,10,0,0,0,114,10,0,0,0,114,10,0,
@@ -165,7 +165,7 @@ const unsigned char _Py_M__importlib[] = {
     0,90,4,0,100,4,0,100,5,0,132,0,0,90,5,0,
     100,6,0,100,7,0,132,0,0,90,6,0,100,8,0,100,
     9,0,132,0,0,90,7,0,100,10,0,100,11,0,132,0,
-    0,90,8,0,100,12,0,83,41,13,218,11,95,77,111,100,
+    0,90,8,0,158,12,0,83,41,13,218,11,95,77,111,100,
     117,108,101,76,111,99,107,122,169,65,32,114,101,99,117,114,
     115,105,118,101,32,108,111,99,107,32,105,109,112,108,101,109,
     101,110,116,97,116,105,111,110,32,119,104,105,99,104,32,105,
@@ -180,9 +180,9 @@ const unsigned char _Py_M__importlib[] = {
     32,32,99,2,0,0,0,0,0,0,0,2,0,0,0,2,
     0,0,0,67,0,0,0,115,70,0,0,0,116,0,0,106,
     1,0,131,0,0,124,0,0,95,2,0,116,0,0,106,1,
-    0,131,0,0,124,0,0,95,3,0,124,1,0,124,0,0,
+    0,131,0,0,124,0,0,95,3,0,155,1,0,124,0,0,
     95,4,0,100,0,0,124,0,0,95,5,0,100,1,0,124,
-    0,0,95,6,0,100,1,0,124,0,0,95,7,0,100,0,
+    0,0,95,6,0,100,1,0,124,0,0,95,7,0,158,0,
     0,83,41,2,78,233,0,0,0,0,41,8,218,7,95,116,
     104,114,101,97,100,90,13,97,108,108,111,99,97,116,101,95,
     108,111,99,107,218,4,108,111,99,107,218,6,119,97,107,101,
@@ -194,12 +194,12 @@ const unsigned char _Py_M__importlib[] = {
     1,9,1,122,20,95,77,111,100,117,108,101,76,111,99,107,
     46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,
     0,0,4,0,0,0,2,0,0,0,67,0,0,0,115,88,
-    0,0,0,116,0,0,106,1,0,131,0,0,125,1,0,124,
+    0,0,0,116,0,0,106,1,0,131,0,0,125,1,0,156,
     0,0,106,2,0,125,2,0,120,60,0,116,3,0,106,4,
     0,124,2,0,131,1,0,125,3,0,124,3,0,100,0,0,
-    107,8,0,114,55,0,100,1,0,83,124,3,0,106,2,0,
-    125,2,0,124,2,0,124,1,0,107,2,0,114,24,0,100,
-    2,0,83,113,24,0,87,100,0,0,83,41,3,78,70,84,
+    157,8,0,114,55,0,158,1,0,83,156,3,0,106,2,0,
+    125,2,0,155,2,0,124,1,0,157,2,0,114,24,0,158,
+    2,0,83,113,24,0,87,158,0,0,83,41,3,78,70,84,
     41,5,114,34,0,0,0,218,9,103,101,116,95,105,100,101,
     110,116,114,37,0,0,0,218,12,95,98,108,111,99,107,105,
     110,103,95,111,110,218,3,103,101,116,41,4,114,19,0,0,
@@ -212,18 +212,18 @@ const unsigned char _Py_M__importlib[] = {
     107,99,1,0,0,0,0,0,0,0,2,0,0,0,16,0,
     0,0,67,0,0,0,115,210,0,0,0,116,0,0,106,1,
     0,131,0,0,125,1,0,124,0,0,116,2,0,124,1,0,
-    60,122,173,0,120,166,0,124,0,0,106,3,0,143,124,0,
-    1,124,0,0,106,4,0,100,1,0,107,2,0,115,68,0,
-    124,0,0,106,5,0,124,1,0,107,2,0,114,96,0,124,
+    60,122,173,0,120,166,0,156,0,0,106,3,0,143,124,0,
+    1,156,0,0,106,4,0,100,1,0,107,2,0,115,68,0,
+    156,0,0,106,5,0,124,1,0,157,2,0,114,96,0,155,
     1,0,124,0,0,95,5,0,124,0,0,4,106,4,0,100,
-    2,0,55,2,95,4,0,100,3,0,83,124,0,0,106,6,
+    2,0,55,2,95,4,0,158,3,0,83,156,0,0,106,6,
     0,131,0,0,114,124,0,116,7,0,100,4,0,124,0,0,
-    22,131,1,0,130,1,0,124,0,0,106,8,0,106,9,0,
+    22,131,1,0,130,1,0,156,0,0,106,8,0,106,9,0,
     100,5,0,131,1,0,114,157,0,124,0,0,4,106,10,0,
-    100,2,0,55,2,95,10,0,87,100,6,0,81,82,88,124,
-    0,0,106,8,0,106,9,0,131,0,0,1,124,0,0,106,
+    100,2,0,55,2,95,10,0,87,100,6,0,81,82,88,156,
+    0,0,106,8,0,106,9,0,131,0,0,1,156,0,0,106,
     8,0,106,11,0,131,0,0,1,113,28,0,87,87,100,6,
-    0,116,2,0,124,1,0,61,88,100,6,0,83,41,7,122,
+    0,116,2,0,124,1,0,61,88,158,6,0,83,41,7,122,
     185,10,32,32,32,32,32,32,32,32,65,99,113,117,105,114,
     101,32,116,104,101,32,109,111,100,117,108,101,32,108,111,99,
     107,46,32,32,73,102,32,97,32,112,111,116,101,110,116,105,
@@ -250,16 +250,16 @@ const unsigned char _Py_M__importlib[] = {
     19,95,77,111,100,117,108,101,76,111,99,107,46,97,99,113,
     117,105,114,101,99,1,0,0,0,0,0,0,0,2,0,0,
     0,10,0,0,0,67,0,0,0,115,157,0,0,0,116,0,
-    0,106,1,0,131,0,0,125,1,0,124,0,0,106,2,0,
-    143,129,0,1,124,0,0,106,3,0,124,1,0,107,3,0,
-    114,49,0,116,4,0,100,1,0,131,1,0,130,1,0,124,
+    0,106,1,0,131,0,0,125,1,0,156,0,0,106,2,0,
+    143,129,0,1,156,0,0,106,3,0,124,1,0,157,3,0,
+    114,49,0,116,4,0,100,1,0,131,1,0,130,1,0,156,
     0,0,106,5,0,100,2,0,107,4,0,115,70,0,116,6,
     0,130,1,0,124,0,0,4,106,5,0,100,3,0,56,2,
-    95,5,0,124,0,0,106,5,0,100,2,0,107,2,0,114,
-    146,0,100,0,0,124,0,0,95,3,0,124,0,0,106,7,
+    95,5,0,156,0,0,106,5,0,100,2,0,157,2,0,114,
+    146,0,100,0,0,124,0,0,95,3,0,156,0,0,106,7,
     0,114,146,0,124,0,0,4,106,7,0,100,3,0,56,2,
-    95,7,0,124,0,0,106,8,0,106,9,0,131,0,0,1,
-    87,100,0,0,81,82,88,100,0,0,83,41,4,78,122,31,
+    95,7,0,156,0,0,106,8,0,106,9,0,131,0,0,1,
+    87,100,0,0,81,82,88,158,0,0,83,41,4,78,122,31,
     99,97,110,110,111,116,32,114,101,108,101,97,115,101,32,117,
     110,45,97,99,113,117,105,114,101,100,32,108,111,99,107,114,
     33,0,0,0,114,45,0,0,0,41,10,114,34,0,0,0,
@@ -274,7 +274,7 @@ const unsigned char _Py_M__importlib[] = {
     122,19,95,77,111,100,117,108,101,76,111,99,107,46,114,101,
     108,101,97,115,101,99,1,0,0,0,0,0,0,0,1,0,
     0,0,4,0,0,0,67,0,0,0,115,25,0,0,0,100,
-    1,0,106,0,0,124,0,0,106,1,0,116,2,0,124,0,
+    1,0,106,0,0,156,0,0,106,1,0,116,2,0,124,0,
     0,131,1,0,131,2,0,83,41,2,78,122,23,95,77,111,
     100,117,108,101,76,111,99,107,40,123,33,114,125,41,32,97,
     116,32,123,125,41,3,218,6,102,111,114,109,97,116,114,15,
@@ -294,7 +294,7 @@ const unsigned char _Py_M__importlib[] = {
     0,100,1,0,90,3,0,100,2,0,100,3,0,132,0,0,
     90,4,0,100,4,0,100,5,0,132,0,0,90,5,0,100,
     6,0,100,7,0,132,0,0,90,6,0,100,8,0,100,9,
-    0,132,0,0,90,7,0,100,10,0,83,41,11,218,16,95,
+    0,132,0,0,90,7,0,158,10,0,83,41,11,218,16,95,
     68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,122,
     86,65,32,115,105,109,112,108,101,32,95,77,111,100,117,108,
     101,76,111,99,107,32,101,113,117,105,118,97,108,101,110,116,
@@ -303,8 +303,8 @@ const unsigned char _Py_M__importlib[] = {
     117,108,116,105,45,116,104,114,101,97,100,105,110,103,32,115,
     117,112,112,111,114,116,46,99,2,0,0,0,0,0,0,0,
     2,0,0,0,2,0,0,0,67,0,0,0,115,22,0,0,
-    0,124,1,0,124,0,0,95,0,0,100,1,0,124,0,0,
-    95,1,0,100,0,0,83,41,2,78,114,33,0,0,0,41,
+    0,155,1,0,124,0,0,95,0,0,100,1,0,124,0,0,
+    95,1,0,158,0,0,83,41,2,78,114,33,0,0,0,41,
     2,114,15,0,0,0,114,38,0,0,0,41,2,114,19,0,
     0,0,114,15,0,0,0,114,10,0,0,0,114,10,0,0,
     0,114,11,0,0,0,114,20,0,0,0,140,0,0,0,115,
@@ -312,17 +312,17 @@ const unsigned char _Py_M__importlib[] = {
     77,111,100,117,108,101,76,111,99,107,46,95,95,105,110,105,
     116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,
     3,0,0,0,67,0,0,0,115,19,0,0,0,124,0,0,
-    4,106,0,0,100,1,0,55,2,95,0,0,100,2,0,83,
+    4,106,0,0,100,1,0,55,2,95,0,0,158,2,0,83,
     41,3,78,114,45,0,0,0,84,41,1,114,38,0,0,0,
     41,1,114,19,0,0,0,114,10,0,0,0,114,10,0,0,
     0,114,11,0,0,0,114,46,0,0,0,144,0,0,0,115,
     4,0,0,0,0,1,15,1,122,24,95,68,117,109,109,121,
     77,111,100,117,108,101,76,111,99,107,46,97,99,113,117,105,
     114,101,99,1,0,0,0,0,0,0,0,1,0,0,0,3,
-    0,0,0,67,0,0,0,115,46,0,0,0,124,0,0,106,
-    0,0,100,1,0,107,2,0,114,27,0,116,1,0,100,2,
+    0,0,0,67,0,0,0,115,46,0,0,0,156,0,0,106,
+    0,0,100,1,0,157,2,0,114,27,0,116,1,0,100,2,
     0,131,1,0,130,1,0,124,0,0,4,106,0,0,100,3,
-    0,56,2,95,0,0,100,0,0,83,41,4,78,114,33,0,
+    0,56,2,95,0,0,158,0,0,83,41,4,78,114,33,0,
     0,0,122,31,99,97,110,110,111,116,32,114,101,108,101,97,
     115,101,32,117,110,45,97,99,113,117,105,114,101,100,32,108,
     111,99,107,114,45,0,0,0,41,2,114,38,0,0,0,114,
@@ -332,7 +332,7 @@ const unsigned char _Py_M__importlib[] = {
     95,68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,
     46,114,101,108,101,97,115,101,99,1,0,0,0,0,0,0,
     0,1,0,0,0,4,0,0,0,67,0,0,0,115,25,0,
-    0,0,100,1,0,106,0,0,124,0,0,106,1,0,116,2,
+    0,0,100,1,0,106,0,0,156,0,0,106,1,0,116,2,
     0,124,0,0,131,1,0,131,2,0,83,41,2,78,122,28,
     95,68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,
     40,123,33,114,125,41,32,97,116,32,123,125,41,3,114,50,
@@ -351,11 +351,11 @@ const unsigned char _Py_M__importlib[] = {
     52,0,0,0,101,0,0,90,1,0,100,0,0,90,2,0,
     100,1,0,100,2,0,132,0,0,90,3,0,100,3,0,100,
     4,0,132,0,0,90,4,0,100,5,0,100,6,0,132,0,
-    0,90,5,0,100,7,0,83,41,8,218,18,95,77,111,100,
+    0,90,5,0,158,7,0,83,41,8,218,18,95,77,111,100,
     117,108,101,76,111,99,107,77,97,110,97,103,101,114,99,2,
     0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,
-    0,0,0,115,22,0,0,0,124,1,0,124,0,0,95,0,
-    0,100,0,0,124,0,0,95,1,0,100,0,0,83,41,1,
+    0,0,0,115,22,0,0,0,155,1,0,124,0,0,95,0,
+    0,100,0,0,124,0,0,95,1,0,158,0,0,83,41,1,
     78,41,2,114,18,0,0,0,218,5,95,108,111,99,107,41,
     2,114,19,0,0,0,114,15,0,0,0,114,10,0,0,0,
     114,10,0,0,0,114,11,0,0,0,114,20,0,0,0,159,
@@ -363,10 +363,10 @@ const unsigned char _Py_M__importlib[] = {
     111,100,117,108,101,76,111,99,107,77,97,110,97,103,101,114,
     46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,
     0,0,1,0,0,0,10,0,0,0,67,0,0,0,115,53,
-    0,0,0,122,22,0,116,0,0,124,0,0,106,1,0,131,
+    0,0,0,122,22,0,116,0,0,156,0,0,106,1,0,131,
     1,0,124,0,0,95,2,0,87,100,0,0,116,3,0,106,
-    4,0,131,0,0,1,88,124,0,0,106,2,0,106,5,0,
-    131,0,0,1,100,0,0,83,41,1,78,41,6,218,16,95,
+    4,0,131,0,0,1,88,156,0,0,106,2,0,106,5,0,
+    131,0,0,1,158,0,0,83,41,1,78,41,6,218,16,95,
     103,101,116,95,109,111,100,117,108,101,95,108,111,99,107,114,
     18,0,0,0,114,55,0,0,0,218,4,95,105,109,112,218,
     12,114,101,108,101,97,115,101,95,108,111,99,107,114,46,0,
@@ -376,8 +376,8 @@ const unsigned char _Py_M__importlib[] = {
     95,77,111,100,117,108,101,76,111,99,107,77,97,110,97,103,
     101,114,46,95,95,101,110,116,101,114,95,95,99,1,0,0,
     0,0,0,0,0,3,0,0,0,1,0,0,0,79,0,0,
-    0,115,17,0,0,0,124,0,0,106,0,0,106,1,0,131,
-    0,0,1,100,0,0,83,41,1,78,41,2,114,55,0,0,
+    0,115,17,0,0,0,156,0,0,106,0,0,106,1,0,131,
+    0,0,1,158,0,0,83,41,1,78,41,2,114,55,0,0,
     0,114,47,0,0,0,41,3,114,19,0,0,0,114,29,0,
     0,0,90,6,107,119,97,114,103,115,114,10,0,0,0,114,
     10,0,0,0,114,11,0,0,0,114,30,0,0,0,170,0,
@@ -391,13 +391,13 @@ const unsigned char _Py_M__importlib[] = {
     54,0,0,0,99,1,0,0,0,0,0,0,0,3,0,0,
     0,11,0,0,0,3,0,0,0,115,139,0,0,0,100,1,
     0,125,1,0,121,17,0,116,0,0,136,0,0,25,131,0,
-    0,125,1,0,87,110,18,0,4,116,1,0,107,10,0,114,
+    0,125,1,0,87,110,18,0,4,116,1,0,157,10,0,114,
     43,0,1,1,1,89,110,1,0,88,124,1,0,100,1,0,
-    107,8,0,114,135,0,116,2,0,100,1,0,107,8,0,114,
+    157,8,0,114,135,0,116,2,0,100,1,0,157,8,0,114,
     83,0,116,3,0,136,0,0,131,1,0,125,1,0,110,12,
     0,116,4,0,136,0,0,131,1,0,125,1,0,135,0,0,
     102,1,0,100,2,0,100,3,0,134,0,0,125,2,0,116,
-    5,0,106,6,0,124,1,0,124,2,0,131,2,0,116,0,
+    5,0,106,6,0,155,1,0,124,2,0,131,2,0,116,0,
     0,136,0,0,60,124,1,0,83,41,4,122,109,71,101,116,
     32,111,114,32,99,114,101,97,116,101,32,116,104,101,32,109,
     111,100,117,108,101,32,108,111,99,107,32,102,111,114,32,97,
@@ -407,7 +407,7 @@ const unsigned char _Py_M__importlib[] = {
     105,116,104,32,116,104,101,32,105,109,112,111,114,116,32,108,
     111,99,107,32,116,97,107,101,110,46,78,99,1,0,0,0,
     0,0,0,0,1,0,0,0,2,0,0,0,19,0,0,0,
-    115,11,0,0,0,116,0,0,136,0,0,61,100,0,0,83,
+    115,11,0,0,0,116,0,0,136,0,0,61,158,0,0,83,
     41,1,78,41,1,218,13,95,109,111,100,117,108,101,95,108,
     111,99,107,115,41,1,218,1,95,41,1,114,15,0,0,0,
     114,10,0,0,0,114,11,0,0,0,218,2,99,98,190,0,
@@ -424,9 +424,9 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,
     0,0,0,115,71,0,0,0,116,0,0,124,0,0,131,1,
     0,125,1,0,116,1,0,106,2,0,131,0,0,1,121,14,
-    0,124,1,0,106,3,0,131,0,0,1,87,110,18,0,4,
-    116,4,0,107,10,0,114,56,0,1,1,1,89,110,11,0,
-    88,124,1,0,106,5,0,131,0,0,1,100,1,0,83,41,
+    0,156,1,0,106,3,0,131,0,0,1,87,110,18,0,4,
+    116,4,0,157,10,0,114,56,0,1,1,1,89,110,11,0,
+    88,156,1,0,106,5,0,131,0,0,1,158,1,0,83,41,
     2,97,21,1,0,0,82,101,108,101,97,115,101,32,116,104,
     101,32,103,108,111,98,97,108,32,105,109,112,111,114,116,32,
     108,111,99,107,44,32,97,110,100,32,97,99,113,117,105,114,
@@ -453,7 +453,7 @@ const unsigned char _Py_M__importlib[] = {
     115,14,0,0,0,0,7,12,1,10,1,3,1,14,1,13,
     3,5,2,114,63,0,0,0,99,1,0,0,0,0,0,0,
     0,3,0,0,0,3,0,0,0,79,0,0,0,115,13,0,
-    0,0,124,0,0,124,1,0,124,2,0,142,0,0,83,41,
+    0,0,155,0,0,155,1,0,124,2,0,142,0,0,83,41,
     1,97,46,1,0,0,114,101,109,111,118,101,95,105,109,112,
     111,114,116,108,105,98,95,102,114,97,109,101,115,32,105,110,
     32,105,109,112,111,114,116,46,99,32,119,105,108,108,32,97,
@@ -481,11 +481,11 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,218,9,118,101,114,98,111,115,105,116,121,114,45,
     0,0,0,99,1,0,0,0,1,0,0,0,3,0,0,0,
     4,0,0,0,71,0,0,0,115,75,0,0,0,116,0,0,
-    106,1,0,106,2,0,124,1,0,107,5,0,114,71,0,124,
+    106,1,0,106,2,0,124,1,0,157,5,0,114,71,0,156,
     0,0,106,3,0,100,6,0,131,1,0,115,43,0,100,3,
-    0,124,0,0,23,125,0,0,116,4,0,124,0,0,106,5,
+    0,124,0,0,23,125,0,0,116,4,0,156,0,0,106,5,
     0,124,2,0,140,0,0,100,4,0,116,0,0,106,6,0,
-    131,1,1,1,100,5,0,83,41,7,122,61,80,114,105,110,
+    131,1,1,1,158,5,0,83,41,7,122,61,80,114,105,110,
     116,32,116,104,101,32,109,101,115,115,97,103,101,32,116,111,
     32,115,116,100,101,114,114,32,105,102,32,45,118,47,80,89,
     84,72,79,78,86,69,82,66,79,83,69,32,105,115,32,116,
@@ -509,9 +509,9 @@ const unsigned char _Py_M__importlib[] = {
     100,117,108,101,32,105,115,32,98,117,105,108,116,45,105,110,
     46,99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,
     0,0,19,0,0,0,115,55,0,0,0,124,1,0,116,0,
-    0,106,1,0,107,7,0,114,42,0,116,2,0,100,1,0,
+    0,106,1,0,157,7,0,114,42,0,116,2,0,100,1,0,
     106,3,0,124,1,0,131,1,0,100,2,0,124,1,0,131,
-    1,1,130,1,0,136,0,0,124,0,0,124,1,0,131,2,
+    1,1,130,1,0,136,0,0,155,0,0,124,1,0,131,2,
     0,83,41,3,78,122,29,123,33,114,125,32,105,115,32,110,
     111,116,32,97,32,98,117,105,108,116,45,105,110,32,109,111,
     100,117,108,101,114,15,0,0,0,41,4,114,14,0,0,0,
@@ -541,7 +541,7 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,0,4,0,0,0,19,0,0,0,115,55,0,0,
     0,116,0,0,106,1,0,124,1,0,131,1,0,115,42,0,
     116,2,0,100,1,0,106,3,0,124,1,0,131,1,0,100,
-    2,0,124,1,0,131,1,1,130,1,0,136,0,0,124,0,
+    2,0,124,1,0,131,1,1,130,1,0,136,0,0,155,0,
     0,124,1,0,131,2,0,83,41,3,78,122,27,123,33,114,
     125,32,105,115,32,110,111,116,32,97,32,102,114,111,122,101,
     110,32,109,111,100,117,108,101,114,15,0,0,0,41,4,114,
@@ -560,12 +560,12 @@ const unsigned char _Py_M__importlib[] = {
     105,114,101,115,95,102,114,111,122,101,110,244,0,0,0,115,
     6,0,0,0,0,2,18,5,13,1,114,84,0,0,0,99,
     2,0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,
-    67,0,0,0,115,81,0,0,0,116,0,0,124,1,0,124,
+    67,0,0,0,115,81,0,0,0,116,0,0,155,1,0,124,
     0,0,131,2,0,125,2,0,124,1,0,116,1,0,106,2,
-    0,107,6,0,114,67,0,116,1,0,106,2,0,124,1,0,
-    25,125,3,0,116,3,0,124,2,0,124,3,0,131,2,0,
+    0,157,6,0,114,67,0,116,1,0,106,2,0,124,1,0,
+    25,125,3,0,116,3,0,155,2,0,124,3,0,131,2,0,
     1,116,1,0,106,2,0,124,1,0,25,83,116,4,0,124,
-    2,0,131,1,0,83,100,1,0,83,41,2,122,128,76,111,
+    2,0,131,1,0,83,158,1,0,83,41,2,122,128,76,111,
     97,100,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
     32,109,111,100,117,108,101,32,105,110,116,111,32,115,121,115,
     46,109,111,100,117,108,101,115,32,97,110,100,32,114,101,116,
@@ -585,21 +585,21 @@ const unsigned char _Py_M__importlib[] = {
     0,99,1,0,0,0,0,0,0,0,5,0,0,0,35,0,
     0,0,67,0,0,0,115,6,1,0,0,116,0,0,124,0,
     0,100,1,0,100,0,0,131,3,0,125,1,0,116,1,0,
-    124,1,0,100,2,0,131,2,0,114,71,0,121,17,0,124,
+    124,1,0,100,2,0,131,2,0,114,71,0,121,17,0,156,
     1,0,106,2,0,124,0,0,131,1,0,83,87,110,18,0,
-    4,116,3,0,107,10,0,114,70,0,1,1,1,89,110,1,
-    0,88,121,13,0,124,0,0,106,4,0,125,2,0,87,110,
-    18,0,4,116,5,0,107,10,0,114,104,0,1,1,1,89,
-    110,23,0,88,124,2,0,100,0,0,107,9,0,114,127,0,
-    116,6,0,124,2,0,131,1,0,83,121,13,0,124,0,0,
-    106,7,0,125,3,0,87,110,24,0,4,116,5,0,107,10,
+    4,116,3,0,157,10,0,114,70,0,1,1,1,89,110,1,
+    0,88,121,13,0,156,0,0,106,4,0,125,2,0,87,110,
+    18,0,4,116,5,0,157,10,0,114,104,0,1,1,1,89,
+    110,23,0,88,124,2,0,100,0,0,157,9,0,114,127,0,
+    116,6,0,124,2,0,131,1,0,83,121,13,0,156,0,0,
+    106,7,0,125,3,0,87,110,24,0,4,116,5,0,157,10,
     0,114,166,0,1,1,1,100,3,0,125,3,0,89,110,1,
-    0,88,121,13,0,124,0,0,106,8,0,125,4,0,87,110,
-    59,0,4,116,5,0,107,10,0,114,241,0,1,1,1,124,
-    1,0,100,0,0,107,8,0,114,221,0,100,4,0,106,9,
-    0,124,3,0,131,1,0,83,100,5,0,106,9,0,124,3,
+    0,88,121,13,0,156,0,0,106,8,0,125,4,0,87,110,
+    59,0,4,116,5,0,157,10,0,114,241,0,1,1,1,124,
+    1,0,100,0,0,157,8,0,114,221,0,100,4,0,106,9,
+    0,124,3,0,131,1,0,83,100,5,0,106,9,0,155,3,
     0,124,1,0,131,2,0,83,89,110,17,0,88,100,6,0,
-    106,9,0,124,3,0,124,4,0,131,2,0,83,100,0,0,
+    106,9,0,155,3,0,124,4,0,131,2,0,83,158,0,0,
     83,41,7,78,218,10,95,95,108,111,97,100,101,114,95,95,
     218,11,109,111,100,117,108,101,95,114,101,112,114,250,1,63,
     122,13,60,109,111,100,117,108,101,32,123,33,114,125,62,122,
@@ -624,11 +624,11 @@ const unsigned char _Py_M__importlib[] = {
     0,115,52,0,0,0,101,0,0,90,1,0,100,0,0,90,
     2,0,100,1,0,100,2,0,132,0,0,90,3,0,100,3,
     0,100,4,0,132,0,0,90,4,0,100,5,0,100,6,0,
-    132,0,0,90,5,0,100,7,0,83,41,8,218,17,95,105,
+    132,0,0,90,5,0,158,7,0,83,41,8,218,17,95,105,
     110,115,116,97,108,108,101,100,95,115,97,102,101,108,121,99,
     2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
-    67,0,0,0,115,25,0,0,0,124,1,0,124,0,0,95,
-    0,0,124,1,0,106,1,0,124,0,0,95,2,0,100,0,
+    67,0,0,0,115,25,0,0,0,155,1,0,124,0,0,95,
+    0,0,156,1,0,106,1,0,124,0,0,95,2,0,158,0,
     0,83,41,1,78,41,3,218,7,95,109,111,100,117,108,101,
     114,95,0,0,0,218,5,95,115,112,101,99,41,2,114,19,
     0,0,0,114,89,0,0,0,114,10,0,0,0,114,10,0,
@@ -637,9 +637,9 @@ const unsigned char _Py_M__importlib[] = {
     97,108,108,101,100,95,115,97,102,101,108,121,46,95,95,105,
     110,105,116,95,95,99,1,0,0,0,0,0,0,0,1,0,
     0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,100,
-    1,0,124,0,0,106,0,0,95,1,0,124,0,0,106,2,
-    0,116,3,0,106,4,0,124,0,0,106,0,0,106,5,0,
-    60,100,0,0,83,41,2,78,84,41,6,114,104,0,0,0,
+    1,0,156,0,0,106,0,0,95,1,0,156,0,0,106,2,
+    0,116,3,0,106,4,0,156,0,0,106,0,0,106,5,0,
+    60,158,0,0,83,41,2,78,84,41,6,114,104,0,0,0,
     218,13,95,105,110,105,116,105,97,108,105,122,105,110,103,114,
     103,0,0,0,114,14,0,0,0,114,21,0,0,0,114,15,
     0,0,0,41,1,114,19,0,0,0,114,10,0,0,0,114,
@@ -648,17 +648,17 @@ const unsigned char _Py_M__importlib[] = {
     115,116,97,108,108,101,100,95,115,97,102,101,108,121,46,95,
     95,101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,
     0,3,0,0,0,17,0,0,0,71,0,0,0,115,121,0,
-    0,0,122,101,0,124,0,0,106,0,0,125,2,0,116,1,
+    0,0,122,101,0,156,0,0,106,0,0,125,2,0,116,1,
     0,100,1,0,100,2,0,132,0,0,124,1,0,68,131,1,
     0,131,1,0,114,78,0,121,17,0,116,2,0,106,3,0,
-    124,2,0,106,4,0,61,87,113,100,0,4,116,5,0,107,
+    156,2,0,106,4,0,61,87,113,100,0,4,116,5,0,157,
     10,0,114,74,0,1,1,1,89,113,100,0,88,110,22,0,
-    116,6,0,100,3,0,124,2,0,106,4,0,124,2,0,106,
-    7,0,131,3,0,1,87,100,0,0,100,4,0,124,0,0,
-    106,0,0,95,8,0,88,100,0,0,83,41,5,78,99,1,
+    116,6,0,100,3,0,156,2,0,106,4,0,156,2,0,106,
+    7,0,131,3,0,1,87,100,0,0,100,4,0,156,0,0,
+    106,0,0,95,8,0,88,158,0,0,83,41,5,78,99,1,
     0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,115,
     0,0,0,115,27,0,0,0,124,0,0,93,17,0,125,1,
-    0,124,1,0,100,0,0,107,9,0,86,1,113,3,0,100,
+    0,124,1,0,100,0,0,107,9,0,86,1,113,3,0,158,
     0,0,83,41,1,78,114,10,0,0,0,41,2,114,24,0,
     0,0,114,25,0,0,0,114,10,0,0,0,114,10,0,0,
     0,114,11,0,0,0,114,26,0,0,0,68,1,0,0,115,
@@ -692,7 +692,7 @@ const unsigned char _Py_M__importlib[] = {
     15,0,100,16,0,132,0,0,131,1,0,90,10,0,101,7,
     0,100,17,0,100,18,0,132,0,0,131,1,0,90,11,0,
     101,11,0,106,9,0,100,19,0,100,18,0,132,0,0,131,
-    1,0,90,11,0,100,3,0,83,41,20,218,10,77,111,100,
+    1,0,90,11,0,158,3,0,83,41,20,218,10,77,111,100,
     117,108,101,83,112,101,99,97,208,5,0,0,84,104,101,32,
     115,112,101,99,105,102,105,99,97,116,105,111,110,32,102,111,
     114,32,97,32,109,111,100,117,108,101,44,32,117,115,101,100,
@@ -790,12 +790,12 @@ const unsigned char _Py_M__importlib[] = {
     105,103,105,110,78,218,12,108,111,97,100,101,114,95,115,116,
     97,116,101,218,10,105,115,95,112,97,99,107,97,103,101,99,
     3,0,0,0,3,0,0,0,6,0,0,0,2,0,0,0,
-    67,0,0,0,115,79,0,0,0,124,1,0,124,0,0,95,
-    0,0,124,2,0,124,0,0,95,1,0,124,3,0,124,0,
-    0,95,2,0,124,4,0,124,0,0,95,3,0,124,5,0,
+    67,0,0,0,115,79,0,0,0,155,1,0,124,0,0,95,
+    0,0,155,2,0,124,0,0,95,1,0,155,3,0,124,0,
+    0,95,2,0,155,4,0,124,0,0,95,3,0,124,5,0,
     114,48,0,103,0,0,110,3,0,100,0,0,124,0,0,95,
     4,0,100,1,0,124,0,0,95,5,0,100,0,0,124,0,
-    0,95,6,0,100,0,0,83,41,2,78,70,41,7,114,15,
+    0,95,6,0,158,0,0,83,41,2,78,70,41,7,114,15,
     0,0,0,114,99,0,0,0,114,107,0,0,0,114,108,0,
     0,0,218,26,115,117,98,109,111,100,117,108,101,95,115,101,
     97,114,99,104,95,108,111,99,97,116,105,111,110,115,218,13,
@@ -808,14 +808,14 @@ const unsigned char _Py_M__importlib[] = {
     1,122,19,77,111,100,117,108,101,83,112,101,99,46,95,95,
     105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,2,
     0,0,0,4,0,0,0,67,0,0,0,115,147,0,0,0,
-    100,1,0,106,0,0,124,0,0,106,1,0,131,1,0,100,
-    2,0,106,0,0,124,0,0,106,2,0,131,1,0,103,2,
-    0,125,1,0,124,0,0,106,3,0,100,0,0,107,9,0,
-    114,76,0,124,1,0,106,4,0,100,3,0,106,0,0,124,
-    0,0,106,3,0,131,1,0,131,1,0,1,124,0,0,106,
-    5,0,100,0,0,107,9,0,114,116,0,124,1,0,106,4,
-    0,100,4,0,106,0,0,124,0,0,106,5,0,131,1,0,
-    131,1,0,1,100,5,0,106,0,0,124,0,0,106,6,0,
+    100,1,0,106,0,0,156,0,0,106,1,0,131,1,0,100,
+    2,0,106,0,0,156,0,0,106,2,0,131,1,0,103,2,
+    0,125,1,0,156,0,0,106,3,0,100,0,0,157,9,0,
+    114,76,0,156,1,0,106,4,0,100,3,0,106,0,0,156,
+    0,0,106,3,0,131,1,0,131,1,0,1,156,0,0,106,
+    5,0,100,0,0,157,9,0,114,116,0,156,1,0,106,4,
+    0,100,4,0,106,0,0,156,0,0,106,5,0,131,1,0,
+    131,1,0,1,100,5,0,106,0,0,156,0,0,106,6,0,
     106,7,0,100,6,0,106,8,0,124,1,0,131,1,0,131,
     2,0,83,41,7,78,122,9,110,97,109,101,61,123,33,114,
     125,122,11,108,111,97,100,101,114,61,123,33,114,125,122,11,
@@ -832,16 +832,16 @@ const unsigned char _Py_M__importlib[] = {
     25,1,15,1,12,1,13,1,122,19,77,111,100,117,108,101,
     83,112,101,99,46,95,95,114,101,112,114,95,95,99,2,0,
     0,0,0,0,0,0,3,0,0,0,11,0,0,0,67,0,
-    0,0,115,145,0,0,0,124,0,0,106,0,0,125,2,0,
-    121,107,0,124,0,0,106,1,0,124,1,0,106,1,0,107,
-    2,0,111,114,0,124,0,0,106,2,0,124,1,0,106,2,
-    0,107,2,0,111,114,0,124,0,0,106,3,0,124,1,0,
-    106,3,0,107,2,0,111,114,0,124,2,0,124,1,0,106,
-    0,0,107,2,0,111,114,0,124,0,0,106,4,0,124,1,
-    0,106,4,0,107,2,0,111,114,0,124,0,0,106,5,0,
-    124,1,0,106,5,0,107,2,0,83,87,110,22,0,4,116,
-    6,0,107,10,0,114,140,0,1,1,1,100,1,0,83,89,
-    110,1,0,88,100,0,0,83,41,2,78,70,41,7,114,110,
+    0,0,115,145,0,0,0,156,0,0,106,0,0,125,2,0,
+    121,107,0,156,0,0,106,1,0,156,1,0,106,1,0,107,
+    2,0,111,114,0,156,0,0,106,2,0,156,1,0,106,2,
+    0,107,2,0,111,114,0,156,0,0,106,3,0,156,1,0,
+    106,3,0,107,2,0,111,114,0,155,2,0,156,1,0,106,
+    0,0,107,2,0,111,114,0,156,0,0,106,4,0,156,1,
+    0,106,4,0,107,2,0,111,114,0,156,0,0,106,5,0,
+    156,1,0,106,5,0,107,2,0,83,87,110,22,0,4,116,
+    6,0,157,10,0,114,140,0,1,1,1,158,1,0,83,89,
+    110,1,0,88,158,0,0,83,41,2,78,70,41,7,114,110,
     0,0,0,114,15,0,0,0,114,99,0,0,0,114,107,0,
     0,0,218,6,99,97,99,104,101,100,218,12,104,97,115,95,
     108,111,99,97,116,105,111,110,114,96,0,0,0,41,3,114,
@@ -852,12 +852,12 @@ const unsigned char _Py_M__importlib[] = {
     1,20,1,13,1,122,17,77,111,100,117,108,101,83,112,101,
     99,46,95,95,101,113,95,95,99,1,0,0,0,0,0,0,
     0,1,0,0,0,2,0,0,0,67,0,0,0,115,85,0,
-    0,0,124,0,0,106,0,0,100,0,0,107,8,0,114,78,
-    0,124,0,0,106,1,0,100,0,0,107,9,0,114,78,0,
-    124,0,0,106,2,0,114,78,0,116,3,0,100,0,0,107,
+    0,0,156,0,0,106,0,0,100,0,0,157,8,0,114,78,
+    0,156,0,0,106,1,0,100,0,0,157,9,0,114,78,0,
+    156,0,0,106,2,0,114,78,0,116,3,0,100,0,0,157,
     8,0,114,57,0,116,4,0,130,1,0,116,3,0,106,5,
-    0,124,0,0,106,1,0,131,1,0,124,0,0,95,0,0,
-    124,0,0,106,0,0,83,41,1,78,41,6,114,112,0,0,
+    0,156,0,0,106,1,0,131,1,0,124,0,0,95,0,0,
+    156,0,0,106,0,0,83,41,1,78,41,6,114,112,0,0,
     0,114,107,0,0,0,114,111,0,0,0,218,19,95,98,111,
     111,116,115,116,114,97,112,95,101,120,116,101,114,110,97,108,
     218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,
@@ -867,16 +867,16 @@ const unsigned char _Py_M__importlib[] = {
     0,115,12,0,0,0,0,2,15,1,24,1,12,1,6,1,
     21,1,122,17,77,111,100,117,108,101,83,112,101,99,46,99,
     97,99,104,101,100,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,124,
-    1,0,124,0,0,95,0,0,100,0,0,83,41,1,78,41,
+    0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,155,
+    1,0,124,0,0,95,0,0,158,0,0,83,41,1,78,41,
     1,114,112,0,0,0,41,2,114,19,0,0,0,114,116,0,
     0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
     0,114,116,0,0,0,159,1,0,0,115,2,0,0,0,0,
     2,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
-    0,0,67,0,0,0,115,46,0,0,0,124,0,0,106,0,
-    0,100,1,0,107,8,0,114,35,0,124,0,0,106,1,0,
-    106,2,0,100,2,0,131,1,0,100,3,0,25,83,124,0,
-    0,106,1,0,83,100,1,0,83,41,4,122,32,84,104,101,
+    0,0,67,0,0,0,115,46,0,0,0,156,0,0,106,0,
+    0,100,1,0,157,8,0,114,35,0,156,0,0,106,1,0,
+    106,2,0,100,2,0,131,1,0,100,3,0,25,83,156,0,
+    0,106,1,0,83,158,1,0,83,41,4,122,32,84,104,101,
     32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,
     117,108,101,39,115,32,112,97,114,101,110,116,46,78,218,1,
     46,114,33,0,0,0,41,3,114,110,0,0,0,114,15,0,
@@ -886,7 +886,7 @@ const unsigned char _Py_M__importlib[] = {
     115,6,0,0,0,0,3,15,1,20,2,122,17,77,111,100,
     117,108,101,83,112,101,99,46,112,97,114,101,110,116,99,1,
     0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,
-    0,0,0,115,7,0,0,0,124,0,0,106,0,0,83,41,
+    0,0,0,115,7,0,0,0,156,0,0,106,0,0,83,41,
     1,78,41,1,114,111,0,0,0,41,1,114,19,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
     117,0,0,0,171,1,0,0,115,2,0,0,0,0,2,122,
@@ -894,7 +894,7 @@ const unsigned char _Py_M__importlib[] = {
     108,111,99,97,116,105,111,110,99,2,0,0,0,0,0,0,
     0,2,0,0,0,2,0,0,0,67,0,0,0,115,19,0,
     0,0,116,0,0,124,1,0,131,1,0,124,0,0,95,1,
-    0,100,0,0,83,41,1,78,41,2,218,4,98,111,111,108,
+    0,158,0,0,83,41,1,78,41,2,218,4,98,111,111,108,
     114,111,0,0,0,41,2,114,19,0,0,0,218,5,118,97,
     108,117,101,114,10,0,0,0,114,10,0,0,0,114,11,0,
     0,0,114,117,0,0,0,175,1,0,0,115,2,0,0,0,
@@ -909,18 +909,18 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,107,0,0,0,114,109,0,0,0,99,2,0,
     0,0,2,0,0,0,6,0,0,0,15,0,0,0,67,0,
     0,0,115,217,0,0,0,116,0,0,124,1,0,100,1,0,
-    131,2,0,114,110,0,116,1,0,100,2,0,107,8,0,114,
+    131,2,0,114,110,0,116,1,0,100,2,0,157,8,0,114,
     33,0,116,2,0,130,1,0,116,1,0,106,3,0,125,4,
-    0,124,3,0,100,2,0,107,8,0,114,70,0,124,4,0,
+    0,124,3,0,100,2,0,157,8,0,114,70,0,155,4,0,
     124,0,0,100,3,0,124,1,0,131,1,1,83,124,3,0,
-    114,82,0,103,0,0,110,3,0,100,2,0,125,5,0,124,
+    114,82,0,103,0,0,110,3,0,100,2,0,125,5,0,155,
     4,0,124,0,0,100,3,0,124,1,0,100,4,0,124,5,
-    0,131,1,2,83,124,3,0,100,2,0,107,8,0,114,192,
+    0,131,1,2,83,124,3,0,100,2,0,157,8,0,114,192,
     0,116,0,0,124,1,0,100,5,0,131,2,0,114,186,0,
-    121,19,0,124,1,0,106,4,0,124,0,0,131,1,0,125,
-    3,0,87,113,192,0,4,116,5,0,107,10,0,114,182,0,
+    121,19,0,156,1,0,106,4,0,124,0,0,131,1,0,125,
+    3,0,87,113,192,0,4,116,5,0,157,10,0,114,182,0,
     1,1,1,100,2,0,125,3,0,89,113,192,0,88,110,6,
-    0,100,6,0,125,3,0,116,6,0,124,0,0,124,1,0,
+    0,100,6,0,125,3,0,116,6,0,155,0,0,124,1,0,
     100,7,0,124,2,0,100,5,0,124,3,0,131,2,2,83,
     41,8,122,53,82,101,116,117,114,110,32,97,32,109,111,100,
     117,108,101,32,115,112,101,99,32,98,97,115,101,100,32,111,
@@ -939,30 +939,30 @@ const unsigned char _Py_M__importlib[] = {
     12,1,16,1,18,1,15,1,7,2,12,1,15,1,3,1,
     19,1,13,1,14,3,6,2,114,85,0,0,0,99,3,0,
     0,0,0,0,0,0,8,0,0,0,53,0,0,0,67,0,
-    0,0,115,118,1,0,0,121,13,0,124,0,0,106,0,0,
-    125,3,0,87,110,18,0,4,116,1,0,107,10,0,114,33,
-    0,1,1,1,89,110,17,0,88,124,3,0,100,0,0,107,
-    9,0,114,50,0,124,3,0,83,124,0,0,106,2,0,125,
-    4,0,124,1,0,100,0,0,107,8,0,114,105,0,121,13,
-    0,124,0,0,106,3,0,125,1,0,87,110,18,0,4,116,
-    1,0,107,10,0,114,104,0,1,1,1,89,110,1,0,88,
-    121,13,0,124,0,0,106,4,0,125,5,0,87,110,24,0,
-    4,116,1,0,107,10,0,114,144,0,1,1,1,100,0,0,
-    125,5,0,89,110,1,0,88,124,2,0,100,0,0,107,8,
-    0,114,218,0,124,5,0,100,0,0,107,8,0,114,212,0,
-    121,13,0,124,1,0,106,5,0,125,2,0,87,113,218,0,
-    4,116,1,0,107,10,0,114,208,0,1,1,1,100,0,0,
+    0,0,115,118,1,0,0,121,13,0,156,0,0,106,0,0,
+    125,3,0,87,110,18,0,4,116,1,0,157,10,0,114,33,
+    0,1,1,1,89,110,17,0,88,124,3,0,100,0,0,157,
+    9,0,114,50,0,124,3,0,83,156,0,0,106,2,0,125,
+    4,0,124,1,0,100,0,0,157,8,0,114,105,0,121,13,
+    0,156,0,0,106,3,0,125,1,0,87,110,18,0,4,116,
+    1,0,157,10,0,114,104,0,1,1,1,89,110,1,0,88,
+    121,13,0,156,0,0,106,4,0,125,5,0,87,110,24,0,
+    4,116,1,0,157,10,0,114,144,0,1,1,1,100,0,0,
+    125,5,0,89,110,1,0,88,124,2,0,100,0,0,157,8,
+    0,114,218,0,124,5,0,100,0,0,157,8,0,114,212,0,
+    121,13,0,156,1,0,106,5,0,125,2,0,87,113,218,0,
+    4,116,1,0,157,10,0,114,208,0,1,1,1,100,0,0,
     125,2,0,89,113,218,0,88,110,6,0,124,5,0,125,2,
-    0,121,13,0,124,0,0,106,6,0,125,6,0,87,110,24,
-    0,4,116,1,0,107,10,0,114,1,1,1,1,1,100,0,
-    0,125,6,0,89,110,1,0,88,121,19,0,116,7,0,124,
+    0,121,13,0,156,0,0,106,6,0,125,6,0,87,110,24,
+    0,4,116,1,0,157,10,0,114,1,1,1,1,1,100,0,
+    0,125,6,0,89,110,1,0,88,121,19,0,116,7,0,156,
     0,0,106,8,0,131,1,0,125,7,0,87,110,24,0,4,
-    116,1,0,107,10,0,114,47,1,1,1,1,100,0,0,125,
-    7,0,89,110,1,0,88,116,9,0,124,4,0,124,1,0,
+    116,1,0,157,10,0,114,47,1,1,1,1,100,0,0,125,
+    7,0,89,110,1,0,88,116,9,0,155,4,0,124,1,0,
     100,1,0,124,2,0,131,2,1,125,3,0,124,5,0,100,
-    0,0,107,8,0,114,87,1,100,2,0,110,3,0,100,3,
-    0,124,3,0,95,10,0,124,6,0,124,3,0,95,11,0,
-    124,7,0,124,3,0,95,12,0,124,3,0,83,41,4,78,
+    0,0,157,8,0,114,87,1,100,2,0,110,3,0,100,3,
+    0,124,3,0,95,10,0,155,6,0,124,3,0,95,11,0,
+    155,7,0,124,3,0,95,12,0,124,3,0,83,41,4,78,
     114,107,0,0,0,70,84,41,13,114,95,0,0,0,114,96,
     0,0,0,114,1,0,0,0,114,91,0,0,0,114,98,0,
     0,0,90,7,95,79,82,73,71,73,78,218,10,95,95,99,
@@ -982,40 +982,40 @@ const unsigned char _Py_M__importlib[] = {
     0,0,218,8,111,118,101,114,114,105,100,101,70,99,2,0,
     0,0,1,0,0,0,5,0,0,0,59,0,0,0,67,0,
     0,0,115,54,2,0,0,124,2,0,115,30,0,116,0,0,
-    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,67,0,121,16,0,124,0,0,106,1,0,124,1,
-    0,95,2,0,87,110,18,0,4,116,3,0,107,10,0,114,
+    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,157,
+    8,0,114,67,0,121,16,0,156,0,0,106,1,0,124,1,
+    0,95,2,0,87,110,18,0,4,116,3,0,157,10,0,114,
     66,0,1,1,1,89,110,1,0,88,124,2,0,115,97,0,
     116,0,0,124,1,0,100,2,0,100,0,0,131,3,0,100,
-    0,0,107,8,0,114,221,0,124,0,0,106,4,0,125,3,
-    0,124,3,0,100,0,0,107,8,0,114,187,0,124,0,0,
-    106,5,0,100,0,0,107,9,0,114,187,0,116,6,0,100,
-    0,0,107,8,0,114,151,0,116,7,0,130,1,0,116,6,
-    0,106,8,0,125,4,0,124,4,0,106,9,0,124,4,0,
-    131,1,0,125,3,0,124,0,0,106,5,0,124,3,0,95,
-    10,0,121,13,0,124,3,0,124,1,0,95,11,0,87,110,
-    18,0,4,116,3,0,107,10,0,114,220,0,1,1,1,89,
+    0,0,157,8,0,114,221,0,156,0,0,106,4,0,125,3,
+    0,124,3,0,100,0,0,157,8,0,114,187,0,156,0,0,
+    106,5,0,100,0,0,157,9,0,114,187,0,116,6,0,100,
+    0,0,157,8,0,114,151,0,116,7,0,130,1,0,116,6,
+    0,106,8,0,125,4,0,156,4,0,106,9,0,124,4,0,
+    131,1,0,125,3,0,156,0,0,106,5,0,124,3,0,95,
+    10,0,121,13,0,155,3,0,124,1,0,95,11,0,87,110,
+    18,0,4,116,3,0,157,10,0,114,220,0,1,1,1,89,
     110,1,0,88,124,2,0,115,251,0,116,0,0,124,1,0,
-    100,3,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    32,1,121,16,0,124,0,0,106,12,0,124,1,0,95,13,
-    0,87,110,18,0,4,116,3,0,107,10,0,114,31,1,1,
-    1,1,89,110,1,0,88,121,13,0,124,0,0,124,1,0,
-    95,14,0,87,110,18,0,4,116,3,0,107,10,0,114,65,
+    100,3,0,100,0,0,131,3,0,100,0,0,157,8,0,114,
+    32,1,121,16,0,156,0,0,106,12,0,124,1,0,95,13,
+    0,87,110,18,0,4,116,3,0,157,10,0,114,31,1,1,
+    1,1,89,110,1,0,88,121,13,0,155,0,0,124,1,0,
+    95,14,0,87,110,18,0,4,116,3,0,157,10,0,114,65,
     1,1,1,1,89,110,1,0,88,124,2,0,115,96,1,116,
     0,0,124,1,0,100,4,0,100,0,0,131,3,0,100,0,
-    0,107,8,0,114,148,1,124,0,0,106,5,0,100,0,0,
-    107,9,0,114,148,1,121,16,0,124,0,0,106,5,0,124,
-    1,0,95,15,0,87,110,18,0,4,116,3,0,107,10,0,
-    114,147,1,1,1,1,89,110,1,0,88,124,0,0,106,16,
+    0,157,8,0,114,148,1,156,0,0,106,5,0,100,0,0,
+    157,9,0,114,148,1,121,16,0,156,0,0,106,5,0,124,
+    1,0,95,15,0,87,110,18,0,4,116,3,0,157,10,0,
+    114,147,1,1,1,1,89,110,1,0,88,156,0,0,106,16,
     0,114,50,2,124,2,0,115,187,1,116,0,0,124,1,0,
-    100,5,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    224,1,121,16,0,124,0,0,106,17,0,124,1,0,95,18,
-    0,87,110,18,0,4,116,3,0,107,10,0,114,223,1,1,
+    100,5,0,100,0,0,131,3,0,100,0,0,157,8,0,114,
+    224,1,121,16,0,156,0,0,106,17,0,124,1,0,95,18,
+    0,87,110,18,0,4,116,3,0,157,10,0,114,223,1,1,
     1,1,89,110,1,0,88,124,2,0,115,254,1,116,0,0,
-    124,1,0,100,6,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,50,2,124,0,0,106,19,0,100,0,0,107,9,
-    0,114,50,2,121,16,0,124,0,0,106,19,0,124,1,0,
-    95,20,0,87,110,18,0,4,116,3,0,107,10,0,114,49,
+    124,1,0,100,6,0,100,0,0,131,3,0,100,0,0,157,
+    8,0,114,50,2,156,0,0,106,19,0,100,0,0,157,9,
+    0,114,50,2,121,16,0,156,0,0,106,19,0,124,1,0,
+    95,20,0,87,110,18,0,4,116,3,0,157,10,0,114,49,
     2,1,1,1,89,110,1,0,88,124,1,0,83,41,7,78,
     114,1,0,0,0,114,91,0,0,0,218,11,95,95,112,97,
     99,107,97,103,101,95,95,114,131,0,0,0,114,98,0,0,
@@ -1039,14 +1039,14 @@ const unsigned char _Py_M__importlib[] = {
     1,30,1,3,1,16,1,13,1,5,2,30,1,15,1,3,
     1,16,1,13,1,5,1,114,137,0,0,0,99,1,0,0,
     0,0,0,0,0,2,0,0,0,5,0,0,0,67,0,0,
-    0,115,129,0,0,0,100,1,0,125,1,0,116,0,0,124,
-    0,0,106,1,0,100,2,0,131,2,0,114,45,0,124,0,
+    0,115,129,0,0,0,100,1,0,125,1,0,116,0,0,156,
+    0,0,106,1,0,100,2,0,131,2,0,114,45,0,156,0,
     0,106,1,0,106,2,0,124,0,0,131,1,0,125,1,0,
-    110,40,0,116,0,0,124,0,0,106,1,0,100,3,0,131,
+    110,40,0,116,0,0,156,0,0,106,1,0,100,3,0,131,
     2,0,114,85,0,116,3,0,106,4,0,100,4,0,116,5,
     0,100,5,0,100,6,0,131,2,1,1,124,1,0,100,1,
-    0,107,8,0,114,112,0,116,6,0,124,0,0,106,7,0,
-    131,1,0,125,1,0,116,8,0,124,0,0,124,1,0,131,
+    0,157,8,0,114,112,0,116,6,0,156,0,0,106,7,0,
+    131,1,0,125,1,0,116,8,0,155,0,0,124,1,0,131,
     2,0,1,124,1,0,83,41,7,122,43,67,114,101,97,116,
     101,32,97,32,109,111,100,117,108,101,32,98,97,115,101,100,
     32,111,110,32,116,104,101,32,112,114,111,118,105,100,101,100,
@@ -1069,16 +1069,16 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,115,20,0,0,0,0,3,6,1,18,3,21,1,
     18,1,9,2,13,1,12,1,15,1,13,1,114,144,0,0,
     0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,67,0,0,0,115,149,0,0,0,124,0,0,106,0,
-    0,100,1,0,107,8,0,114,21,0,100,2,0,110,6,0,
-    124,0,0,106,0,0,125,1,0,124,0,0,106,1,0,100,
-    1,0,107,8,0,114,95,0,124,0,0,106,2,0,100,1,
-    0,107,8,0,114,73,0,100,3,0,106,3,0,124,1,0,
-    131,1,0,83,100,4,0,106,3,0,124,1,0,124,0,0,
-    106,2,0,131,2,0,83,110,50,0,124,0,0,106,4,0,
-    114,123,0,100,5,0,106,3,0,124,1,0,124,0,0,106,
-    1,0,131,2,0,83,100,6,0,106,3,0,124,0,0,106,
-    0,0,124,0,0,106,1,0,131,2,0,83,100,1,0,83,
+    0,0,67,0,0,0,115,149,0,0,0,156,0,0,106,0,
+    0,100,1,0,157,8,0,114,21,0,100,2,0,110,6,0,
+    156,0,0,106,0,0,125,1,0,156,0,0,106,1,0,100,
+    1,0,157,8,0,114,95,0,156,0,0,106,2,0,100,1,
+    0,157,8,0,114,73,0,100,3,0,106,3,0,124,1,0,
+    131,1,0,83,100,4,0,106,3,0,155,1,0,156,0,0,
+    106,2,0,131,2,0,83,110,50,0,156,0,0,106,4,0,
+    114,123,0,100,5,0,106,3,0,155,1,0,156,0,0,106,
+    1,0,131,2,0,83,100,6,0,106,3,0,156,0,0,106,
+    0,0,156,0,0,106,1,0,131,2,0,83,158,1,0,83,
     41,7,122,38,82,101,116,117,114,110,32,116,104,101,32,114,
     101,112,114,32,116,111,32,117,115,101,32,102,111,114,32,116,
     104,101,32,109,111,100,117,108,101,46,78,114,93,0,0,0,
@@ -1094,21 +1094,21 @@ const unsigned char _Py_M__importlib[] = {
     0,115,16,0,0,0,0,3,30,1,15,1,15,1,13,2,
     22,2,9,1,19,2,114,97,0,0,0,99,2,0,0,0,
     0,0,0,0,4,0,0,0,12,0,0,0,67,0,0,0,
-    115,253,0,0,0,124,0,0,106,0,0,125,2,0,116,1,
+    115,253,0,0,0,156,0,0,106,0,0,125,2,0,116,1,
     0,106,2,0,131,0,0,1,116,3,0,124,2,0,131,1,
     0,143,208,0,1,116,4,0,106,5,0,106,6,0,124,2,
-    0,131,1,0,124,1,0,107,9,0,114,89,0,100,1,0,
+    0,131,1,0,124,1,0,157,9,0,114,89,0,100,1,0,
     106,7,0,124,2,0,131,1,0,125,3,0,116,8,0,124,
-    3,0,100,2,0,124,2,0,131,1,1,130,1,0,124,0,
-    0,106,9,0,100,3,0,107,8,0,114,163,0,124,0,0,
-    106,10,0,100,3,0,107,8,0,114,140,0,116,8,0,100,
-    4,0,100,2,0,124,0,0,106,0,0,131,1,1,130,1,
-    0,116,11,0,124,0,0,124,1,0,100,5,0,100,6,0,
-    131,2,1,1,124,1,0,83,116,11,0,124,0,0,124,1,
-    0,100,5,0,100,6,0,131,2,1,1,116,12,0,124,0,
-    0,106,9,0,100,7,0,131,2,0,115,219,0,124,0,0,
+    3,0,100,2,0,124,2,0,131,1,1,130,1,0,156,0,
+    0,106,9,0,100,3,0,157,8,0,114,163,0,156,0,0,
+    106,10,0,100,3,0,157,8,0,114,140,0,116,8,0,100,
+    4,0,100,2,0,156,0,0,106,0,0,131,1,1,130,1,
+    0,116,11,0,155,0,0,124,1,0,100,5,0,100,6,0,
+    131,2,1,1,124,1,0,83,116,11,0,155,0,0,124,1,
+    0,100,5,0,100,6,0,131,2,1,1,116,12,0,156,0,
+    0,106,9,0,100,7,0,131,2,0,115,219,0,156,0,0,
     106,9,0,106,13,0,124,2,0,131,1,0,1,110,16,0,
-    124,0,0,106,9,0,106,14,0,124,1,0,131,1,0,1,
+    156,0,0,106,9,0,106,14,0,124,1,0,131,1,0,1,
     87,100,3,0,81,82,88,116,4,0,106,5,0,124,2,0,
     25,83,41,8,122,51,69,120,101,99,117,116,101,32,116,104,
     101,32,115,112,101,99,32,105,110,32,97,110,32,101,120,105,
@@ -1130,22 +1130,22 @@ const unsigned char _Py_M__importlib[] = {
     1,13,1,24,1,15,1,18,1,15,1,15,1,21,2,19,
     1,4,1,19,1,18,4,19,2,23,1,114,86,0,0,0,
     99,1,0,0,0,0,0,0,0,2,0,0,0,27,0,0,
-    0,67,0,0,0,115,3,1,0,0,124,0,0,106,0,0,
-    106,1,0,124,0,0,106,2,0,131,1,0,1,116,3,0,
-    106,4,0,124,0,0,106,2,0,25,125,1,0,116,5,0,
-    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,96,0,121,16,0,124,0,0,106,0,0,124,1,
-    0,95,6,0,87,110,18,0,4,116,7,0,107,10,0,114,
+    0,67,0,0,0,115,3,1,0,0,156,0,0,106,0,0,
+    106,1,0,156,0,0,106,2,0,131,1,0,1,116,3,0,
+    106,4,0,156,0,0,106,2,0,25,125,1,0,116,5,0,
+    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,157,
+    8,0,114,96,0,121,16,0,156,0,0,106,0,0,124,1,
+    0,95,6,0,87,110,18,0,4,116,7,0,157,10,0,114,
     95,0,1,1,1,89,110,1,0,88,116,5,0,124,1,0,
-    100,2,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    197,0,121,56,0,124,1,0,106,8,0,124,1,0,95,9,
+    100,2,0,100,0,0,131,3,0,100,0,0,157,8,0,114,
+    197,0,121,56,0,156,1,0,106,8,0,124,1,0,95,9,
     0,116,10,0,124,1,0,100,3,0,131,2,0,115,175,0,
-    124,0,0,106,2,0,106,11,0,100,4,0,131,1,0,100,
+    156,0,0,106,2,0,106,11,0,100,4,0,131,1,0,100,
     5,0,25,124,1,0,95,9,0,87,110,18,0,4,116,7,
-    0,107,10,0,114,196,0,1,1,1,89,110,1,0,88,116,
+    0,157,10,0,114,196,0,1,1,1,89,110,1,0,88,116,
     5,0,124,1,0,100,6,0,100,0,0,131,3,0,100,0,
-    0,107,8,0,114,255,0,121,13,0,124,0,0,124,1,0,
-    95,12,0,87,110,18,0,4,116,7,0,107,10,0,114,254,
+    0,157,8,0,114,255,0,121,13,0,155,0,0,124,1,0,
+    95,12,0,87,110,18,0,4,116,7,0,157,10,0,114,254,
     0,1,1,1,89,110,1,0,88,124,1,0,83,41,7,78,
     114,91,0,0,0,114,134,0,0,0,114,131,0,0,0,114,
     121,0,0,0,114,33,0,0,0,114,95,0,0,0,41,13,
@@ -1161,16 +1161,16 @@ const unsigned char _Py_M__importlib[] = {
     24,1,3,4,12,1,15,1,29,1,13,1,5,1,24,1,
     3,1,13,1,13,1,5,1,114,148,0,0,0,99,1,0,
     0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,0,
-    0,0,115,159,0,0,0,124,0,0,106,0,0,100,0,0,
-    107,9,0,114,43,0,116,1,0,124,0,0,106,0,0,100,
+    0,0,115,159,0,0,0,156,0,0,106,0,0,100,0,0,
+    157,9,0,114,43,0,116,1,0,156,0,0,106,0,0,100,
     1,0,131,2,0,115,43,0,116,2,0,124,0,0,131,1,
     0,83,116,3,0,124,0,0,131,1,0,125,1,0,116,4,
-    0,124,1,0,131,1,0,143,75,0,1,124,0,0,106,0,
-    0,100,0,0,107,8,0,114,122,0,124,0,0,106,5,0,
-    100,0,0,107,8,0,114,138,0,116,6,0,100,2,0,100,
-    3,0,124,0,0,106,7,0,131,1,1,130,1,0,110,16,
-    0,124,0,0,106,0,0,106,8,0,124,1,0,131,1,0,
-    1,87,100,0,0,81,82,88,116,9,0,106,10,0,124,0,
+    0,124,1,0,131,1,0,143,75,0,1,156,0,0,106,0,
+    0,100,0,0,157,8,0,114,122,0,156,0,0,106,5,0,
+    100,0,0,157,8,0,114,138,0,116,6,0,100,2,0,100,
+    3,0,156,0,0,106,7,0,131,1,1,130,1,0,110,16,
+    0,156,0,0,106,0,0,106,8,0,124,1,0,131,1,0,
+    1,87,100,0,0,81,82,88,116,9,0,106,10,0,156,0,
     0,106,7,0,25,83,41,4,78,114,139,0,0,0,122,14,
     109,105,115,115,105,110,103,32,108,111,97,100,101,114,114,15,
     0,0,0,41,11,114,99,0,0,0,114,4,0,0,0,114,
@@ -1184,8 +1184,8 @@ const unsigned char _Py_M__importlib[] = {
     24,3,23,5,114,149,0,0,0,99,1,0,0,0,0,0,
     0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,47,
     0,0,0,116,0,0,106,1,0,131,0,0,1,116,2,0,
-    124,0,0,106,3,0,131,1,0,143,15,0,1,116,4,0,
-    124,0,0,131,1,0,83,87,100,1,0,81,82,88,100,1,
+    156,0,0,106,3,0,131,1,0,143,15,0,1,116,4,0,
+    124,0,0,131,1,0,83,87,100,1,0,81,82,88,158,1,
     0,83,41,2,122,191,82,101,116,117,114,110,32,97,32,110,
     101,119,32,109,111,100,117,108,101,32,111,98,106,101,99,116,
     44,32,108,111,97,100,101,100,32,98,121,32,116,104,101,32,
@@ -1217,7 +1217,7 @@ const unsigned char _Py_M__importlib[] = {
     100,16,0,132,0,0,131,1,0,131,1,0,90,13,0,101,
     6,0,101,11,0,100,17,0,100,18,0,132,0,0,131,1,
     0,131,1,0,90,14,0,101,6,0,101,15,0,131,1,0,
-    90,16,0,100,4,0,83,41,19,218,15,66,117,105,108,116,
+    90,16,0,158,4,0,83,41,19,218,15,66,117,105,108,116,
     105,110,73,109,112,111,114,116,101,114,122,144,77,101,116,97,
     32,112,97,116,104,32,105,109,112,111,114,116,32,102,111,114,
     32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,
@@ -1229,7 +1229,7 @@ const unsigned char _Py_M__importlib[] = {
     105,110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,
     99,108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,
     0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,
+    0,115,16,0,0,0,100,1,0,106,0,0,156,0,0,106,
     1,0,131,1,0,83,41,2,122,115,82,101,116,117,114,110,
     32,114,101,112,114,32,102,111,114,32,116,104,101,32,109,111,
     100,117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,
@@ -1246,10 +1246,10 @@ const unsigned char _Py_M__importlib[] = {
     105,110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,
     101,95,114,101,112,114,78,99,4,0,0,0,0,0,0,0,
     4,0,0,0,5,0,0,0,67,0,0,0,115,58,0,0,
-    0,124,2,0,100,0,0,107,9,0,114,16,0,100,0,0,
+    0,124,2,0,100,0,0,157,9,0,114,16,0,158,0,0,
     83,116,0,0,106,1,0,124,1,0,131,1,0,114,50,0,
-    116,2,0,124,1,0,124,0,0,100,1,0,100,2,0,131,
-    2,1,83,100,0,0,83,100,0,0,83,41,3,78,114,107,
+    116,2,0,155,1,0,124,0,0,100,1,0,100,2,0,131,
+    2,1,83,158,0,0,83,158,0,0,83,41,3,78,114,107,
     0,0,0,122,8,98,117,105,108,116,45,105,110,41,3,114,
     57,0,0,0,90,10,105,115,95,98,117,105,108,116,105,110,
     114,85,0,0,0,41,4,218,3,99,108,115,114,78,0,0,
@@ -1260,9 +1260,9 @@ const unsigned char _Py_M__importlib[] = {
     105,108,116,105,110,73,109,112,111,114,116,101,114,46,102,105,
     110,100,95,115,112,101,99,99,3,0,0,0,0,0,0,0,
     4,0,0,0,3,0,0,0,67,0,0,0,115,41,0,0,
-    0,124,0,0,106,0,0,124,1,0,124,2,0,131,2,0,
-    125,3,0,124,3,0,100,1,0,107,9,0,114,37,0,124,
-    3,0,106,1,0,83,100,1,0,83,41,2,122,175,70,105,
+    0,156,0,0,106,0,0,155,1,0,124,2,0,131,2,0,
+    125,3,0,124,3,0,100,1,0,157,9,0,114,37,0,156,
+    3,0,106,1,0,83,158,1,0,83,41,2,122,175,70,105,
     110,100,32,116,104,101,32,98,117,105,108,116,45,105,110,32,
     109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,
     32,73,102,32,39,112,97,116,104,39,32,105,115,32,101,118,
@@ -1282,9 +1282,9 @@ const unsigned char _Py_M__importlib[] = {
     105,110,73,109,112,111,114,116,101,114,46,102,105,110,100,95,
     109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,
     0,0,0,4,0,0,0,67,0,0,0,115,67,0,0,0,
-    124,1,0,106,0,0,116,1,0,106,2,0,107,7,0,114,
-    51,0,116,3,0,100,1,0,106,4,0,124,1,0,106,0,
-    0,131,1,0,100,2,0,124,1,0,106,0,0,131,1,1,
+    156,1,0,106,0,0,116,1,0,106,2,0,157,7,0,114,
+    51,0,116,3,0,100,1,0,106,4,0,156,1,0,106,0,
+    0,131,1,0,100,2,0,156,1,0,106,0,0,131,1,1,
     130,1,0,116,5,0,116,6,0,106,7,0,124,1,0,131,
     2,0,83,41,3,122,24,67,114,101,97,116,101,32,97,32,
     98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,122,
@@ -1301,7 +1301,7 @@ const unsigned char _Py_M__importlib[] = {
     101,95,109,111,100,117,108,101,99,2,0,0,0,0,0,0,
     0,2,0,0,0,3,0,0,0,67,0,0,0,115,20,0,
     0,0,116,0,0,116,1,0,106,2,0,124,1,0,131,2,
-    0,1,100,1,0,83,41,2,122,22,69,120,101,99,32,97,
+    0,1,158,1,0,83,41,2,122,22,69,120,101,99,32,97,
     32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,
     78,41,3,114,65,0,0,0,114,57,0,0,0,90,12,101,
     120,101,99,95,100,121,110,97,109,105,99,41,2,114,19,0,
@@ -1310,7 +1310,7 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,0,0,3,122,27,66,117,105,108,116,105,110,73,
     109,112,111,114,116,101,114,46,101,120,101,99,95,109,111,100,
     117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,
-    1,0,0,0,67,0,0,0,115,4,0,0,0,100,1,0,
+    1,0,0,0,67,0,0,0,115,4,0,0,0,158,1,0,
     83,41,2,122,57,82,101,116,117,114,110,32,78,111,110,101,
     32,97,115,32,98,117,105,108,116,45,105,110,32,109,111,100,
     117,108,101,115,32,100,111,32,110,111,116,32,104,97,118,101,
@@ -1321,7 +1321,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,4,122,24,66,117,105,108,116,105,110,73,109,112,
     111,114,116,101,114,46,103,101,116,95,99,111,100,101,99,2,
     0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,
-    0,0,0,115,4,0,0,0,100,1,0,83,41,2,122,56,
+    0,0,0,115,4,0,0,0,158,1,0,83,41,2,122,56,
     82,101,116,117,114,110,32,78,111,110,101,32,97,115,32,98,
     117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,
     100,111,32,110,111,116,32,104,97,118,101,32,115,111,117,114,
@@ -1332,7 +1332,7 @@ const unsigned char _Py_M__importlib[] = {
     122,26,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
     114,46,103,101,116,95,115,111,117,114,99,101,99,2,0,0,
     0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,0,
-    0,115,4,0,0,0,100,1,0,83,41,2,122,52,82,101,
+    0,115,4,0,0,0,158,1,0,83,41,2,122,52,82,101,
     116,117,114,110,32,70,97,108,115,101,32,97,115,32,98,117,
     105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,97,
     114,101,32,110,101,118,101,114,32,112,97,99,107,97,103,101,
@@ -1366,7 +1366,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,90,13,0,101,6,0,101,12,0,100,17,0,100,18,
     0,132,0,0,131,1,0,131,1,0,90,14,0,101,6,0,
     101,12,0,100,19,0,100,20,0,132,0,0,131,1,0,131,
-    1,0,90,15,0,100,4,0,83,41,21,218,14,70,114,111,
+    1,0,90,15,0,158,4,0,83,41,21,218,14,70,114,111,
     122,101,110,73,109,112,111,114,116,101,114,122,142,77,101,116,
     97,32,112,97,116,104,32,105,109,112,111,114,116,32,102,111,
     114,32,102,114,111,122,101,110,32,109,111,100,117,108,101,115,
@@ -1378,7 +1378,7 @@ const unsigned char _Py_M__importlib[] = {
     110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,99,
     108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,0,
     0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
-    115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,1,
+    115,16,0,0,0,100,1,0,106,0,0,156,0,0,106,1,
     0,131,1,0,83,41,2,122,115,82,101,116,117,114,110,32,
     114,101,112,114,32,102,111,114,32,116,104,101,32,109,111,100,
     117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
@@ -1395,9 +1395,9 @@ const unsigned char _Py_M__importlib[] = {
     114,116,101,114,46,109,111,100,117,108,101,95,114,101,112,114,
     78,99,4,0,0,0,0,0,0,0,4,0,0,0,5,0,
     0,0,67,0,0,0,115,42,0,0,0,116,0,0,106,1,
-    0,124,1,0,131,1,0,114,34,0,116,2,0,124,1,0,
-    124,0,0,100,1,0,100,2,0,131,2,1,83,100,0,0,
-    83,100,0,0,83,41,3,78,114,107,0,0,0,90,6,102,
+    0,124,1,0,131,1,0,114,34,0,116,2,0,155,1,0,
+    124,0,0,100,1,0,100,2,0,131,2,1,83,158,0,0,
+    83,158,0,0,83,41,3,78,114,107,0,0,0,90,6,102,
     114,111,122,101,110,41,3,114,57,0,0,0,114,82,0,0,
     0,114,85,0,0,0,41,4,114,151,0,0,0,114,78,0,
     0,0,114,152,0,0,0,114,153,0,0,0,114,10,0,0,
@@ -1407,7 +1407,7 @@ const unsigned char _Py_M__importlib[] = {
     102,105,110,100,95,115,112,101,99,99,3,0,0,0,0,0,
     0,0,3,0,0,0,2,0,0,0,67,0,0,0,115,23,
     0,0,0,116,0,0,106,1,0,124,1,0,131,1,0,114,
-    19,0,124,0,0,83,100,1,0,83,41,2,122,93,70,105,
+    19,0,124,0,0,83,158,1,0,83,41,2,122,93,70,105,
     110,100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
     108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,
     115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
@@ -1420,7 +1420,7 @@ const unsigned char _Py_M__importlib[] = {
     0,115,2,0,0,0,0,7,122,26,70,114,111,122,101,110,
     73,109,112,111,114,116,101,114,46,102,105,110,100,95,109,111,
     100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,
-    0,1,0,0,0,67,0,0,0,115,4,0,0,0,100,1,
+    0,1,0,0,0,67,0,0,0,115,4,0,0,0,158,1,
     0,83,41,2,122,42,85,115,101,32,100,101,102,97,117,108,
     116,32,115,101,109,97,110,116,105,99,115,32,102,111,114,32,
     109,111,100,117,108,101,32,99,114,101,97,116,105,111,110,46,
@@ -1430,12 +1430,12 @@ const unsigned char _Py_M__importlib[] = {
     28,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
     99,114,101,97,116,101,95,109,111,100,117,108,101,99,1,0,
     0,0,0,0,0,0,3,0,0,0,4,0,0,0,67,0,
-    0,0,115,92,0,0,0,124,0,0,106,0,0,106,1,0,
+    0,0,115,92,0,0,0,156,0,0,106,0,0,106,1,0,
     125,1,0,116,2,0,106,3,0,124,1,0,131,1,0,115,
     54,0,116,4,0,100,1,0,106,5,0,124,1,0,131,1,
     0,100,2,0,124,1,0,131,1,1,130,1,0,116,6,0,
     116,2,0,106,7,0,124,1,0,131,2,0,125,2,0,116,
-    8,0,124,2,0,124,0,0,106,9,0,131,2,0,1,100,
+    8,0,155,2,0,156,0,0,106,9,0,131,2,0,1,158,
     0,0,83,41,3,78,122,27,123,33,114,125,32,105,115,32,
     110,111,116,32,97,32,102,114,111,122,101,110,32,109,111,100,
     117,108,101,114,15,0,0,0,41,10,114,95,0,0,0,114,
@@ -1449,7 +1449,7 @@ const unsigned char _Py_M__importlib[] = {
     18,1,9,1,18,1,122,26,70,114,111,122,101,110,73,109,
     112,111,114,116,101,114,46,101,120,101,99,95,109,111,100,117,
     108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
-    0,0,0,67,0,0,0,115,13,0,0,0,116,0,0,124,
+    0,0,0,67,0,0,0,115,13,0,0,0,116,0,0,155,
     0,0,124,1,0,131,2,0,83,41,1,122,95,76,111,97,
     100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,108,
     101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,115,
@@ -1473,7 +1473,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,115,2,0,0,0,0,4,122,23,70,114,111,122,101,
     110,73,109,112,111,114,116,101,114,46,103,101,116,95,99,111,
     100,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
-    0,0,0,67,0,0,0,115,4,0,0,0,100,1,0,83,
+    0,0,0,67,0,0,0,115,4,0,0,0,158,1,0,83,
     41,2,122,54,82,101,116,117,114,110,32,78,111,110,101,32,
     97,115,32,102,114,111,122,101,110,32,109,111,100,117,108,101,
     115,32,100,111,32,110,111,116,32,104,97,118,101,32,115,111,
@@ -1507,13 +1507,13 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,2,0,0,0,64,0,0,0,115,46,0,0,0,
     101,0,0,90,1,0,100,0,0,90,2,0,100,1,0,90,
     3,0,100,2,0,100,3,0,132,0,0,90,4,0,100,4,
-    0,100,5,0,132,0,0,90,5,0,100,6,0,83,41,7,
+    0,100,5,0,132,0,0,90,5,0,158,6,0,83,41,7,
     218,18,95,73,109,112,111,114,116,76,111,99,107,67,111,110,
     116,101,120,116,122,36,67,111,110,116,101,120,116,32,109,97,
     110,97,103,101,114,32,102,111,114,32,116,104,101,32,105,109,
     112,111,114,116,32,108,111,99,107,46,99,1,0,0,0,0,
     0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,115,
-    14,0,0,0,116,0,0,106,1,0,131,0,0,1,100,1,
+    14,0,0,0,116,0,0,106,1,0,131,0,0,1,158,1,
     0,83,41,2,122,24,65,99,113,117,105,114,101,32,116,104,
     101,32,105,109,112,111,114,116,32,108,111,99,107,46,78,41,
     2,114,57,0,0,0,114,145,0,0,0,41,1,114,19,0,
@@ -1523,7 +1523,7 @@ const unsigned char _Py_M__importlib[] = {
     110,116,101,120,116,46,95,95,101,110,116,101,114,95,95,99,
     4,0,0,0,0,0,0,0,4,0,0,0,1,0,0,0,
     67,0,0,0,115,14,0,0,0,116,0,0,106,1,0,131,
-    0,0,1,100,1,0,83,41,2,122,60,82,101,108,101,97,
+    0,0,1,158,1,0,83,41,2,122,60,82,101,108,101,97,
     115,101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,
     99,107,32,114,101,103,97,114,100,108,101,115,115,32,111,102,
     32,97,110,121,32,114,97,105,115,101,100,32,101,120,99,101,
@@ -1541,11 +1541,11 @@ const unsigned char _Py_M__importlib[] = {
     114,165,0,0,0,80,3,0,0,115,6,0,0,0,12,2,
     6,2,12,4,114,165,0,0,0,99,3,0,0,0,0,0,
     0,0,5,0,0,0,4,0,0,0,67,0,0,0,115,88,
-    0,0,0,124,1,0,106,0,0,100,1,0,124,2,0,100,
+    0,0,0,156,1,0,106,0,0,100,1,0,124,2,0,100,
     2,0,24,131,2,0,125,3,0,116,1,0,124,3,0,131,
-    1,0,124,2,0,107,0,0,114,52,0,116,2,0,100,3,
+    1,0,124,2,0,157,0,0,114,52,0,116,2,0,100,3,
     0,131,1,0,130,1,0,124,3,0,100,4,0,25,125,4,
-    0,124,0,0,114,84,0,100,5,0,106,3,0,124,4,0,
+    0,124,0,0,114,84,0,100,5,0,106,3,0,155,4,0,
     124,0,0,131,2,0,83,124,4,0,83,41,6,122,50,82,
     101,115,111,108,118,101,32,97,32,114,101,108,97,116,105,118,
     101,32,109,111,100,117,108,101,32,110,97,109,101,32,116,111,
@@ -1563,10 +1563,10 @@ const unsigned char _Py_M__importlib[] = {
     114,101,115,111,108,118,101,95,110,97,109,101,93,3,0,0,
     115,10,0,0,0,0,2,22,1,18,1,12,1,10,1,114,
     171,0,0,0,99,3,0,0,0,0,0,0,0,4,0,0,
-    0,3,0,0,0,67,0,0,0,115,47,0,0,0,124,0,
-    0,106,0,0,124,1,0,124,2,0,131,2,0,125,3,0,
-    124,3,0,100,0,0,107,8,0,114,34,0,100,0,0,83,
-    116,1,0,124,1,0,124,3,0,131,2,0,83,41,1,78,
+    0,3,0,0,0,67,0,0,0,115,47,0,0,0,156,0,
+    0,106,0,0,155,1,0,124,2,0,131,2,0,125,3,0,
+    124,3,0,100,0,0,157,8,0,114,34,0,158,0,0,83,
+    116,1,0,155,1,0,124,3,0,131,2,0,83,41,1,78,
     41,2,114,155,0,0,0,114,85,0,0,0,41,4,218,6,
     102,105,110,100,101,114,114,15,0,0,0,114,152,0,0,0,
     114,99,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
@@ -1575,24 +1575,24 @@ const unsigned char _Py_M__importlib[] = {
     0,3,18,1,12,1,4,1,114,173,0,0,0,99,3,0,
     0,0,0,0,0,0,9,0,0,0,27,0,0,0,67,0,
     0,0,115,42,1,0,0,116,0,0,106,1,0,100,1,0,
-    107,9,0,114,41,0,116,0,0,106,1,0,12,114,41,0,
+    157,9,0,114,41,0,116,0,0,106,1,0,12,114,41,0,
     116,2,0,106,3,0,100,2,0,116,4,0,131,2,0,1,
     124,0,0,116,0,0,106,5,0,107,6,0,125,3,0,120,
     235,0,116,0,0,106,1,0,68,93,220,0,125,4,0,116,
-    6,0,131,0,0,143,90,0,1,121,13,0,124,4,0,106,
-    7,0,125,5,0,87,110,51,0,4,116,8,0,107,10,0,
-    114,148,0,1,1,1,116,9,0,124,4,0,124,0,0,124,
-    1,0,131,3,0,125,6,0,124,6,0,100,1,0,107,8,
-    0,114,144,0,119,66,0,89,110,19,0,88,124,5,0,124,
-    0,0,124,1,0,124,2,0,131,3,0,125,6,0,87,100,
-    1,0,81,82,88,124,6,0,100,1,0,107,9,0,114,66,
+    6,0,131,0,0,143,90,0,1,121,13,0,156,4,0,106,
+    7,0,125,5,0,87,110,51,0,4,116,8,0,157,10,0,
+    114,148,0,1,1,1,116,9,0,155,4,0,155,0,0,124,
+    1,0,131,3,0,125,6,0,124,6,0,100,1,0,157,8,
+    0,114,144,0,119,66,0,89,110,19,0,88,155,5,0,155,
+    0,0,155,1,0,124,2,0,131,3,0,125,6,0,87,100,
+    1,0,81,82,88,124,6,0,100,1,0,157,9,0,114,66,
     0,124,3,0,12,114,26,1,124,0,0,116,0,0,106,5,
-    0,107,6,0,114,26,1,116,0,0,106,5,0,124,0,0,
-    25,125,7,0,121,13,0,124,7,0,106,10,0,125,8,0,
-    87,110,22,0,4,116,8,0,107,10,0,114,2,1,1,1,
+    0,157,6,0,114,26,1,116,0,0,106,5,0,124,0,0,
+    25,125,7,0,121,13,0,156,7,0,106,10,0,125,8,0,
+    87,110,22,0,4,116,8,0,157,10,0,114,2,1,1,1,
     1,124,6,0,83,89,113,30,1,88,124,8,0,100,1,0,
-    107,8,0,114,19,1,124,6,0,83,124,8,0,83,113,66,
-    0,124,6,0,83,113,66,0,87,100,1,0,83,100,1,0,
+    157,8,0,114,19,1,124,6,0,83,124,8,0,83,113,66,
+    0,124,6,0,83,113,66,0,87,158,1,0,83,158,1,0,
     83,41,3,122,23,70,105,110,100,32,97,32,109,111,100,117,
     108,101,39,115,32,108,111,97,100,101,114,46,78,122,22,115,
     121,115,46,109,101,116,97,95,112,97,116,104,32,105,115,32,
@@ -1614,15 +1614,15 @@ const unsigned char _Py_M__importlib[] = {
     0,115,179,0,0,0,116,0,0,124,0,0,116,1,0,131,
     2,0,115,42,0,116,2,0,100,1,0,106,3,0,116,4,
     0,124,0,0,131,1,0,131,1,0,131,1,0,130,1,0,
-    124,2,0,100,2,0,107,0,0,114,66,0,116,5,0,100,
+    124,2,0,100,2,0,157,0,0,114,66,0,116,5,0,100,
     3,0,131,1,0,130,1,0,124,1,0,114,144,0,116,0,
     0,124,1,0,116,1,0,131,2,0,115,102,0,116,2,0,
     100,4,0,131,1,0,130,1,0,110,42,0,124,1,0,116,
-    6,0,106,7,0,107,7,0,114,144,0,100,5,0,125,3,
-    0,116,8,0,124,3,0,106,3,0,124,1,0,131,1,0,
+    6,0,106,7,0,157,7,0,114,144,0,100,5,0,125,3,
+    0,116,8,0,156,3,0,106,3,0,124,1,0,131,1,0,
     131,1,0,130,1,0,124,0,0,12,114,175,0,124,2,0,
-    100,2,0,107,2,0,114,175,0,116,5,0,100,6,0,131,
-    1,0,130,1,0,100,7,0,83,41,8,122,28,86,101,114,
+    100,2,0,157,2,0,114,175,0,116,5,0,100,6,0,131,
+    1,0,130,1,0,158,7,0,83,41,8,122,28,86,101,114,
     105,102,121,32,97,114,103,117,109,101,110,116,115,32,97,114,
     101,32,34,115,97,110,101,34,46,122,31,109,111,100,117,108,
     101,32,110,97,109,101,32,109,117,115,116,32,98,101,32,115,
@@ -1648,24 +1648,24 @@ const unsigned char _Py_M__importlib[] = {
     114,181,0,0,0,122,16,78,111,32,109,111,100,117,108,101,
     32,110,97,109,101,100,32,122,4,123,33,114,125,99,2,0,
     0,0,0,0,0,0,8,0,0,0,12,0,0,0,67,0,
-    0,0,115,40,1,0,0,100,0,0,125,2,0,124,0,0,
+    0,0,115,40,1,0,0,100,0,0,125,2,0,156,0,0,
     106,0,0,100,1,0,131,1,0,100,2,0,25,125,3,0,
-    124,3,0,114,175,0,124,3,0,116,1,0,106,2,0,107,
-    7,0,114,59,0,116,3,0,124,1,0,124,3,0,131,2,
-    0,1,124,0,0,116,1,0,106,2,0,107,6,0,114,85,
+    124,3,0,114,175,0,124,3,0,116,1,0,106,2,0,157,
+    7,0,114,59,0,116,3,0,155,1,0,124,3,0,131,2,
+    0,1,124,0,0,116,1,0,106,2,0,157,6,0,114,85,
     0,116,1,0,106,2,0,124,0,0,25,83,116,1,0,106,
-    2,0,124,3,0,25,125,4,0,121,13,0,124,4,0,106,
-    4,0,125,2,0,87,110,61,0,4,116,5,0,107,10,0,
+    2,0,124,3,0,25,125,4,0,121,13,0,156,4,0,106,
+    4,0,125,2,0,87,110,61,0,4,116,5,0,157,10,0,
     114,174,0,1,1,1,116,6,0,100,3,0,23,106,7,0,
-    124,0,0,124,3,0,131,2,0,125,5,0,116,8,0,124,
+    155,0,0,124,3,0,131,2,0,125,5,0,116,8,0,124,
     5,0,100,4,0,124,0,0,131,1,1,100,0,0,130,2,
-    0,89,110,1,0,88,116,9,0,124,0,0,124,2,0,131,
-    2,0,125,6,0,124,6,0,100,0,0,107,8,0,114,232,
+    0,89,110,1,0,88,116,9,0,155,0,0,124,2,0,131,
+    2,0,125,6,0,124,6,0,100,0,0,157,8,0,114,232,
     0,116,8,0,116,6,0,106,7,0,124,0,0,131,1,0,
     100,4,0,124,0,0,131,1,1,130,1,0,110,12,0,116,
     10,0,124,6,0,131,1,0,125,7,0,124,3,0,114,36,
     1,116,1,0,106,2,0,124,3,0,25,125,4,0,116,11,
-    0,124,4,0,124,0,0,106,0,0,100,1,0,131,1,0,
+    0,155,4,0,156,0,0,106,0,0,100,1,0,131,1,0,
     100,5,0,25,124,7,0,131,3,0,1,124,7,0,83,41,
     6,78,114,121,0,0,0,114,33,0,0,0,122,23,59,32,
     123,33,114,125,32,105,115,32,110,111,116,32,97,32,112,97,
@@ -1686,8 +1686,8 @@ const unsigned char _Py_M__importlib[] = {
     2,13,1,29,1,114,184,0,0,0,99,2,0,0,0,0,
     0,0,0,2,0,0,0,10,0,0,0,67,0,0,0,115,
     37,0,0,0,116,0,0,124,0,0,131,1,0,143,18,0,
-    1,116,1,0,124,0,0,124,1,0,131,2,0,83,87,100,
-    1,0,81,82,88,100,1,0,83,41,2,122,54,70,105,110,
+    1,116,1,0,155,0,0,124,1,0,131,2,0,83,87,100,
+    1,0,81,82,88,158,1,0,83,41,2,122,54,70,105,110,
     100,32,97,110,100,32,108,111,97,100,32,116,104,101,32,109,
     111,100,117,108,101,44,32,97,110,100,32,114,101,108,101,97,
     115,101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,
@@ -1697,14 +1697,14 @@ const unsigned char _Py_M__importlib[] = {
     110,100,95,97,110,100,95,108,111,97,100,198,3,0,0,115,
     4,0,0,0,0,2,13,1,114,185,0,0,0,114,33,0,
     0,0,99,3,0,0,0,0,0,0,0,5,0,0,0,4,
-    0,0,0,67,0,0,0,115,166,0,0,0,116,0,0,124,
-    0,0,124,1,0,124,2,0,131,3,0,1,124,2,0,100,
-    1,0,107,4,0,114,46,0,116,1,0,124,0,0,124,1,
+    0,0,0,67,0,0,0,115,166,0,0,0,116,0,0,155,
+    0,0,155,1,0,124,2,0,131,3,0,1,124,2,0,100,
+    1,0,157,4,0,114,46,0,116,1,0,155,0,0,155,1,
     0,124,2,0,131,3,0,125,0,0,116,2,0,106,3,0,
-    131,0,0,1,124,0,0,116,4,0,106,5,0,107,7,0,
+    131,0,0,1,124,0,0,116,4,0,106,5,0,157,7,0,
     114,84,0,116,6,0,124,0,0,116,7,0,131,2,0,83,
     116,4,0,106,5,0,124,0,0,25,125,3,0,124,3,0,
-    100,2,0,107,8,0,114,152,0,116,2,0,106,8,0,131,
+    100,2,0,157,8,0,114,152,0,116,2,0,106,8,0,131,
     0,0,1,100,3,0,106,9,0,124,0,0,131,1,0,125,
     4,0,116,10,0,124,4,0,100,4,0,124,0,0,131,1,
     1,130,1,0,116,11,0,124,0,0,131,1,0,1,124,3,
@@ -1743,19 +1743,19 @@ const unsigned char _Py_M__importlib[] = {
     10,1,6,1,9,1,18,1,10,1,114,186,0,0,0,99,
     3,0,0,0,0,0,0,0,6,0,0,0,17,0,0,0,
     67,0,0,0,115,239,0,0,0,116,0,0,124,0,0,100,
-    1,0,131,2,0,114,235,0,100,2,0,124,1,0,107,6,
+    1,0,131,2,0,114,235,0,100,2,0,124,1,0,157,6,
     0,114,83,0,116,1,0,124,1,0,131,1,0,125,1,0,
-    124,1,0,106,2,0,100,2,0,131,1,0,1,116,0,0,
-    124,0,0,100,3,0,131,2,0,114,83,0,124,1,0,106,
-    3,0,124,0,0,106,4,0,131,1,0,1,120,149,0,124,
-    1,0,68,93,141,0,125,3,0,116,0,0,124,0,0,124,
-    3,0,131,2,0,115,90,0,100,4,0,106,5,0,124,0,
+    156,1,0,106,2,0,100,2,0,131,1,0,1,116,0,0,
+    124,0,0,100,3,0,131,2,0,114,83,0,156,1,0,106,
+    3,0,156,0,0,106,4,0,131,1,0,1,120,149,0,124,
+    1,0,68,93,141,0,125,3,0,116,0,0,155,0,0,124,
+    3,0,131,2,0,115,90,0,100,4,0,106,5,0,156,0,
     0,106,6,0,124,3,0,131,2,0,125,4,0,121,17,0,
-    116,7,0,124,2,0,124,4,0,131,2,0,1,87,113,90,
-    0,4,116,8,0,107,10,0,114,230,0,1,125,5,0,1,
+    116,7,0,155,2,0,124,4,0,131,2,0,1,87,113,90,
+    0,4,116,8,0,157,10,0,114,230,0,1,125,5,0,1,
     122,47,0,116,9,0,124,5,0,131,1,0,106,10,0,116,
-    11,0,131,1,0,114,209,0,124,5,0,106,12,0,124,4,
-    0,107,2,0,114,209,0,119,90,0,130,0,0,87,89,100,
+    11,0,131,1,0,114,209,0,156,5,0,106,12,0,124,4,
+    0,157,2,0,114,209,0,119,90,0,130,0,0,87,89,100,
     5,0,100,5,0,125,5,0,126,5,0,88,113,90,0,88,
     113,90,0,87,124,0,0,83,41,6,122,238,70,105,103,117,
     114,101,32,111,117,116,32,119,104,97,116,32,95,95,105,109,
@@ -1788,10 +1788,10 @@ const unsigned char _Py_M__importlib[] = {
     1,12,1,13,1,15,1,16,1,13,1,15,1,21,1,3,
     1,17,1,18,4,21,1,15,1,3,1,26,1,114,194,0,
     0,0,99,1,0,0,0,0,0,0,0,2,0,0,0,2,
-    0,0,0,67,0,0,0,115,72,0,0,0,124,0,0,106,
+    0,0,0,67,0,0,0,115,72,0,0,0,156,0,0,106,
     0,0,100,1,0,131,1,0,125,1,0,124,1,0,100,2,
-    0,107,8,0,114,68,0,124,0,0,100,3,0,25,125,1,
-    0,100,4,0,124,0,0,107,7,0,114,68,0,124,1,0,
+    0,157,8,0,114,68,0,124,0,0,100,3,0,25,125,1,
+    0,100,4,0,124,0,0,157,7,0,114,68,0,156,1,0,
     106,1,0,100,5,0,131,1,0,100,6,0,25,125,1,0,
     124,1,0,83,41,7,122,167,67,97,108,99,117,108,97,116,
     101,32,119,104,97,116,32,95,95,112,97,99,107,97,103,101,
@@ -1813,20 +1813,20 @@ const unsigned char _Py_M__importlib[] = {
     0,7,15,1,12,1,10,1,12,1,19,1,114,196,0,0,
     0,99,5,0,0,0,0,0,0,0,9,0,0,0,5,0,
     0,0,67,0,0,0,115,227,0,0,0,124,4,0,100,1,
-    0,107,2,0,114,27,0,116,0,0,124,0,0,131,1,0,
-    125,5,0,110,54,0,124,1,0,100,2,0,107,9,0,114,
+    0,157,2,0,114,27,0,116,0,0,124,0,0,131,1,0,
+    125,5,0,110,54,0,124,1,0,100,2,0,157,9,0,114,
     45,0,124,1,0,110,3,0,105,0,0,125,6,0,116,1,
-    0,124,6,0,131,1,0,125,7,0,116,0,0,124,0,0,
-    124,7,0,124,4,0,131,3,0,125,5,0,124,3,0,115,
-    207,0,124,4,0,100,1,0,107,2,0,114,122,0,116,0,
-    0,124,0,0,106,2,0,100,3,0,131,1,0,100,1,0,
+    0,124,6,0,131,1,0,125,7,0,116,0,0,155,0,0,
+    155,7,0,124,4,0,131,3,0,125,5,0,124,3,0,115,
+    207,0,124,4,0,100,1,0,157,2,0,114,122,0,116,0,
+    0,156,0,0,106,2,0,100,3,0,131,1,0,100,1,0,
     25,131,1,0,83,124,0,0,115,132,0,124,5,0,83,116,
-    3,0,124,0,0,131,1,0,116,3,0,124,0,0,106,2,
+    3,0,124,0,0,131,1,0,116,3,0,156,0,0,106,2,
     0,100,3,0,131,1,0,100,1,0,25,131,1,0,24,125,
-    8,0,116,4,0,106,5,0,124,5,0,106,6,0,100,2,
-    0,116,3,0,124,5,0,106,6,0,131,1,0,124,8,0,
-    24,133,2,0,25,25,83,110,16,0,116,7,0,124,5,0,
-    124,3,0,116,0,0,131,3,0,83,100,2,0,83,41,4,
+    8,0,116,4,0,106,5,0,156,5,0,106,6,0,100,2,
+    0,116,3,0,156,5,0,106,6,0,131,1,0,124,8,0,
+    24,133,2,0,25,25,83,110,16,0,116,7,0,155,5,0,
+    124,3,0,116,0,0,131,3,0,83,158,2,0,83,41,4,
     97,214,1,0,0,73,109,112,111,114,116,32,97,32,109,111,
     100,117,108,101,46,10,10,32,32,32,32,84,104,101,32,39,
     103,108,111,98,97,108,115,39,32,97,114,103,117,109,101,110,
@@ -1871,7 +1871,7 @@ const unsigned char _Py_M__importlib[] = {
     199,0,0,0,99,1,0,0,0,0,0,0,0,2,0,0,
     0,3,0,0,0,67,0,0,0,115,53,0,0,0,116,0,
     0,106,1,0,124,0,0,131,1,0,125,1,0,124,1,0,
-    100,0,0,107,8,0,114,43,0,116,2,0,100,1,0,124,
+    100,0,0,157,8,0,114,43,0,116,2,0,100,1,0,124,
     0,0,23,131,1,0,130,1,0,116,3,0,124,1,0,131,
     1,0,83,41,2,78,122,25,110,111,32,98,117,105,108,116,
     45,105,110,32,109,111,100,117,108,101,32,110,97,109,101,100,
@@ -1885,24 +1885,24 @@ const unsigned char _Py_M__importlib[] = {
     0,115,74,1,0,0,124,1,0,97,0,0,124,0,0,97,
     1,0,116,2,0,116,1,0,131,1,0,125,2,0,120,123,
     0,116,1,0,106,3,0,106,4,0,131,0,0,68,93,106,
-    0,92,2,0,125,3,0,125,4,0,116,5,0,124,4,0,
+    0,92,2,0,125,3,0,125,4,0,116,5,0,155,4,0,
     124,2,0,131,2,0,114,40,0,124,3,0,116,1,0,106,
-    6,0,107,6,0,114,91,0,116,7,0,125,5,0,110,27,
+    6,0,157,6,0,114,91,0,116,7,0,125,5,0,110,27,
     0,116,0,0,106,8,0,124,3,0,131,1,0,114,40,0,
-    116,9,0,125,5,0,110,3,0,113,40,0,116,10,0,124,
-    4,0,124,5,0,131,2,0,125,6,0,116,11,0,124,6,
+    116,9,0,125,5,0,110,3,0,113,40,0,116,10,0,155,
+    4,0,124,5,0,131,2,0,125,6,0,116,11,0,155,6,
     0,124,4,0,131,2,0,1,113,40,0,87,116,1,0,106,
     3,0,116,12,0,25,125,7,0,120,73,0,100,5,0,68,
-    93,65,0,125,8,0,124,8,0,116,1,0,106,3,0,107,
+    93,65,0,125,8,0,124,8,0,116,1,0,106,3,0,157,
     7,0,114,206,0,116,13,0,124,8,0,131,1,0,125,9,
     0,110,13,0,116,1,0,106,3,0,124,8,0,25,125,9,
-    0,116,14,0,124,7,0,124,8,0,124,9,0,131,3,0,
+    0,116,14,0,155,7,0,155,8,0,124,9,0,131,3,0,
     1,113,170,0,87,121,16,0,116,13,0,100,2,0,131,1,
-    0,125,10,0,87,110,24,0,4,116,15,0,107,10,0,114,
+    0,125,10,0,87,110,24,0,4,116,15,0,157,10,0,114,
     25,1,1,1,1,100,3,0,125,10,0,89,110,1,0,88,
     116,14,0,124,7,0,100,2,0,124,10,0,131,3,0,1,
     116,13,0,100,4,0,131,1,0,125,11,0,116,14,0,124,
-    7,0,100,4,0,124,11,0,131,3,0,1,100,3,0,83,
+    7,0,100,4,0,124,11,0,131,3,0,1,158,3,0,83,
     41,6,122,250,83,101,116,117,112,32,105,109,112,111,114,116,
     108,105,98,32,98,121,32,105,109,112,111,114,116,105,110,103,
     32,110,101,101,100,101,100,32,98,117,105,108,116,45,105,110,
@@ -1941,12 +1941,12 @@ const unsigned char _Py_M__importlib[] = {
     1,13,1,15,1,15,2,13,1,20,3,3,1,16,1,13,
     2,11,1,16,3,12,1,114,204,0,0,0,99,2,0,0,
     0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,
-    0,115,87,0,0,0,116,0,0,124,0,0,124,1,0,131,
+    0,115,87,0,0,0,116,0,0,155,0,0,124,1,0,131,
     2,0,1,116,1,0,106,2,0,106,3,0,116,4,0,131,
     1,0,1,116,1,0,106,2,0,106,3,0,116,5,0,131,
     1,0,1,100,1,0,100,2,0,108,6,0,125,2,0,124,
-    2,0,97,7,0,124,2,0,106,8,0,116,1,0,106,9,
-    0,116,10,0,25,131,1,0,1,100,2,0,83,41,3,122,
+    2,0,97,7,0,156,2,0,106,8,0,116,1,0,106,9,
+    0,116,10,0,25,131,1,0,1,158,2,0,83,41,3,122,
     50,73,110,115,116,97,108,108,32,105,109,112,111,114,116,108,
     105,98,32,97,115,32,116,104,101,32,105,109,112,108,101,109,
     101,110,116,97,116,105,111,110,32,111,102,32,105,109,112,111,
@@ -52,6 +52,8 @@ extern grammar _PyParser_Grammar; /* From graminit.c */
 static void initmain(PyInterpreterState *interp);
 static int initfsencoding(PyInterpreterState *interp);
 static void initsite(void);
+static void initlazyimport(void);
+static void initsnapshot(void);
 static int initstdio(void);
 static void initsigs(void);
 static void call_py_exitfuncs(void);
@@ -413,6 +415,7 @@ _Py_InitializeEx_Private(int install_sigs, int install_importlib)
         Py_FatalError("Py_Initialize: can't initialize time");
 
     import_init(interp, sysmod);
+    initsnapshot();
 
     /* initialize the faulthandler module */
     if (_PyFaulthandler_Init())
@@ -444,6 +447,8 @@ _Py_InitializeEx_Private(int install_sigs, int install_importlib)
 
     if (!Py_NoSiteFlag)
         initsite(); /* Module site */
+
+    initlazyimport();
 }
 
 void
@@ -775,6 +780,7 @@ Py_NewInterpreter(void)
         _PyImportHooks_Init();
 
         import_init(interp, sysmod);
+        initsnapshot();
 
         if (initfsencoding(interp) < 0)
             goto handle_error;
@@ -785,6 +791,7 @@ Py_NewInterpreter(void)
         initmain(interp);
         if (!Py_NoSiteFlag)
             initsite();
+        initlazyimport();
     }
 
     if (!PyErr_Occurred())
@@ -967,6 +974,75 @@ initsite(void)
     }
 }
 
+/* Turn on lazy loading for -X lazy_import.  This is done once everything
+   else is initialized: the modules imported so far, like encodings and
+   site, are imported for their side effects. */
+
+static void
+initlazyimport(void)
+{
+    PyObject *xoptions, *option, *external, *res = NULL;
+    _Py_IDENTIFIER(_enable_lazy_import);
+
+    xoptions = PySys_GetXOptions();
+    if (xoptions == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    option = PyDict_GetItemString(xoptions, "lazy_import");
+    if (option == NULL)
+        return;
+    external = PyImport_ImportModule("_frozen_importlib_external");
+    if (external != NULL) {
+        res = _PyObject_CallMethodIdObjArgs(external,
+                                            &PyId__enable_lazy_import,
+                                            option, NULL);
+        Py_DECREF(external);
+    }
+    if (res == NULL) {
+        fprintf(stderr, "'-X lazy_import' failed; traceback:\n");
+        PyErr_Print();
+    }
+    else {
+        Py_DECREF(res);
+    }
+}
+
+/* Load the modules stored in the startup snapshot named by PYTHONSNAPSHOT
+   from the snapshot.  This is done right after importlib is installed, so
+   that it covers encodings and the other modules imported during
+   initialization.  A snapshot that can't be used is reported and ignored. */
+
+static void
+initsnapshot(void)
+{
+    char *path;
+    PyObject *pathobj, *external, *res = NULL;
+    _Py_IDENTIFIER(_install_snapshot);
+
+    path = Py_GETENV("PYTHONSNAPSHOT");
+    if (path == NULL || *path == '\0')
+        return;
+    pathobj = PyUnicode_DecodeFSDefault(path);
+    if (pathobj != NULL) {
+        external = PyImport_ImportModule("_frozen_importlib_external");
+        if (external != NULL) {
+            res = _PyObject_CallMethodIdObjArgs(external,
+                                                &PyId__install_snapshot,
+                                                pathobj, NULL);
+            Py_DECREF(external);
+        }
+        Py_DECREF(pathobj);
+    }
+    if (res == NULL) {
+        fprintf(stderr, "PYTHONSNAPSHOT failed; traceback:\n");
+        PyErr_Print();
+    }
+    else {
+        Py_DECREF(res);
+    }
+}
+
 static PyObject*
 create_stdio(PyObject* io,
     int fd, int write_mode, char* name,
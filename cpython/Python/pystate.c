@@ -2,6 +2,7 @@
 /* Thread and interpreter state structures and their interfaces */
 
 #include "Python.h"
+#include "frameobject.h"
 
 /* --------------------------------------------------------------------------
 CAUTION
@@ -215,6 +216,14 @@ new_threadstate(PyInterpreterState *interp, int init)
         tstate->coroutine_wrapper = NULL;
         tstate->in_coroutine_wrapper = 0;
 
+        tstate->frame_arena = NULL;
+        tstate->obmalloc_cache = NULL;
+
+        tstate->gil_priority = 0;
+        memset(tstate->gil_wait_hist, 0, sizeof(tstate->gil_wait_hist));
+        tstate->gil_wait_total = 0;
+        tstate->gil_wait_max = 0;
+
         if (init)
             _PyThreadState_Init(tstate);
 
@@ -392,6 +401,9 @@ PyThreadState_Clear(PyThreadState *tstate)
     Py_CLEAR(tstate->c_traceobj);
 
     Py_CLEAR(tstate->coroutine_wrapper);
+
+    _PyFrame_DetachArena(tstate);
+    _PyObject_ClearThreadCache(tstate);
 }
 
 
@@ -416,6 +428,10 @@ tstate_delete_common(PyThreadState *tstate)
     if (tstate->on_delete != NULL) {
         tstate->on_delete(tstate->on_delete_data);
     }
+    /* Frames and blocks allocated or freed since PyThreadState_Clear(),
+       for example by on_delete or by finalizers run by the clear */
+    _PyFrame_DetachArena(tstate);
+    _PyObject_ClearThreadCache(tstate);
     PyMem_RawFree(tstate);
 }
 
@@ -666,6 +682,98 @@ _PyThread_CurrentFrames(void)
     return NULL;
 }
 
+/* Copy of the GIL wait statistics of a thread state */
+typedef struct {
+    long thread_id;
+    unsigned long hist[_PyGIL_WAIT_BUCKETS];
+    _PyTime_t total;
+    _PyTime_t max;
+} gil_stats;
+
+static PyObject *
+gil_stats_as_tuple(gil_stats *stats)
+{
+    PyObject *hist;
+    unsigned long count = 0;
+    int i;
+
+    hist = PyTuple_New(_PyGIL_WAIT_BUCKETS);
+    if (hist == NULL)
+        return NULL;
+    for (i = 0; i < _PyGIL_WAIT_BUCKETS; i++) {
+        PyObject *n = PyLong_FromUnsignedLong(stats->hist[i]);
+        if (n == NULL) {
+            Py_DECREF(hist);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(hist, i, n);
+        count += stats->hist[i];
+    }
+    return Py_BuildValue("(kddN)", count,
+                         _PyTime_AsSecondsDouble(stats->total),
+                         _PyTime_AsSecondsDouble(stats->max),
+                         hist);
+}
+
+/* The implementation of sys._getgilstats().  The statistics are copied
+   while holding head_mutex, since another thread can delete its thread
+   state at any time, and the dict is built afterwards: building it can run
+   arbitrary code, which must not happen with head_mutex held.
+*/
+PyObject *
+_PyThread_GILStats(PyInterpreterState *interp)
+{
+    PyObject *result = NULL;
+    PyThreadState *t;
+    gil_stats *stats;
+    Py_ssize_t n = 0, i;
+
+    HEAD_LOCK();
+    for (t = interp->tstate_head; t != NULL; t = t->next)
+        n++;
+    stats = PyMem_RawMalloc(Py_MAX(n, 1) * sizeof(gil_stats));
+    if (stats == NULL) {
+        HEAD_UNLOCK();
+        return PyErr_NoMemory();
+    }
+    for (t = interp->tstate_head, i = 0; t != NULL; t = t->next, i++) {
+        stats[i].thread_id = t->thread_id;
+        memcpy(stats[i].hist, t->gil_wait_hist, sizeof(stats[i].hist));
+        stats[i].total = t->gil_wait_total;
+        stats[i].max = t->gil_wait_max;
+    }
+    HEAD_UNLOCK();
+
+    result = PyDict_New();
+    if (result == NULL)
+        goto done;
+    for (i = 0; i < n; i++) {
+        PyObject *id, *tuple;
+        int stat;
+
+        id = PyLong_FromLong(stats[i].thread_id);
+        if (id == NULL)
+            goto fail;
+        tuple = gil_stats_as_tuple(&stats[i]);
+        if (tuple == NULL) {
+            Py_DECREF(id);
+            goto fail;
+        }
+        stat = PyDict_SetItem(result, id, tuple);
+        Py_DECREF(id);
+        Py_DECREF(tuple);
+        if (stat < 0)
+            goto fail;
+    }
+    goto done;
+
+fail:
+    Py_CLEAR(result);
+done:
+    PyMem_RawFree(stats);
+    return result;
+}
+
 /* Python "auto thread state" API. */
 #ifdef WITH_THREAD
 
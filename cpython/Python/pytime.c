@@ -543,12 +543,8 @@ _PyTime_GetSystemClockWithInfo(_PyTime_t *t, _Py_clock_info_t *info)
 
 
 static int
-pymonotonic_new(_PyTime_t *tp, _Py_clock_info_t *info, int raise)
+pymonotonic(_PyTime_t *tp, _Py_clock_info_t *info, int raise)
 {
-#ifdef Py_DEBUG
-    static int last_set = 0;
-    static _PyTime_t last = 0;
-#endif
 #if defined(MS_WINDOWS)
     static int has_gettickcount64 = -1;
     ULONGLONG result;
@@ -647,6 +643,18 @@ pymonotonic_new(_PyTime_t *tp, _Py_clock_info_t *info, int raise)
     if (_PyTime_FromTimespec(tp, &ts, raise) < 0)
         return -1;
 #endif
+    return 0;
+}
+
+static int
+pymonotonic_new(_PyTime_t *tp, _Py_clock_info_t *info, int raise)
+{
+#ifdef Py_DEBUG
+    static int last_set = 0;
+    static _PyTime_t last = 0;
+#endif
+    if (pymonotonic(tp, info, raise) < 0)
+        return -1;
 #ifdef Py_DEBUG
     /* monotonic clock cannot go backward */
     assert(!last_set || last <= *tp);
@@ -671,6 +679,18 @@ _PyTime_GetMonotonicClock(void)
     return t;
 }
 
+_PyTime_t
+_PyTime_GetMonotonicClockRaw(void)
+{
+    _PyTime_t t;
+    if (pymonotonic(&t, NULL, 0) < 0) {
+        /* should not happen, see _PyTime_GetMonotonicClock() */
+        assert(0);
+        t = 0;
+    }
+    return t;
+}
+
 int
 _PyTime_GetMonotonicClockWithInfo(_PyTime_t *tp, _Py_clock_info_t *info)
 {
@@ -600,6 +600,88 @@ PyDoc_STRVAR(getswitchinterval_doc,
 "getswitchinterval() -> current thread switch interval; see setswitchinterval()."
 );
 
+static PyObject *
+sys_setgilmode(PyObject *self, PyObject *args)
+{
+    const char *mode;
+    if (!PyArg_ParseTuple(args, "s:_setgilmode", &mode))
+        return NULL;
+    if (strcmp(mode, "classic") == 0)
+        _PyEval_SetGILFifo(0);
+    else if (strcmp(mode, "fifo") == 0)
+        _PyEval_SetGILFifo(1);
+    else {
+        PyErr_Format(PyExc_ValueError, "unknown GIL mode: %R",
+                     PyTuple_GET_ITEM(args, 0));
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(setgilmode_doc,
+"_setgilmode(mode)\n\
+\n\
+Set how the GIL is handed over between threads: 'classic' to let the\n\
+operating system decide, or 'fifo' to queue the waiting threads by\n\
+priority, then by arrival order; see _setthreadpriority()."
+);
+
+static PyObject *
+sys_getgilmode(PyObject *self, PyObject *args)
+{
+    return PyUnicode_FromString(_PyEval_GetGILFifo() ? "fifo" : "classic");
+}
+
+PyDoc_STRVAR(getgilmode_doc,
+"_getgilmode() -> current GIL mode; see _setgilmode()."
+);
+
+static PyObject *
+sys_setthreadpriority(PyObject *self, PyObject *args)
+{
+    int priority;
+    if (!PyArg_ParseTuple(args, "i:_setthreadpriority", &priority))
+        return NULL;
+    PyThreadState_GET()->gil_priority = priority;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(setthreadpriority_doc,
+"_setthreadpriority(priority)\n\
+\n\
+Set the GIL priority hint of the current thread, 0 by default.  In the\n\
+'fifo' GIL mode, threads with a higher priority get the GIL first, and\n\
+take it from a lower priority thread without waiting for the switch\n\
+interval.  Give a positive priority to threads which mostly wait for I/O."
+);
+
+static PyObject *
+sys_getthreadpriority(PyObject *self, PyObject *args)
+{
+    return PyLong_FromLong(PyThreadState_GET()->gil_priority);
+}
+
+PyDoc_STRVAR(getthreadpriority_doc,
+"_getthreadpriority() -> GIL priority hint of the current thread."
+);
+
+static PyObject *
+sys_getgilstats(PyObject *self, PyObject *args)
+{
+    return _PyThread_GILStats(PyThreadState_GET()->interp);
+}
+
+PyDoc_STRVAR(getgilstats_doc,
+"_getgilstats() -> dict\n\
+\n\
+Return how long the threads of the interpreter waited for the GIL, as a\n\
+dictionary mapping thread identifiers to (count, total, max, histogram)\n\
+tuples.  count is the number of times the thread took the GIL, total and\n\
+max are in seconds.  Item i > 0 of histogram is the number of waits of\n\
+2**(i-1) to 2**i microseconds, item 0 the number of shorter waits; the\n\
+last item also counts all longer waits."
+);
+
 #endif /* WITH_THREAD */
 
 #ifdef WITH_TSC
@@ -1036,6 +1118,32 @@ Return the number of memory blocks currently allocated, regardless of their\n\
 size."
 );
 
+static PyObject *
+sys_getglobalcachestats(PyObject *self, PyObject *arg)
+{
+    PyCodeObject *co;
+
+    if (!PyCode_Check(arg)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not %.100s",
+                     Py_TYPE(arg)->tp_name);
+        return NULL;
+    }
+    co = (PyCodeObject *)arg;
+    if (co->co_globalcache == NULL)
+        return Py_BuildValue("(nn)", (Py_ssize_t)0, (Py_ssize_t)0);
+    return Py_BuildValue("(nn)", co->co_globalcache->hits,
+                         co->co_globalcache->misses);
+}
+
+PyDoc_STRVAR(getglobalcachestats_doc,
+"_getglobalcachestats(code) -> (hits, misses)\n\
+\n\
+Return the number of LOAD_GLOBAL executions of the given code object that\n\
+were served from its inline cache, and the number that had to look the\n\
+name up in the globals and builtins dictionaries."
+);
+
 #ifdef COUNT_ALLOCS
 static PyObject *
 sys_getcounts(PyObject *self)
@@ -1160,6 +1268,18 @@ In Py_DEBUG mode, also perform some expensive internal consistency\n\
 checks.\n\
 ");
 
+static PyObject *
+sys_release_memory(PyObject *self, PyObject *args)
+{
+    return PyLong_FromSize_t(_PyObject_ReleaseMemory());
+}
+PyDoc_STRVAR(release_memory_doc,
+"_release_memory() -> int\n\
+\n\
+Give the memory of pymalloc's unused pools back to the operating\n\
+system, and return the number of bytes released.\n\
+");
+
 #ifdef Py_TRACE_REFS
 /* Defined in objects.c because it uses static globals if that file */
 extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
@@ -1221,6 +1341,8 @@ static PyMethodDef sys_methods[] = {
 #ifdef DYNAMIC_EXECUTION_PROFILE
     {"getdxp",          _Py_GetDXProfile, METH_VARARGS},
 #endif
+    {"_getglobalcachestats", sys_getglobalcachestats, METH_O,
+     getglobalcachestats_doc},
     {"getfilesystemencoding", (PyCFunction)sys_getfilesystemencoding,
      METH_NOARGS, getfilesystemencoding_doc},
 #ifdef Py_TRACE_REFS
@@ -1253,6 +1375,13 @@ static PyMethodDef sys_methods[] = {
      setswitchinterval_doc},
     {"getswitchinterval",       sys_getswitchinterval, METH_NOARGS,
      getswitchinterval_doc},
+    {"_setgilmode",     sys_setgilmode, METH_VARARGS, setgilmode_doc},
+    {"_getgilmode",     sys_getgilmode, METH_NOARGS, getgilmode_doc},
+    {"_setthreadpriority", sys_setthreadpriority, METH_VARARGS,
+     setthreadpriority_doc},
+    {"_getthreadpriority", sys_getthreadpriority, METH_NOARGS,
+     getthreadpriority_doc},
+    {"_getgilstats",    sys_getgilstats, METH_NOARGS, getgilstats_doc},
 #endif
 #ifdef HAVE_DLOPEN
     {"setdlopenflags", sys_setdlopenflags, METH_VARARGS,
@@ -1270,6 +1399,8 @@ static PyMethodDef sys_methods[] = {
     {"call_tracing", sys_call_tracing, METH_VARARGS, call_tracing_doc},
     {"_debugmallocstats", sys_debugmallocstats, METH_NOARGS,
      debugmallocstats_doc},
+    {"_release_memory", sys_release_memory, METH_NOARGS,
+     release_memory_doc},
     {"set_coroutine_wrapper", sys_set_coroutine_wrapper, METH_O,
      set_coroutine_wrapper_doc},
     {"get_coroutine_wrapper", sys_get_coroutine_wrapper, METH_NOARGS,
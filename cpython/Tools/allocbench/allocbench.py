@@ -0,0 +1,133 @@
+"""Compare pymalloc configurations on allocation-heavy workloads.
+
+Every workload runs in a fresh interpreter whose environment selects a
+pymalloc configuration (PYTHONMALLOCARENASIZE, PYTHONMALLOCALIGNMENT,
+PYTHONMALLOCTHRESHOLD, PYTHONMALLOCHUGEPAGES).  The best time out of
+several runs and the peak resident set size of the child are reported.
+
+"""
+import json
+import os
+import subprocess
+import sys
+
+
+# name -> environment variables
+CONFIGS = [
+    ('default', {}),
+    ('arena-1M', {'PYTHONMALLOCARENASIZE': '1024'}),
+    ('arena-4M', {'PYTHONMALLOCARENASIZE': '4096'}),
+    ('align-16', {'PYTHONMALLOCALIGNMENT': '16'}),
+    ('threshold-256', {'PYTHONMALLOCTHRESHOLD': '256'}),
+    ('hugepages', {'PYTHONMALLOCHUGEPAGES': '1'}),
+    ('hugepages-4M', {'PYTHONMALLOCHUGEPAGES': '1',
+                      'PYTHONMALLOCARENASIZE': '4096'}),
+]
+
+# name -> code run by the child; it must define a run() function
+WORKLOADS = {
+    'tuples': '''
+def run():
+    # Many small objects alive at once
+    data = [(i, str(i)) for i in range(300000)]
+    del data
+''',
+    'instances': '''
+class Point:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+def run():
+    # Instances with split-table dicts, walked randomly
+    points = [Point(i, i * 2) for i in range(150000)]
+    total = 0
+    for i in range(0, len(points), 7):
+        total += points[(i * 7919) % len(points)].y
+    del points
+''',
+    'churn': '''
+def build(depth):
+    if depth == 0:
+        return None
+    return [build(depth - 1), build(depth - 1), depth]
+
+def run():
+    # Trees built and thrown away, leaving the heap fragmented
+    keep = []
+    for i in range(20):
+        tree = build(13)
+        if i % 4 == 0:
+            keep.append(tree)
+    del keep
+''',
+    'dicts': '''
+def run():
+    # Small and medium dicts, near the small request threshold
+    rows = [{'id': i, 'name': 'row%d' % i, 'tags': (i, i + 1)}
+            for i in range(100000)]
+    index = {row['id']: row for row in rows}
+    del rows, index
+''',
+}
+
+CHILD = r'''
+import gc, json, resource, sys, time
+%s
+best = None
+for i in range(%d):
+    t0 = time.perf_counter()
+    run()
+    dt = time.perf_counter() - t0
+    best = dt if best is None else min(best, dt)
+    gc.collect()
+maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+print(json.dumps({'time': best, 'maxrss': maxrss}))
+'''
+
+
+def run_child(python, workload, env_vars, repeat):
+    env = dict(os.environ)
+    for var in ('PYTHONMALLOCARENASIZE', 'PYTHONMALLOCALIGNMENT',
+                'PYTHONMALLOCTHRESHOLD', 'PYTHONMALLOCHUGEPAGES'):
+        env.pop(var, None)
+    env.update(env_vars)
+    code = CHILD % (WORKLOADS[workload], repeat)
+    out = subprocess.check_output([python, '-c', code], env=env)
+    return json.loads(out.decode('ascii').splitlines()[-1])
+
+
+def main(options):
+    configs = [(name, env) for name, env in CONFIGS
+               if not options.configs or name in options.configs]
+    workloads = options.workloads or sorted(WORKLOADS)
+    baseline = {}
+    print("{:<12} {:<14} {:>10} {:>8} {:>12}".format(
+        'workload', 'config', 'time (s)', 'rel', 'maxrss (kB)'))
+    for workload in workloads:
+        for name, env in configs:
+            result = run_child(options.python, workload, env,
+                               options.repeat)
+            baseline.setdefault(workload, result['time'])
+            print("{:<12} {:<14} {:>10.4f} {:>7.1%} {:>12}".format(
+                workload, name, result['time'],
+                result['time'] / baseline[workload], result['maxrss']))
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    import argparse
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-p', '--python', default=sys.executable,
+                        help='interpreter to benchmark (default: this one)')
+    parser.add_argument('-n', '--repeat', type=int, default=5,
+                        help='runs of each workload per process')
+    parser.add_argument('-c', '--config', dest='configs', action='append',
+                        choices=[name for name, _ in CONFIGS],
+                        help='configuration to run (may be repeated); '
+                             'the first one is the reference')
+    parser.add_argument('-w', '--workload', dest='workloads',
+                        action='append', choices=sorted(WORKLOADS),
+                        help='workload to run (may be repeated)')
+    main(parser.parse_args())
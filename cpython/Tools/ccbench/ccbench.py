@@ -379,6 +379,30 @@ def run_latency_test(func, args, nthreads):
 
     return results
 
+def gil_wait_histogram():
+    """Return the GIL wait time histogram of the current thread, or None
+    if the interpreter doesn't record it (see sys._getgilstats())."""
+    try:
+        stats = sys._getgilstats()
+    except AttributeError:
+        return None
+    return stats[threading.current_thread().ident][3]
+
+def histogram_percentiles(hist, percents):
+    # Bucket i counts waits of less than 2**i microseconds; return upper
+    # bounds in milliseconds.
+    total = sum(hist)
+    bounds = []
+    for p in percents:
+        threshold = total * p / 100
+        count = 0
+        for i, n in enumerate(hist):
+            count += n
+            if count >= threshold:
+                break
+        bounds.append(2 ** i / 1000)
+    return bounds
+
 def run_latency_tests(max_threads):
     for task in latency_tasks:
         print("Background CPU task:", task.__doc__)
@@ -386,7 +410,9 @@ def run_latency_tests(max_threads):
         func, args = task()
         nthreads = 0
         while nthreads <= max_threads:
+            hist_before = gil_wait_histogram()
             results = run_latency_test(func, args, nthreads)
+            hist_after = gil_wait_histogram()
             n = len(results)
             # We print out milliseconds
             lats = [1000 * (t2 - t1) for (t1, t2) in results]
@@ -394,6 +420,12 @@ def run_latency_tests(max_threads):
             avg = sum(lats) / n
             dev = (sum((x - avg) ** 2 for x in lats) / n) ** 0.5
             print("CPU threads=%d: %d ms. (std dev: %d ms.)" % (nthreads, avg, dev), end="")
+            if hist_before is not None:
+                # GIL wait times of the thread receiving the pings
+                hist = [b - a for a, b in zip(hist_before, hist_after)]
+                print(" GIL wait p50/p90/p99: <= %g/%g/%g ms."
+                      % tuple(histogram_percentiles(hist, (50, 90, 99))),
+                      end="")
             print()
             #print("    [... from %d samples]" % n)
             nthreads += 1
@@ -545,6 +577,13 @@ def main():
     parser.add_option("-I", "--switch-interval",
                       action="store", type="float", dest="switch_interval", default=None,
                       help="sys.setswitchinterval() value")
+    parser.add_option("-g", "--gil-mode",
+                      action="store", dest="gil_mode", default=None,
+                      help="sys._setgilmode() value ('classic' or 'fifo')")
+    parser.add_option("-p", "--io-priority",
+                      action="store", type="int", dest="io_priority", default=None,
+                      help="sys._setthreadpriority() value for the thread "
+                           "doing I/O in latency and bandwidth tests")
     parser.add_option("-n", "--num-threads",
                       action="store", type="int", dest="nthreads", default=4,
                       help="max number of threads in tests")
@@ -577,6 +616,12 @@ def main():
         sys.setcheckinterval(options.check_interval)
     if options.switch_interval:
         sys.setswitchinterval(options.switch_interval)
+    if options.gil_mode:
+        sys._setgilmode(options.gil_mode)
+    if options.io_priority is not None:
+        # The main thread does the I/O, the CPU-bound tasks run in threads
+        # it starts later on, with the default priority.
+        sys._setthreadpriority(options.io_priority)
 
     print("== %s %s (%s) ==" % (
         platform.python_implementation(),
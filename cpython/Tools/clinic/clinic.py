@@ -703,6 +703,13 @@ class CLanguage(Language):
             {c_basename}({self_type}{self_name}, PyObject *args)
             """)
 
+        # METH_FASTCALL: positional arguments come straight from the
+        # caller's stack, no tuple is built
+        parser_prototype_fastcall = normalize_snippet("""
+            static PyObject *
+            {c_basename}({self_type}{self_name}, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)
+            """)
+
         # parser_body_fields remembers the fields passed in to the
         # previous call to parser_body. this is used for an awful hack.
         parser_body_fields = ()
@@ -804,9 +811,36 @@ class CLanguage(Language):
 
             parser_definition = parser_body(parser_prototype, '    {option_group_parsing}')
 
-        elif positional and all_boring_objects:
+        elif positional and all_boring_objects and not new_or_init:
             # positional-only, but no option groups,
             # and nothing but normal objects:
+            # _PyArg_UnpackStack!
+
+            flags = "METH_FASTCALL"
+            parser_prototype = parser_prototype_fastcall
+
+            parser_definition = parser_body(parser_prototype, normalize_snippet("""
+                if (!_PyArg_UnpackStack(args, nargs, "{name}",
+                    {unpack_min}, {unpack_max},
+                    {parse_arguments}))
+                    goto exit;
+                """, indent=4))
+
+        elif positional and not new_or_init:
+            # positional-only, but no option groups
+            # we only need one call to _PyArg_ParseStack
+
+            flags = "METH_FASTCALL"
+            parser_prototype = parser_prototype_fastcall
+
+            parser_definition = parser_body(parser_prototype, normalize_snippet("""
+                if (!_PyArg_ParseStack(args, nargs, "{format_units}:{name}",
+                    {parse_arguments}))
+                    goto exit;
+                """, indent=4))
+
+        elif positional and all_boring_objects:
+            # __new__ and __init__ always get a tuple:
             # PyArg_UnpackTuple!
 
             flags = "METH_VARARGS"
@@ -36,7 +36,7 @@ class FakeConvertersDict:
         return self.used_converters.setdefault(name, FakeConverterFactory(name))
 
 clinic.Clinic.presets_text = ''
-c = clinic.Clinic(language='C')
+c = clinic.Clinic(language='C', filename='file')
 
 class FakeClinic:
     def __init__(self):
@@ -44,6 +44,7 @@ class FakeClinic:
         self.legacy_converters = FakeConvertersDict()
         self.language = clinic.CLanguage(None)
         self.filename = None
+        self.destination_buffers = {}
         self.block_parser = clinic.BlockParser('', self.language)
         self.modules = collections.OrderedDict()
         self.classes = collections.OrderedDict()
@@ -94,7 +95,7 @@ class ClinicWholeFileTest(TestCase):
         # so it woudl spit out an end line for you.
         # and since you really already had one,
         # the last line of the block got corrupted.
-        c = clinic.Clinic(clinic.CLanguage(None))
+        c = clinic.Clinic(clinic.CLanguage(None), filename='file')
         raw = "/*[clinic]\nfoo\n[clinic]*/"
         cooked = c.parse(raw).splitlines()
         end_line = cooked[2].rstrip()
@@ -253,7 +254,7 @@ xyz
 
     def _test_clinic(self, input, output):
         language = clinic.CLanguage(None)
-        c = clinic.Clinic(language)
+        c = clinic.Clinic(language, filename='file')
         c.parsers['inert'] = InertParser(c)
         c.parsers['copy'] = CopyParser(c)
         computed = c.parse(input)
@@ -281,6 +282,96 @@ xyz
 """)
 
 
+class ClinicOutputTest(TestCase):
+    def generate(self, input):
+        # "dump file" puts the code meant for the clinic/*.h file in the
+        # block, so that no file is written
+        c = clinic.Clinic(clinic.CLanguage(None), filename='file')
+        input = ("/*[clinic input]\nmodule m\n" + input +
+                 "[clinic start generated code]*/\n"
+                 "/*[clinic input]\ndump file\n[clinic start generated code]*/\n")
+        return c.parse(input)
+
+    def test_fastcall_parse_stack(self):
+        output = self.generate("""
+m.f
+    a: object
+    b: int = 0
+    /
+""")
+        self.assertIn('{"f", (PyCFunction)m_f, METH_FASTCALL, m_f__doc__},', output)
+        self.assertIn('\nm_f(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)\n', output)
+        self.assertIn("""
+    if (!_PyArg_ParseStack(args, nargs, "O|i:f",
+        &a, &b))
+        goto exit;
+""", output)
+
+    def test_fastcall_unpack_stack(self):
+        output = self.generate("""
+m.f
+    a: object
+    b: object = None
+    /
+""")
+        self.assertIn('{"f", (PyCFunction)m_f, METH_FASTCALL, m_f__doc__},', output)
+        self.assertIn('\nm_f(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)\n', output)
+        self.assertIn("""
+    if (!_PyArg_UnpackStack(args, nargs, "f",
+        1, 2,
+        &a, &b))
+        goto exit;
+""", output)
+
+    def test_fastcall_classmethod(self):
+        output = self.generate("""
+class m.C "PyObject *" "&PyType_Type"
+@classmethod
+m.C.f
+    a: object
+    b: object
+    /
+""")
+        self.assertIn('{"f", (PyCFunction)m_C_f, METH_FASTCALL|METH_CLASS, m_C_f__doc__},', output)
+        self.assertIn('\nm_C_f(PyTypeObject *type, PyObject **args, Py_ssize_t nargs, PyObject *kwargs)\n', output)
+
+    def test_keywords_use_tuple(self):
+        output = self.generate("""
+m.f
+    a: object
+    b: int = 0
+""")
+        self.assertIn('{"f", (PyCFunction)m_f, METH_VARARGS|METH_KEYWORDS, m_f__doc__},', output)
+        self.assertIn('PyArg_ParseTupleAndKeywords(args, kwargs, "O|i:f", _keywords,', output)
+        self.assertNotIn('nargs', output)
+
+    def test_option_groups_use_tuple(self):
+        output = self.generate("""
+m.f
+    a: object
+    [
+    b: int
+    ]
+    /
+""")
+        self.assertIn('{"f", (PyCFunction)m_f, METH_VARARGS, m_f__doc__},', output)
+        self.assertIn('switch (PyTuple_GET_SIZE(args)) {', output)
+        self.assertNotIn('nargs', output)
+
+    def test_new_uses_tuple(self):
+        output = self.generate("""
+class m.C "PyObject *" "&PyType_Type"
+@classmethod
+m.C.__new__
+    a: object
+    b: object = None
+    /
+""")
+        self.assertIn('\nm_C(PyTypeObject *type, PyObject *args, PyObject *kwargs)\n', output)
+        self.assertIn('PyArg_UnpackTuple(args, "C",', output)
+        self.assertNotIn('nargs', output)
+
+
 class ClinicParserTest(TestCase):
     def test_trivial(self):
         parser = DSLParser(FakeClinic())
@@ -0,0 +1,140 @@
+#! /usr/bin/env python3
+
+"""Write a startup snapshot for the running interpreter.
+
+usage: snapshot [options...] [module]...
+
+A snapshot holds the compiled code of pure Python modules.  When the
+PYTHONSNAPSHOT environment variable names a snapshot, the interpreter
+loads those modules from it instead of searching sys.path for them and
+reading their bytecode files one by one.
+
+Options:
+-o file:      The snapshot file to write; default 'python.snapshot'.
+
+-c command:   Also store the modules imported by an interpreter that runs
+              the command, e.g. -c "import argparse, json".  More than
+              one -c option may be given.
+
+-x module:    Exclude the specified module.
+
+-q:           Don't list the stored modules.
+
+-h:           Print this help message.
+
+Arguments:
+
+module ...:   Additional modules, by name, to store.
+
+NOTES:
+
+The modules imported by the interpreter at startup are always stored.
+
+The snapshot can only be used by the interpreter that wrote it.  A module
+is only loaded from the snapshot when its file is the one found on
+sys.path and has the modification time and size it had when the snapshot
+was written; other modules are imported as usual, so write the snapshot
+again when they change.
+"""
+
+import getopt
+import importlib.machinery
+import importlib.util
+import marshal
+import os
+import subprocess
+import sys
+
+
+# Appended to the -c commands to get the names of the modules they import.
+list_modules = "\nimport sys; print('\\n'.join(sys.modules))"
+
+
+def imported_modules(command='pass'):
+    """Return the names of the modules imported by an interpreter running
+    the command."""
+    env = dict(os.environ)
+    env.pop('PYTHONSNAPSHOT', None)
+    output = subprocess.check_output(
+        [sys.executable, '-c', command + list_modules],
+        env=env, universal_newlines=True)
+    return output.split()
+
+
+def module_code(name):
+    """Return the file, its modification time and size, and the marshalled
+    code of the named module, or None if it is not a source or bytecode
+    module."""
+    try:
+        spec = importlib.util.find_spec(name)
+    except (ImportError, ValueError):
+        return None
+    # Aliases such as os.path are left to the module that sets them.
+    if spec is None or spec.name != name:
+        return None
+    if not isinstance(spec.loader, (importlib.machinery.SourceFileLoader,
+                                    importlib.machinery.SourcelessFileLoader)):
+        return None
+    # The path is kept as found on sys.path: it is compared with the path
+    # the interpreter using the snapshot finds.
+    st = os.stat(spec.origin)
+    code = spec.loader.get_code(name)
+    return spec.origin, int(st.st_mtime), st.st_size, marshal.dumps(code)
+
+
+def write_snapshot(filename, names, exclude=(), quiet=False):
+    """Write the snapshot of the named modules to filename."""
+    modules = {}
+    for name in sorted(set(names) - set(exclude)):
+        entry = module_code(name)
+        if entry is None:
+            continue
+        modules[name] = entry
+        if not quiet:
+            print("storing", name, "from", entry[0])
+    with open(filename, 'wb') as file:
+        file.write(importlib.util.MAGIC_NUMBER)
+        marshal.dump(modules, file)
+    return modules
+
+
+def main():
+    filename = 'python.snapshot'
+    commands = ['pass']
+    exclude = []
+    quiet = False
+
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], 'o:c:x:qh')
+    except getopt.error as msg:
+        usage('getopt error: ' + str(msg))
+
+    for o, a in opts:
+        if o == '-h':
+            print(__doc__)
+            return
+        if o == '-o':
+            filename = a
+        if o == '-c':
+            commands.append(a)
+        if o == '-x':
+            exclude.append(a)
+        if o == '-q':
+            quiet = True
+
+    names = set(args)
+    for command in commands:
+        names.update(imported_modules(command))
+    modules = write_snapshot(filename, names, exclude, quiet)
+    print("wrote", len(modules), "modules to", filename)
+
+
+def usage(msg):
+    sys.stdout = sys.stderr
+    print("Error:", msg)
+    print("Use ``%s -h'' for help" % sys.argv[0])
+    sys.exit(2)
+
+
+if __name__ == '__main__':
+    main()
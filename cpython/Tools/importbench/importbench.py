@@ -5,7 +5,6 @@ thus has no external changes made to import-related attributes in sys.
 
 """
 from test.test_importlib import util
-from test.test_importlib.source import util as source_util
 import decimal
 import imp
 import importlib
@@ -13,6 +12,7 @@ import importlib.machinery
 import json
 import os
 import py_compile
+import subprocess
 import sys
 import tabnanny
 import timeit
@@ -65,7 +65,7 @@ def source_wo_bytecode(seconds, repeat):
     try:
         name = '__importlib_test_benchmark__'
         # Clears out sys.modules and puts an entry at the front of sys.path.
-        with source_util.create_modules(name) as mapping:
+        with util.create_modules(name) as mapping:
             assert not os.path.exists(imp.cache_from_source(mapping[name]))
             sys.meta_path.append(importlib.machinery.PathFinder)
             loader = (importlib.machinery.SourceFileLoader,
@@ -102,7 +102,7 @@ def source_writing_bytecode(seconds, repeat):
     """Source writing bytecode: small"""
     assert not sys.dont_write_bytecode
     name = '__importlib_test_benchmark__'
-    with source_util.create_modules(name) as mapping:
+    with util.create_modules(name) as mapping:
         sys.meta_path.append(importlib.machinery.PathFinder)
         loader = (importlib.machinery.SourceFileLoader,
                   importlib.machinery.SOURCE_SUFFIXES, True)
@@ -136,7 +136,7 @@ decimal_writing_bytecode = _writing_bytecode(decimal)
 def source_using_bytecode(seconds, repeat):
     """Source w/ bytecode: small"""
     name = '__importlib_test_benchmark__'
-    with source_util.create_modules(name) as mapping:
+    with util.create_modules(name) as mapping:
         sys.meta_path.append(importlib.machinery.PathFinder)
         loader = (importlib.machinery.SourceFileLoader,
                 importlib.machinery.SOURCE_SUFFIXES, True)
@@ -163,6 +163,32 @@ tabnanny_using_bytecode = _using_bytecode(tabnanny)
 decimal_using_bytecode = _using_bytecode(decimal)
 
 
+# Imported by the startup benchmarks; only argparse is actually used.
+_startup_imports = 'argparse, decimal, email.message, json, tabnanny'
+
+def _startup(*options):
+    description = ' '.join(options) or 'eager imports'
+    args = [sys.executable, *options, '-c',
+            'import {}; argparse.ArgumentParser'.format(_startup_imports)]
+    def startup_benchmark(seconds, repeat):
+        """Startup: {}"""
+        for x in range(repeat):
+            total_time = 0
+            count = 0
+            while total_time < seconds:
+                total_time -= timeit.default_timer()
+                subprocess.check_call(args)
+                total_time += timeit.default_timer()
+                count += 1
+            yield count // seconds
+
+    startup_benchmark.__doc__ = startup_benchmark.__doc__.format(description)
+    return startup_benchmark
+
+startup_eager = _startup()
+startup_lazy = _startup('-X', 'lazy_import')
+
+
 def main(import_, options):
     if options.source_file:
         with options.source_file:
@@ -177,6 +203,7 @@ def main(import_, options):
                   tabnanny_wo_bytecode, tabnanny_using_bytecode,
                   decimal_writing_bytecode,
                   decimal_wo_bytecode, decimal_using_bytecode,
+                  startup_eager, startup_lazy,
                 )
     if options.benchmark:
         for b in benchmarks:
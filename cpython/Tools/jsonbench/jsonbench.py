@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Compare json.loads() with the incremental decoder on a large document.
+
+The document is a single line holding an array of records, written to a
+temporary file.  Each method runs in its own interpreter, which reports the
+throughput in MB of JSON per second and its peak resident memory:
+
+  loads     json.loads() of the decoded file
+  iterload  json.iterload() of the file, returning the whole array
+  items     json.iterload(items=True), returning the records one by one
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+import time
+from optparse import OptionParser
+
+METHODS = ['loads', 'iterload', 'items']
+
+RECORD = {
+    "id": 0,
+    "name": "user",
+    "email": "user@example.com",
+    "active": True,
+    "score": 0.0,
+    "tags": ["alpha", "beta", "gamma"],
+    "address": {"street": "1 Rue de l'Église", "city": "Zürich",
+                "zip": "8001"},
+    "bio": "Logs, metrics and traces are shipped to the collector — "
+           "every minute.",
+}
+
+
+def write_corpus(path, size):
+    import json
+    with open(path, 'w', encoding='utf-8') as file:
+        file.write('[')
+        written = 1
+        i = 0
+        while written < size:
+            record = dict(RECORD, id=i, name="user%d" % i, score=i / 7)
+            text = json.dumps(record, ensure_ascii=False)
+            if i:
+                text = ', ' + text
+            file.write(text)
+            written += len(text.encode('utf-8'))
+            i += 1
+        file.write(']')
+    return i
+
+
+def run(method, path):
+    import json
+    import resource
+    start = time.perf_counter()
+    if method == 'loads':
+        with open(path, encoding='utf-8') as file:
+            count = len(json.loads(file.read()))
+    elif method == 'iterload':
+        with open(path, 'rb') as file:
+            count = sum(len(value) for value in json.iterload(file))
+    else:
+        with open(path, 'rb') as file:
+            count = sum(1 for value in json.iterload(file, items=True))
+    elapsed = time.perf_counter() - start
+    maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    print(count, elapsed, maxrss)
+
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options] [method ...]",
+                          description=__doc__)
+    parser.add_option("-s", "--size", type="int", default=64,
+                      help="size of the document in MB (default %default)")
+    parser.add_option("-n", "--repeat", type="int", default=3,
+                      help="runs of each method, the best one is kept "
+                           "(default %default)")
+    parser.add_option("--run", metavar="METHOD:FILE",
+                      help="run one method in this process (internal)")
+    options, args = parser.parse_args()
+    if options.run:
+        method, path = options.run.split(':', 1)
+        run(method, path)
+        return
+    names = args or METHODS
+    for name in names:
+        if name not in METHODS:
+            parser.error("unknown method %r, choose from %s"
+                         % (name, ", ".join(METHODS)))
+
+    fd, path = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    try:
+        count = write_corpus(path, options.size * 1000 * 1000)
+        nbytes = os.path.getsize(path)
+        print("Python %s" % sys.version.split()[0])
+        print("%d records, %.1f MB" % (count, nbytes / 1e6))
+        print("%-10s %10s %14s" % ("method", "MB/s", "peak RSS MB"))
+        for name in names:
+            best = None
+            for i in range(options.repeat):
+                output = subprocess.check_output(
+                    [sys.executable, __file__, '--run', name + ':' + path],
+                    universal_newlines=True)
+                n, elapsed, maxrss = output.split()
+                assert int(n) == count, (name, n, count)
+                result = (float(elapsed), int(maxrss))
+                best = result if best is None else min(best, result)
+            elapsed, maxrss = best
+            print("%-10s %10.1f %14.1f" % (name, nbytes / elapsed / 1e6,
+                                           maxrss / 1024))
+    finally:
+        os.unlink(path)
+
+
+if __name__ == "__main__":
+    main()
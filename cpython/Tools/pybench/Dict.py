@@ -502,3 +502,156 @@ class SimpleDictManipulation(Test):
 
         for i in range(self.rounds):
             pass
+
+class DictIteration(Test):
+
+    version = 2.0
+    operations = 3*(6 + 6)
+    rounds = 20000
+
+    def test(self):
+
+        d1 = dict.fromkeys(range(10))
+        d2 = dict.fromkeys([str(i) for i in range(10)], 1)
+        for k in list(d1)[::2]:
+            del d1[k]
+            d1[k] = None
+
+        for i in range(self.rounds):
+
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+            for k in d1: pass
+            for k in d2: pass
+            for v in d1.values(): pass
+            for v in d2.values(): pass
+            for k, v in d1.items(): pass
+            for k, v in d2.items(): pass
+
+    def calibrate(self):
+
+        d1 = dict.fromkeys(range(10))
+        d2 = dict.fromkeys([str(i) for i in range(10)], 1)
+        for k in list(d1)[::2]:
+            del d1[k]
+            d1[k] = None
+
+        for i in range(self.rounds):
+            pass
+
+# Lookups in dicts with many string keys, such as those built from JSON
+# documents: hits, misses, and a delete/reinsert heavy mix.
+
+_string_keys = ['key%d' % i for i in range(200)]
+_missing_keys = ['nokey%d' % i for i in range(200)]
+
+class DictStringKeyHits(Test):
+
+    version = 2.0
+    operations = 200 * 4
+    rounds = 500
+
+    def test(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _string_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                d[k]
+                k in d
+                d.get(k)
+                d[k]
+
+    def calibrate(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _string_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                pass
+
+class DictStringKeyMisses(Test):
+
+    version = 2.0
+    operations = 200 * 4
+    rounds = 500
+
+    def test(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _missing_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                k in d
+                d.get(k)
+                k in d
+                d.get(k)
+
+    def calibrate(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _missing_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                pass
+
+class DictStringKeyChurn(Test):
+
+    version = 2.0
+    operations = 200 * 4
+    rounds = 500
+
+    def test(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _string_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                del d[k]
+                k in d
+                d[k] = i
+                d[k]
+
+    def calibrate(self):
+
+        d = dict.fromkeys(_string_keys, 0)
+        keys = _string_keys
+
+        for i in range(self.rounds):
+            for k in keys:
+                pass
@@ -0,0 +1,181 @@
+from pybench import Test
+
+# Small int and float arithmetic as found in tight numeric loops (counters,
+# index arithmetic, filters).  These exercise the int/float fast paths of
+# the BINARY_*, INPLACE_* and COMPARE_OP opcodes.
+
+class SmallIntegerLoop(Test):
+
+    version = 2.0
+    operations = 5 * (4 + 4 + 3 + 3)
+    rounds = 100000
+
+    def test(self):
+
+        for i in range(self.rounds):
+
+            n = 0
+            k = 7
+            j = 3
+
+            n = n + 1
+            n += k
+            n = n - j
+            n -= 1
+            j = k * 3
+            j = j * 2
+            j = j - n
+            j = n * k
+            n < k
+            j > n
+            k == j
+            if n < k: pass
+            if j >= n: pass
+            if k <= j: pass
+
+            n = n + 1
+            n += k
+            n = n - j
+            n -= 1
+            j = k * 3
+            j = j * 2
+            j = j - n
+            j = n * k
+            n < k
+            j > n
+            k == j
+            if n < k: pass
+            if j >= n: pass
+            if k <= j: pass
+
+            n = n + 1
+            n += k
+            n = n - j
+            n -= 1
+            j = k * 3
+            j = j * 2
+            j = j - n
+            j = n * k
+            n < k
+            j > n
+            k == j
+            if n < k: pass
+            if j >= n: pass
+            if k <= j: pass
+
+            n = n + 1
+            n += k
+            n = n - j
+            n -= 1
+            j = k * 3
+            j = j * 2
+            j = j - n
+            j = n * k
+            n < k
+            j > n
+            k == j
+            if n < k: pass
+            if j >= n: pass
+            if k <= j: pass
+
+            n = n + 1
+            n += k
+            n = n - j
+            n -= 1
+            j = k * 3
+            j = j * 2
+            j = j - n
+            j = n * k
+            n < k
+            j > n
+            k == j
+            if n < k: pass
+            if j >= n: pass
+            if k <= j: pass
+
+    def calibrate(self):
+
+        for i in range(self.rounds):
+            pass
+
+class FloatFilterLoop(Test):
+
+    version = 2.0
+    operations = 5 * (6 + 4 + 3)
+    rounds = 100000
+
+    def test(self):
+
+        c0 = 0.25
+        c1 = 0.5
+        c2 = 0.25
+        lo = -1.0
+        hi = 1.0
+
+        for i in range(self.rounds):
+
+            x0 = 0.125
+            x1 = -0.75
+            x2 = 0.5
+            acc = 0.0
+
+            y = c0 * x0 + c1 * x1 + c2 * x2
+            acc += y
+            acc -= x0
+            x2 = x1 - y
+            x1 = x0 * c1
+            x0 = y
+            if y > hi: y = hi
+            if y < lo: y = lo
+            acc < hi
+
+            y = c0 * x0 + c1 * x1 + c2 * x2
+            acc += y
+            acc -= x0
+            x2 = x1 - y
+            x1 = x0 * c1
+            x0 = y
+            if y > hi: y = hi
+            if y < lo: y = lo
+            acc < hi
+
+            y = c0 * x0 + c1 * x1 + c2 * x2
+            acc += y
+            acc -= x0
+            x2 = x1 - y
+            x1 = x0 * c1
+            x0 = y
+            if y > hi: y = hi
+            if y < lo: y = lo
+            acc < hi
+
+            y = c0 * x0 + c1 * x1 + c2 * x2
+            acc += y
+            acc -= x0
+            x2 = x1 - y
+            x1 = x0 * c1
+            x0 = y
+            if y > hi: y = hi
+            if y < lo: y = lo
+            acc < hi
+
+            y = c0 * x0 + c1 * x1 + c2 * x2
+            acc += y
+            acc -= x0
+            x2 = x1 - y
+            x1 = x0 * c1
+            x0 = y
+            if y > hi: y = hi
+            if y < lo: y = lo
+            acc < hi
+
+    def calibrate(self):
+
+        c0 = 0.25
+        c1 = 0.5
+        c2 = 0.25
+        lo = -1.0
+        hi = 1.0
+
+        for i in range(self.rounds):
+            pass
@@ -18,6 +18,10 @@ $ PYTHONPATH=$PYTHONPATH:<python_srcdir>/Tools/scripts \
 > from analyze_dxp import *
 > s = render_common_pairs()
 > open('/tmp/some_file', 'w').write(s)
+
+render_fusion_candidates() ranks the pairs by their share of all executed
+instructions and shows which of them the peephole optimizer already turns
+into superinstructions.
 """
 
 import copy
@@ -127,3 +131,55 @@ def render_common_pairs(profile=None):
         for _, ops, count in common_pairs(profile):
             yield "%s: %s\n" % (count, ops)
     return ''.join(seq())
+
+
+def _unfuse(op):
+    """Maps a superinstruction back to the first opcode of its pair."""
+    name = opcode.opname[op]
+    if '__' in name:
+        return opcode.opmap[name.split('__')[0]]
+    return op
+
+
+def fusion_candidates(profile):
+    """Returns the most common opcode pairs with their share of all
+    executed instructions, in order of descending frequency.
+
+    Superinstructions are counted as the pair they stand for, so that a
+    profile taken with fusion enabled ranks the same as one without.
+    The result is a list of tuples of the form
+      ((1st opname, 2nd opname), fraction of all instructions, is fused)
+
+    """
+    total = sum(count for _, _, count in common_instructions(profile))
+    if not total:
+        return []
+    counts = {}
+    for (op1, op2), _, count in common_pairs(profile):
+        pair = (_unfuse(op1), _unfuse(op2))
+        counts[pair] = counts.get(pair, 0) + count
+    fusable = {(_unfuse(op), opcode.opmap[opcode.opname[op].split('__')[1]])
+               for op in opcode.opmap.values()
+               if '__' in opcode.opname[op]}
+    result = [((opcode.opname[op1], opcode.opname[op2]), count / total,
+               (op1, op2) in fusable)
+              for (op1, op2), count in counts.items()]
+    result.sort(key=operator.itemgetter(1), reverse=True)
+    return result
+
+
+def render_fusion_candidates(profile=None, limit=20):
+    """Renders the `limit` most common opcode pairs to a string, one per
+    line, marking those that have a superinstruction with a '*'.
+
+    The result is a series of lines of the form:
+      percentage of all instructions [*] ('1st opname', '2nd opname')
+
+    """
+    if profile is None:
+        profile = snapshot_profile()
+    lines = []
+    for ops, fraction, fused in fusion_candidates(profile)[:limit]:
+        lines.append("%6.2f%% %s %s\n" % (100 * fraction,
+                                          '*' if fused else ' ', ops))
+    return ''.join(lines)
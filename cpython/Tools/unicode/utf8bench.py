@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Measure the throughput of the UTF-8 codec, in MB of UTF-8 per second.
+
+The corpora are built from short samples repeated up to the requested size:
+pure ASCII, ASCII with a few typographic quotes per line, Latin-1 text
+(mostly ASCII with accented letters), CJK text and ASCII text with emoji
+(characters outside the BMP).
+"""
+
+import sys
+import time
+from optparse import OptionParser
+
+SAMPLES = {
+    'ascii': "The quick brown fox jumps over the lazy dog; "
+             "pack my box with five dozen liquor jugs.\n",
+    'mixed': "\u201cLogs, metrics and traces\u201d are shipped to the collector "
+             "every minute; the ingest job decodes them before indexing.\n",
+    'latin1': "L'été déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter "
+              "en canoë au delà des îles, près du mälström où brûlent les "
+              "novæ.\n",
+    'cjk': "人人生而自由，在尊严"
+           "和权利上一律平等。す"
+           "べての人間は、生まれ"
+           "ながらにして自由。\n",
+    'emoji': "ok \U0001F600 ship it \U0001F680, tests pass ✅ "
+             "\U0001F389\U0001F389 thanks! \U0001F44D\n",
+}
+
+
+def make_corpus(name, size):
+    sample = SAMPLES[name]
+    count = size // len(sample.encode('utf-8')) + 1
+    return sample * count
+
+
+def bench(func, arg, nbytes, duration):
+    n = 0
+    start = time.perf_counter()
+    while True:
+        func(arg)
+        n += 1
+        elapsed = time.perf_counter() - start
+        if elapsed >= duration:
+            break
+    return nbytes * n / elapsed / 1e6
+
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options] [corpus ...]",
+                          description=__doc__)
+    parser.add_option("-s", "--size", type="int", default=1 << 20,
+                      help="size of each corpus in bytes (default %default)")
+    parser.add_option("-t", "--time", type="float", default=1.0,
+                      help="seconds spent on each test (default %default)")
+    options, args = parser.parse_args()
+    names = args or sorted(SAMPLES)
+    for name in names:
+        if name not in SAMPLES:
+            parser.error("unknown corpus %r, choose from %s"
+                         % (name, ", ".join(sorted(SAMPLES))))
+
+    print("Python %s" % sys.version.split()[0])
+    print("%-8s %12s %12s" % ("corpus", "decode MB/s", "encode MB/s"))
+    for name in names:
+        text = make_corpus(name, options.size)
+        data = text.encode('utf-8')
+        decode = bench(bytes.decode, data, len(data), options.time)
+        encode = bench(str.encode, text, len(data), options.time)
+        print("%-8s %12.1f %12.1f" % (name, decode, encode))
+
+
+if __name__ == "__main__":
+    main()